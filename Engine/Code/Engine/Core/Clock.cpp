@@ -19,6 +19,15 @@ Clock::Clock(Clock& parent)
 	m_parent->AddChild(this);
 }
 
+Clock::Clock(Clock* parent)
+	:m_parent(parent)
+{
+	if (m_parent != nullptr)
+	{
+		m_parent->AddChild(this);
+	}
+}
+
 void Clock::Reset()
 {
 	m_lastUpdateTimeInSeconds = 0.0;
@@ -57,10 +66,17 @@ void Clock::StepSingleFrame()
 
 Clock::~Clock()
 {
-	m_parent->RemoveChild(this);
+	if (m_parent != nullptr)
+	{
+		m_parent->RemoveChild(this);
+	}
+
 	for (int clockNum = 0; clockNum < (int)m_children.size(); ++clockNum)
 	{
-		m_children[clockNum]->m_parent = nullptr;
+		if (m_children[clockNum] != nullptr)
+		{
+			m_children[clockNum]->m_parent = nullptr;
+		}
 		m_children[clockNum] = nullptr;
 	}
 
@@ -107,6 +123,16 @@ void Clock::TickSystemClock()
 	s_systemClock->Tick();
 }
 
+void Clock::TickFixed(double deltaSeconds)
+{
+	if (m_isPaused && !m_stepSingleFrame)
+	{
+		deltaSeconds = 0;
+	}
+
+	Advance(deltaSeconds);
+}
+
 void Clock::Tick()
 {
 	double deltaSeconds = (GetCurrentTimeSeconds() - m_lastUpdateTimeInSeconds);
@@ -5,6 +5,7 @@ class Clock
 public:
 	Clock();
 	explicit Clock(Clock& parent);
+	explicit Clock(Clock* parent); //nullptr makes a detached root clock that only advances through TickFixed
 	~Clock();
 	Clock(Clock const& copy) = delete;
 
@@ -30,6 +31,8 @@ public:
 
 	static void TickSystemClock();
 
+	void TickFixed(double deltaSeconds); //advances this clock and its children by a fixed step, ignoring wall time
+
 protected:
 	void Tick();
 
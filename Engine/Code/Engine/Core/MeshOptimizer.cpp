@@ -0,0 +1,506 @@
+#include "Engine/Core/MeshOptimizer.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Time.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <math.h>
+
+//welding compares and hashes raw bytes, which is only safe while the vertex types have no padding
+static_assert(sizeof(Vertex_PCU) == 24, "Vertex_PCU gained padding, WeldVertices would compare garbage bytes");
+static_assert(sizeof(Vertex_PCUTBN) == 60, "Vertex_PCUTBN gained padding, WeldVertices would compare garbage bytes");
+
+//tuning values from Tom Forsyth's "Linear-Speed Vertex Cache Optimisation"
+constexpr int	FORSYTH_CACHE_SIZE = 32;
+constexpr float	FORSYTH_CACHE_DECAY_POWER = 1.5f;
+constexpr float	FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+constexpr float	FORSYTH_VALENCE_BOOST_SCALE = 2.f;
+constexpr float	FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+constexpr int	FORSYTH_MAX_VALENCE_IN_TABLE = 64;
+
+constexpr int	MIN_TRIANGLES_PER_OVERDRAW_CLUSTER = 16;
+
+//-----------------------------------------------------------------------------------------------
+static void FillIndexesIfUnindexed(int numVerts, std::vector<unsigned int>& indexes)
+{
+	if (!indexes.empty())
+	{
+		return;
+	}
+
+	indexes.resize(numVerts);
+	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	{
+		indexes[vertIndex] = (unsigned int)vertIndex;
+	}
+}
+
+static void GuaranteeIndexesInRange(std::vector<unsigned int> const& indexes, int numVerts, char const* errorMessage)
+{
+	for (unsigned int index : indexes)
+	{
+		GUARANTEE_OR_DIE(index < (unsigned int)numVerts, errorMessage);
+	}
+}
+
+static unsigned int GetBytesHash(void const* data, size_t numBytes)
+{
+	//FNV-1a
+	unsigned char const* bytes = (unsigned char const*)data;
+	unsigned int hash = 2166136261u;
+	for (size_t byteIndex = 0; byteIndex < numBytes; ++byteIndex)
+	{
+		hash ^= bytes[byteIndex];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+template<typename VertexType>
+static void WeldVerticesOfType(std::vector<VertexType>& verts, std::vector<unsigned int>& indexes)
+{
+	int numVerts = (int)verts.size();
+	FillIndexesIfUnindexed(numVerts, indexes);
+
+	//open addressing, kept at most half full so probe chains stay short
+	size_t tableSize = 1;
+	while (tableSize < (size_t)numVerts * 2)
+	{
+		tableSize <<= 1;
+	}
+	size_t tableMask = tableSize - 1;
+	std::vector<int> table(tableSize, -1);
+
+	std::vector<VertexType> uniqueVerts;
+	uniqueVerts.reserve(numVerts);
+	std::vector<unsigned int> remap(numVerts);
+	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	{
+		VertexType const& vert = verts[vertIndex];
+		size_t slot = GetBytesHash(&vert, sizeof(VertexType)) & tableMask;
+		while (table[slot] != -1 && memcmp(&uniqueVerts[table[slot]], &vert, sizeof(VertexType)) != 0)
+		{
+			slot = (slot + 1) & tableMask;
+		}
+
+		if (table[slot] == -1)
+		{
+			table[slot] = (int)uniqueVerts.size();
+			uniqueVerts.push_back(vert);
+		}
+		remap[vertIndex] = (unsigned int)table[slot];
+	}
+
+	for (unsigned int& index : indexes)
+	{
+		GUARANTEE_OR_DIE(index < (unsigned int)numVerts, "WeldVertices index out of range");
+		index = remap[index];
+	}
+	verts.swap(uniqueVerts);
+}
+
+template<typename VertexType>
+static void OptimizeOverdrawOfType(std::vector<VertexType> const& verts, std::vector<unsigned int>& indexes, float acmrThreshold, int cacheSize)
+{
+	int numTriangles = (int)indexes.size() / 3;
+	if (numTriangles < 2)
+	{
+		return;
+	}
+
+	//clusters are simulated from a cold cache and cut once they are within acmrThreshold of the cache optimized order
+	float cacheOrderACMR = ComputeACMR(indexes, (int)verts.size(), cacheSize);
+	float targetACMR = cacheOrderACMR * acmrThreshold;
+	std::vector<int> clusterStarts;
+	clusterStarts.push_back(0);
+	std::vector<int> cacheStamps(verts.size(), 0);
+	int numMisses = 0;
+	int clusterStartMisses = 0;
+	for (int triIndex = 0; triIndex < numTriangles; ++triIndex)
+	{
+		for (int cornerIndex = 0; cornerIndex < 3; ++cornerIndex)
+		{
+			int& stamp = cacheStamps[indexes[triIndex * 3 + cornerIndex]];
+			if (stamp <= clusterStartMisses || numMisses - stamp >= cacheSize)
+			{
+				stamp = ++numMisses;
+			}
+		}
+
+		int numClusterTriangles = triIndex + 1 - clusterStarts.back();
+		if (triIndex + 1 < numTriangles && numClusterTriangles >= MIN_TRIANGLES_PER_OVERDRAW_CLUSTER && (float)(numMisses - clusterStartMisses) <= targetACMR * (float)numClusterTriangles)
+		{
+			clusterStarts.push_back(triIndex + 1);
+			clusterStartMisses = numMisses;
+		}
+	}
+
+	//the tail never got a chance to settle under the target, so it rides along with the cluster before it
+	int numTailTriangles = numTriangles - clusterStarts.back();
+	if (clusterStarts.size() > 1 && (float)(numMisses - clusterStartMisses) > targetACMR * (float)numTailTriangles)
+	{
+		clusterStarts.pop_back();
+	}
+	int numClusters = (int)clusterStarts.size();
+	clusterStarts.push_back(numTriangles);
+	if (numClusters < 2)
+	{
+		return;
+	}
+
+	//area weighted centroid and normal per cluster; the cross product is already twice the area along the normal
+	std::vector<Vec3> clusterCentroids(numClusters);
+	std::vector<Vec3> clusterNormals(numClusters);
+	Vec3 meshCentroid;
+	float meshArea = 0.f;
+	for (int clusterIndex = 0; clusterIndex < numClusters; ++clusterIndex)
+	{
+		Vec3 centroidSum;
+		Vec3 normalSum;
+		float clusterArea = 0.f;
+		for (int triIndex = clusterStarts[clusterIndex]; triIndex < clusterStarts[clusterIndex + 1]; ++triIndex)
+		{
+			Vec3 const& a = verts[indexes[triIndex * 3]].m_position;
+			Vec3 const& b = verts[indexes[triIndex * 3 + 1]].m_position;
+			Vec3 const& c = verts[indexes[triIndex * 3 + 2]].m_position;
+			Vec3 areaNormal = CrossProduct3D(b - a, c - a);
+			float area = areaNormal.GetLength();
+			centroidSum += (a + b + c) * (area / 3.f);
+			normalSum += areaNormal;
+			clusterArea += area;
+		}
+		meshCentroid += centroidSum;
+		meshArea += clusterArea;
+		clusterCentroids[clusterIndex] = (clusterArea > 0.f) ? centroidSum / clusterArea : centroidSum;
+		clusterNormals[clusterIndex] = normalSum.GetNormalized();
+	}
+	if (meshArea > 0.f)
+	{
+		meshCentroid /= meshArea;
+	}
+
+	std::vector<float> clusterSortKeys(numClusters);
+	std::vector<int> clusterOrder(numClusters);
+	for (int clusterIndex = 0; clusterIndex < numClusters; ++clusterIndex)
+	{
+		clusterSortKeys[clusterIndex] = DotProduct3D(clusterCentroids[clusterIndex] - meshCentroid, clusterNormals[clusterIndex]);
+		clusterOrder[clusterIndex] = clusterIndex;
+	}
+	//stable so flat meshes, where every key is the same, keep the cache order untouched
+	std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&clusterSortKeys](int a, int b)
+		{
+			return clusterSortKeys[a] > clusterSortKeys[b];
+		});
+
+	std::vector<unsigned int> newIndexes;
+	newIndexes.reserve(indexes.size());
+	for (int clusterIndex : clusterOrder)
+	{
+		newIndexes.insert(newIndexes.end(), indexes.begin() + clusterStarts[clusterIndex] * 3, indexes.begin() + clusterStarts[clusterIndex + 1] * 3);
+	}
+
+	//the cache carries over between clusters when drawn, so the new order can still miss more than the clusters did alone
+	if (ComputeACMR(newIndexes, (int)verts.size(), cacheSize) <= targetACMR)
+	{
+		indexes.swap(newIndexes);
+	}
+}
+
+template<typename VertexType>
+static void OptimizeVertexFetchOfType(std::vector<VertexType>& verts, std::vector<unsigned int>& indexes)
+{
+	std::vector<int> remap(verts.size(), -1);
+	std::vector<VertexType> newVerts;
+	newVerts.reserve(verts.size());
+	for (unsigned int& index : indexes)
+	{
+		if (remap[index] < 0)
+		{
+			remap[index] = (int)newVerts.size();
+			newVerts.push_back(verts[index]);
+		}
+		index = (unsigned int)remap[index];
+	}
+	verts.swap(newVerts);
+}
+
+template<typename VertexType>
+static MeshOptimizationStats OptimizeMeshOfType(std::vector<VertexType>& verts, std::vector<unsigned int>& indexes, MeshOptimizerConfig const& config)
+{
+	GUARANTEE_OR_DIE(indexes.size() % 3 == 0 && (!indexes.empty() || verts.size() % 3 == 0), "OptimizeMesh needs a triangle list");
+	FillIndexesIfUnindexed((int)verts.size(), indexes);
+	GuaranteeIndexesInRange(indexes, (int)verts.size(), "OptimizeMesh index out of range");
+
+	MeshOptimizationStats stats;
+	stats.m_numTriangles = (int)indexes.size() / 3;
+	stats.m_numVertsBefore = (int)verts.size();
+	stats.m_acmrBefore = ComputeACMR(indexes, (int)verts.size(), config.m_acmrCacheSize);
+
+	if (config.m_weldVertices)
+	{
+		WeldVerticesOfType(verts, indexes);
+	}
+	OptimizeVertexCache(indexes, (int)verts.size());
+	if (config.m_optimizeOverdraw)
+	{
+		OptimizeOverdrawOfType(verts, indexes, config.m_overdrawACMRThreshold, config.m_acmrCacheSize);
+	}
+	OptimizeVertexFetchOfType(verts, indexes);
+
+	stats.m_numVertsAfter = (int)verts.size();
+	stats.m_acmrAfter = ComputeACMR(indexes, (int)verts.size(), config.m_acmrCacheSize);
+	return stats;
+}
+
+//-----------------------------------------------------------------------------------------------
+MeshOptimizationStats OptimizeMesh(Verts& verts, std::vector<unsigned int>& indexes, MeshOptimizerConfig const& config)
+{
+	return OptimizeMeshOfType(verts, indexes, config);
+}
+
+MeshOptimizationStats OptimizeMesh(VertTBNs& verts, std::vector<unsigned int>& indexes, MeshOptimizerConfig const& config)
+{
+	return OptimizeMeshOfType(verts, indexes, config);
+}
+
+void WeldVertices(Verts& verts, std::vector<unsigned int>& indexes)
+{
+	WeldVerticesOfType(verts, indexes);
+}
+
+void WeldVertices(VertTBNs& verts, std::vector<unsigned int>& indexes)
+{
+	WeldVerticesOfType(verts, indexes);
+}
+
+void OptimizeOverdraw(Verts const& verts, std::vector<unsigned int>& indexes, float acmrThreshold, int cacheSize)
+{
+	GuaranteeIndexesInRange(indexes, (int)verts.size(), "OptimizeOverdraw index out of range");
+	OptimizeOverdrawOfType(verts, indexes, acmrThreshold, cacheSize);
+}
+
+void OptimizeOverdraw(VertTBNs const& verts, std::vector<unsigned int>& indexes, float acmrThreshold, int cacheSize)
+{
+	GuaranteeIndexesInRange(indexes, (int)verts.size(), "OptimizeOverdraw index out of range");
+	OptimizeOverdrawOfType(verts, indexes, acmrThreshold, cacheSize);
+}
+
+void OptimizeVertexFetch(Verts& verts, std::vector<unsigned int>& indexes)
+{
+	GuaranteeIndexesInRange(indexes, (int)verts.size(), "OptimizeVertexFetch index out of range");
+	OptimizeVertexFetchOfType(verts, indexes);
+}
+
+void OptimizeVertexFetch(VertTBNs& verts, std::vector<unsigned int>& indexes)
+{
+	GuaranteeIndexesInRange(indexes, (int)verts.size(), "OptimizeVertexFetch index out of range");
+	OptimizeVertexFetchOfType(verts, indexes);
+}
+
+//-----------------------------------------------------------------------------------------------
+//vertexes in the cache score by how recently they were used, and vertexes with few triangles left get a boost
+//	so lone triangles are finished off instead of leaving holes to come back for
+static float GetForsythVertexScore(int cachePosition, int numRemainingTriangles, float const* cacheScores, float const* valenceScores)
+{
+	if (numRemainingTriangles == 0)
+	{
+		return -1.f;
+	}
+
+	float score = (cachePosition >= 0) ? cacheScores[cachePosition] : 0.f;
+	if (numRemainingTriangles <= FORSYTH_MAX_VALENCE_IN_TABLE)
+	{
+		return score + valenceScores[numRemainingTriangles];
+	}
+	return score + FORSYTH_VALENCE_BOOST_SCALE * powf((float)numRemainingTriangles, -FORSYTH_VALENCE_BOOST_POWER);
+}
+
+void OptimizeVertexCache(std::vector<unsigned int>& indexes, int numVerts)
+{
+	int numTriangles = (int)indexes.size() / 3;
+	if (numTriangles == 0)
+	{
+		return;
+	}
+
+	float cacheScores[FORSYTH_CACHE_SIZE];
+	for (int cachePosition = 0; cachePosition < FORSYTH_CACHE_SIZE; ++cachePosition)
+	{
+		//the last triangle's vertexes get a fixed score so the next pick doesn't just hug the previous triangle
+		cacheScores[cachePosition] = (cachePosition < 3) ? FORSYTH_LAST_TRIANGLE_SCORE :
+			powf(1.f - (float)(cachePosition - 3) / (float)(FORSYTH_CACHE_SIZE - 3), FORSYTH_CACHE_DECAY_POWER);
+	}
+	float valenceScores[FORSYTH_MAX_VALENCE_IN_TABLE + 1];
+	valenceScores[0] = 0.f;
+	for (int valence = 1; valence <= FORSYTH_MAX_VALENCE_IN_TABLE; ++valence)
+	{
+		valenceScores[valence] = FORSYTH_VALENCE_BOOST_SCALE * powf((float)valence, -FORSYTH_VALENCE_BOOST_POWER);
+	}
+
+	//triangles of each vertex; the first numRemainingTriangles entries are the ones not emitted yet
+	std::vector<int> firstTriangleOfVert(numVerts + 1, 0);
+	for (unsigned int index : indexes)
+	{
+		GUARANTEE_OR_DIE(index < (unsigned int)numVerts, "OptimizeVertexCache index out of range");
+		++firstTriangleOfVert[index + 1];
+	}
+	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	{
+		firstTriangleOfVert[vertIndex + 1] += firstTriangleOfVert[vertIndex];
+	}
+	std::vector<int> trianglesOfVert(indexes.size());
+	std::vector<int> numRemainingTriangles(numVerts, 0);
+	for (int cornerIndex = 0; cornerIndex < (int)indexes.size(); ++cornerIndex)
+	{
+		int vertIndex = indexes[cornerIndex];
+		trianglesOfVert[firstTriangleOfVert[vertIndex] + numRemainingTriangles[vertIndex]++] = cornerIndex / 3;
+	}
+
+	std::vector<int> cachePositions(numVerts, -1);
+	std::vector<float> vertScores(numVerts);
+	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	{
+		vertScores[vertIndex] = GetForsythVertexScore(-1, numRemainingTriangles[vertIndex], cacheScores, valenceScores);
+	}
+
+	std::vector<float> triangleScores(numTriangles);
+	std::vector<unsigned char> isTriangleEmitted(numTriangles, 0);
+	int bestTriangle = 0;
+	for (int triIndex = 0; triIndex < numTriangles; ++triIndex)
+	{
+		triangleScores[triIndex] = vertScores[indexes[triIndex * 3]] + vertScores[indexes[triIndex * 3 + 1]] + vertScores[indexes[triIndex * 3 + 2]];
+		if (triangleScores[triIndex] > triangleScores[bestTriangle])
+		{
+			bestTriangle = triIndex;
+		}
+	}
+
+	std::vector<unsigned int> newIndexes;
+	newIndexes.reserve(indexes.size());
+	int cache[FORSYTH_CACHE_SIZE + 3];
+	int newCache[FORSYTH_CACHE_SIZE + 3];
+	int cacheCount = 0;
+	int nextUnemittedTriangle = 0;
+	for (int numEmitted = 0; numEmitted < numTriangles; ++numEmitted)
+	{
+		//nothing left around the cache, restart from the first triangle not yet emitted
+		if (bestTriangle < 0)
+		{
+			while (isTriangleEmitted[nextUnemittedTriangle])
+			{
+				++nextUnemittedTriangle;
+			}
+			bestTriangle = nextUnemittedTriangle;
+		}
+
+		isTriangleEmitted[bestTriangle] = 1;
+		int newCacheCount = 0;
+		for (int cornerIndex = 0; cornerIndex < 3; ++cornerIndex)
+		{
+			int vertIndex = indexes[bestTriangle * 3 + cornerIndex];
+			newIndexes.push_back((unsigned int)vertIndex);
+
+			int* remainingTriangles = &trianglesOfVert[firstTriangleOfVert[vertIndex]];
+			int& numRemaining = numRemainingTriangles[vertIndex];
+			for (int slot = 0; slot < numRemaining; ++slot)
+			{
+				if (remainingTriangles[slot] == bestTriangle)
+				{
+					remainingTriangles[slot] = remainingTriangles[numRemaining - 1];
+					--numRemaining;
+					break;
+				}
+			}
+
+			if (std::find(newCache, newCache + newCacheCount, vertIndex) == newCache + newCacheCount)
+			{
+				newCache[newCacheCount++] = vertIndex;
+			}
+		}
+
+		//the emitted triangle moves to the front, everything else shifts back and the tail falls out
+		int numTriangleVerts = newCacheCount;
+		for (int cacheIndex = 0; cacheIndex < cacheCount; ++cacheIndex)
+		{
+			if (std::find(newCache, newCache + numTriangleVerts, cache[cacheIndex]) == newCache + numTriangleVerts)
+			{
+				newCache[newCacheCount++] = cache[cacheIndex];
+			}
+		}
+
+		for (int cacheIndex = 0; cacheIndex < newCacheCount; ++cacheIndex)
+		{
+			int vertIndex = newCache[cacheIndex];
+			cachePositions[vertIndex] = (cacheIndex < FORSYTH_CACHE_SIZE) ? cacheIndex : -1;
+			vertScores[vertIndex] = GetForsythVertexScore(cachePositions[vertIndex], numRemainingTriangles[vertIndex], cacheScores, valenceScores);
+		}
+
+		//only triangles touching the cache changed score, and the next pick comes from them
+		bestTriangle = -1;
+		float bestScore = -FLT_MAX;
+		for (int cacheIndex = 0; cacheIndex < newCacheCount; ++cacheIndex)
+		{
+			int vertIndex = newCache[cacheIndex];
+			int const* remainingTriangles = &trianglesOfVert[firstTriangleOfVert[vertIndex]];
+			for (int slot = 0; slot < numRemainingTriangles[vertIndex]; ++slot)
+			{
+				int triIndex = remainingTriangles[slot];
+				float score = vertScores[indexes[triIndex * 3]] + vertScores[indexes[triIndex * 3 + 1]] + vertScores[indexes[triIndex * 3 + 2]];
+				triangleScores[triIndex] = score;
+				if (score > bestScore)
+				{
+					bestScore = score;
+					bestTriangle = triIndex;
+				}
+			}
+		}
+
+		cacheCount = (newCacheCount < FORSYTH_CACHE_SIZE) ? newCacheCount : FORSYTH_CACHE_SIZE;
+		std::copy(newCache, newCache + cacheCount, cache);
+	}
+	indexes.swap(newIndexes);
+}
+
+//FIFO cache like most hardware: a hit does not move the vertex back to the front
+float ComputeACMR(std::vector<unsigned int> const& indexes, int numVerts, int cacheSize)
+{
+	int numTriangles = (int)indexes.size() / 3;
+	if (numTriangles == 0)
+	{
+		return 0.f;
+	}
+
+	//stamp is the miss count when the vertex went in, 0 for never; it is still cached until cacheSize newer misses push it out
+	std::vector<int> cacheStamps(numVerts, 0);
+	int numMisses = 0;
+	for (unsigned int index : indexes)
+	{
+		GUARANTEE_OR_DIE(index < (unsigned int)numVerts, "ComputeACMR index out of range");
+		int& stamp = cacheStamps[index];
+		if (stamp == 0 || numMisses - stamp >= cacheSize)
+		{
+			stamp = ++numMisses;
+		}
+	}
+	return (float)numMisses / (float)numTriangles;
+}
+
+//-----------------------------------------------------------------------------------------------
+MeshOptimizerBenchmarkResults RunMeshOptimizerBenchmark(int numSlices, int numStacks)
+{
+	MeshOptimizerBenchmarkResults results;
+	if (numSlices <= 0 || numStacks <= 0)
+	{
+		return results;
+	}
+
+	Verts verts;
+	AddVertsForUVSphereZ3D(verts, Vec3::ZERO, 1.f, numSlices, numStacks);
+	std::vector<unsigned int> indexes;
+
+	double startTime = GetCurrentTimeSeconds();
+	results.m_stats = OptimizeMesh(verts, indexes);
+	results.m_optimizeSeconds = GetCurrentTimeSeconds() - startTime;
+	return results;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "Engine/Core/VertexUtils.hpp"
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------
+// offline style clean up for meshes from VertexUtils or loaded from file, run once after building a static mesh
+//	1. weld: identical vertexes (bit for bit) are merged through a hash table, so an unindexed triangle list becomes indexed
+//	2. vertex cache: triangles are reordered with Forsyth's linear-speed algorithm so neighbours reuse transformed vertexes
+//	3. overdraw: the cache friendly order is cut into clusters that each start with a cold cache, cut as soon as the cluster's ACMR
+//		is within the threshold of the whole mesh's; clusters facing outward from the mesh center are then drawn first to hide the rest
+//		if the sorted order ends up over the threshold after all, the cache order is kept
+//	4. vertex fetch: vertexes are renumbered in first use order and unused vertexes dropped
+//	ACMR (average cache miss ratio) is post transform cache misses per triangle: 3 is no reuse, 0.5 is the best a regular grid gets
+//
+constexpr int MESH_OPTIMIZER_ACMR_CACHE_SIZE = 16;
+constexpr float MESH_OPTIMIZER_OVERDRAW_ACMR_THRESHOLD = 1.05f; //overdraw sorting may cost at most 5% more cache misses
+
+struct MeshOptimizerConfig
+{
+	bool	m_weldVertices = true;
+	bool	m_optimizeOverdraw = true;
+	float	m_overdrawACMRThreshold = MESH_OPTIMIZER_OVERDRAW_ACMR_THRESHOLD;
+	int		m_acmrCacheSize = MESH_OPTIMIZER_ACMR_CACHE_SIZE; //FIFO size for the reported numbers and the overdraw budget
+};
+
+struct MeshOptimizationStats
+{
+	int		m_numTriangles = 0;
+	int		m_numVertsBefore = 0;
+	int		m_numVertsAfter = 0;
+	float	m_acmrBefore = 0.f;
+	float	m_acmrAfter = 0.f;
+};
+
+//empty indexes means verts is an unindexed triangle list; indexes is always filled in on return
+MeshOptimizationStats	OptimizeMesh(Verts& verts, std::vector<unsigned int>& indexes, MeshOptimizerConfig const& config = MeshOptimizerConfig());
+MeshOptimizationStats	OptimizeMesh(VertTBNs& verts, std::vector<unsigned int>& indexes, MeshOptimizerConfig const& config = MeshOptimizerConfig());
+
+//the individual passes, in the order OptimizeMesh runs them
+void	WeldVertices(Verts& verts, std::vector<unsigned int>& indexes);
+void	WeldVertices(VertTBNs& verts, std::vector<unsigned int>& indexes);
+void	OptimizeVertexCache(std::vector<unsigned int>& indexes, int numVerts);
+void	OptimizeOverdraw(Verts const& verts, std::vector<unsigned int>& indexes, float acmrThreshold = MESH_OPTIMIZER_OVERDRAW_ACMR_THRESHOLD, int cacheSize = MESH_OPTIMIZER_ACMR_CACHE_SIZE);
+void	OptimizeOverdraw(VertTBNs const& verts, std::vector<unsigned int>& indexes, float acmrThreshold = MESH_OPTIMIZER_OVERDRAW_ACMR_THRESHOLD, int cacheSize = MESH_OPTIMIZER_ACMR_CACHE_SIZE);
+void	OptimizeVertexFetch(Verts& verts, std::vector<unsigned int>& indexes);
+void	OptimizeVertexFetch(VertTBNs& verts, std::vector<unsigned int>& indexes);
+
+float	ComputeACMR(std::vector<unsigned int> const& indexes, int numVerts, int cacheSize = MESH_OPTIMIZER_ACMR_CACHE_SIZE);
+
+//-----------------------------------------------------------------------------------------------
+// optimizes an unindexed UV sphere as built by AddVertsForUVSphereZ3D
+struct MeshOptimizerBenchmarkResults
+{
+	MeshOptimizationStats	m_stats;
+	double					m_optimizeSeconds = 0.0;
+};
+
+MeshOptimizerBenchmarkResults RunMeshOptimizerBenchmark(int numSlices, int numStacks);
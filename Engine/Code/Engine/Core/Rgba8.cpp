@@ -2,6 +2,7 @@
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
+#include <type_traits>
 
 Rgba8 const Rgba8::RED = Rgba8(255,0,0);
 Rgba8 const Rgba8::GREEN = Rgba8(0, 255, 0);
@@ -18,21 +19,7 @@ Rgba8 const Rgba8::TRANSLUCENT_BLACK = Rgba8(0, 0, 0, 125);
 Rgba8 const Rgba8::TRANSLUCENT_GREY = Rgba8(125, 125, 125, 125);
 Rgba8 const Rgba8::DEFAULT_NORMAL_MAP = Rgba8(127, 127, 255);
 
-Rgba8::Rgba8(const Rgba8& copyFrom)
-	: r(copyFrom.r)
-	, g(copyFrom.g)
-	, b(copyFrom.b)
-	, a(copyFrom.a)
-{
-}
-
-Rgba8::Rgba8(unsigned char redByte, unsigned char greenByte, unsigned char blueByte, unsigned char alphaByte)
-	: r(redByte)
-	, g(greenByte)
-	, b(blueByte)
-	, a(alphaByte)
-{
-}
+static_assert(std::is_trivially_copyable<Rgba8>::value, "Rgba8 must stay trivially copyable");
 
 void Rgba8::GetAsFloats(float* colorAsFloats) const
 {
@@ -60,11 +47,8 @@ Rgba8 Rgba8::GetAsDenormalizedColor(float* colorAsFloats)
 
 Rgba8 Rgba8::GetRandomColor(RandomNumberGenerator* rng)
 {
-	RandomNumberGenerator randomNumberGenerator;
-	if (rng != nullptr)
-	{
-		randomNumberGenerator = *rng;
-	}
+	RandomNumberGenerator localRng;
+	RandomNumberGenerator& randomNumberGenerator = (rng != nullptr) ? *rng : localRng;
 
 	Rgba8 randomColor(DenormalizeByte(randomNumberGenerator.RollRandomFloatZeroToOne()),
 		DenormalizeByte(randomNumberGenerator.RollRandomFloatZeroToOne()),
@@ -97,24 +81,6 @@ Rgba8 Rgba8::ColorLerp(Rgba8 const& start, Rgba8 const& end, float fraction)
 	return Rgba8(DenormalizeByte(rFloat), DenormalizeByte(gFloat), DenormalizeByte(bFloat), DenormalizeByte(aFloat));
 }
 
-bool Rgba8::operator==(Rgba8 const& compareColor) const
-{
-	return r == compareColor.r && g == compareColor.g && b == compareColor.b && a == compareColor.a;
-}
-
-bool Rgba8::operator!=(Rgba8 const& compareColor) const
-{
-	return r != compareColor.r || g != compareColor.g || b != compareColor.b || a != compareColor.a;
-}
-
-void Rgba8::operator=(Rgba8 const& copyFrom)
-{
-	r = copyFrom.r;
-	g = copyFrom.g;
-	b = copyFrom.b;
-	a = copyFrom.a;
-}
-
 void Rgba8::operator+=(Rgba8 const& colorToAdd)
 {
 	float rFloat = GetClampedZeroToOne(NormalizeByte(r) + NormalizeByte(colorToAdd.r));
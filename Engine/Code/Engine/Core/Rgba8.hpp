@@ -25,10 +25,9 @@ public:
 
 public:
 	//Construction / Destruction
-	~Rgba8() {}
-	Rgba8() {}
-	Rgba8(const Rgba8& copyFrom);
-	explicit Rgba8(unsigned char redByte, unsigned char greenByte, unsigned char blueByte, unsigned char alphaByte = 255);
+	Rgba8() = default;
+	constexpr explicit Rgba8(unsigned char redByte, unsigned char greenByte, unsigned char blueByte, unsigned char alphaByte = 255)
+		: r(redByte), g(greenByte), b(blueByte), a(alphaByte) {}
 
 	//Accessors
 	//-----------------------------------------------------------------------------------------------
@@ -45,9 +44,8 @@ public:
 
 	//Operator
 	//-----------------------------------------------------------------------------------------------
-	bool		operator==(Rgba8 const& compareColor) const;
-	bool		operator!=(Rgba8 const& compareColor) const;
-	void		operator=(Rgba8 const& copyFrom);
+	constexpr bool	operator==(Rgba8 const& compareColor) const { return r == compareColor.r && g == compareColor.g && b == compareColor.b && a == compareColor.a; }
+	constexpr bool	operator!=(Rgba8 const& compareColor) const { return r != compareColor.r || g != compareColor.g || b != compareColor.b || a != compareColor.a; }
 	void		operator+=(Rgba8 const& colorToAdd);
 	void		operator-=(Rgba8 const& colorToSubtract);
 	Rgba8		operator-(Rgba8 const& colorToSubtract);
@@ -0,0 +1,173 @@
+#include "Engine/Core/ThreadPool.hpp"
+#include <algorithm>
+
+ThreadPool::ThreadPool(ThreadPoolConfig const& config)
+	:m_config(config)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+	ShutDown();
+}
+
+void ThreadPool::Startup()
+{
+	int numWorkers = m_config.m_numWorkerThreads;
+	if (numWorkers < 0)
+	{
+		numWorkers = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+	}
+
+	m_isQuitting = false;
+	for (int threadNum = 0; threadNum < numWorkers; ++threadNum)
+	{
+		m_workerThreads.emplace_back(&ThreadPool::WorkerThreadMain, this);
+	}
+}
+
+void ThreadPool::ShutDown()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_taskMutex);
+		m_isQuitting = true;
+	}
+	m_taskAddedCondition.notify_all();
+
+	for (int threadNum = 0; threadNum < (int)m_workerThreads.size(); ++threadNum)
+	{
+		if (m_workerThreads[threadNum].joinable())
+		{
+			m_workerThreads[threadNum].join();
+		}
+	}
+
+	m_workerThreads.clear();
+}
+
+int ThreadPool::GetNumWorkerThreads() const
+{
+	return (int)m_workerThreads.size();
+}
+
+void ThreadPool::AddTask(ThreadPoolTask const& task)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_taskMutex);
+		m_tasks.push_back(task);
+		++m_numUnfinishedTasks;
+	}
+	m_taskAddedCondition.notify_one();
+}
+
+void ThreadPool::WaitForAllTasks()
+{
+	//help drain the queue instead of just sleeping, this also keeps a pool with zero workers from deadlocking
+	while (RunNextTask())
+	{
+	}
+
+	std::unique_lock<std::mutex> lock(m_taskMutex);
+	m_taskFinishedCondition.wait(lock, [this]() { return m_numUnfinishedTasks == 0; });
+}
+
+void ThreadPool::ParallelFor(int count, ParallelForRangeFunction const& function, int minBatchSize)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+
+	int numThreads = GetNumWorkerThreads() + 1;
+	int batchSize = std::max((count + numThreads - 1) / numThreads, std::max(minBatchSize, 1));
+	if (batchSize >= count)
+	{
+		function(0, count);
+		return;
+	}
+
+	//each call counts down only its own ranges, so a call from inside a task, or two callers at once, never waits on other work
+	int numRangesLeft = (count - 1) / batchSize; //ranges after the first one
+	for (int beginIndex = batchSize; beginIndex < count; beginIndex += batchSize)
+	{
+		int endIndex = std::min(beginIndex + batchSize, count);
+		AddTask([this, &function, &numRangesLeft, beginIndex, endIndex]()
+			{
+				function(beginIndex, endIndex);
+				std::lock_guard<std::mutex> lock(m_taskMutex);
+				--numRangesLeft;
+			});
+	}
+
+	//calling thread takes the first range itself so it is not idle while the workers run
+	function(0, batchSize);
+
+	//then helps drain the queue until its own ranges are done, which also keeps nested calls from stalling every worker
+	while (true)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_taskMutex);
+			if (numRangesLeft == 0)
+			{
+				return;
+			}
+		}
+
+		if (!RunNextTask())
+		{
+			std::unique_lock<std::mutex> lock(m_taskMutex);
+			m_taskFinishedCondition.wait(lock, [this, &numRangesLeft]() { return numRangesLeft == 0 || !m_tasks.empty(); });
+		}
+	}
+}
+
+void ThreadPool::WorkerThreadMain()
+{
+	while (true)
+	{
+		ThreadPoolTask task;
+		{
+			std::unique_lock<std::mutex> lock(m_taskMutex);
+			m_taskAddedCondition.wait(lock, [this]() { return m_isQuitting || !m_tasks.empty(); });
+			if (m_tasks.empty())
+			{
+				return;
+			}
+
+			task = m_tasks.front();
+			m_tasks.pop_front();
+		}
+
+		task();
+
+		{
+			std::lock_guard<std::mutex> lock(m_taskMutex);
+			--m_numUnfinishedTasks;
+		}
+		m_taskFinishedCondition.notify_all();
+	}
+}
+
+bool ThreadPool::RunNextTask()
+{
+	ThreadPoolTask task;
+	{
+		std::lock_guard<std::mutex> lock(m_taskMutex);
+		if (m_tasks.empty())
+		{
+			return false;
+		}
+
+		task = m_tasks.front();
+		m_tasks.pop_front();
+	}
+
+	task();
+
+	{
+		std::lock_guard<std::mutex> lock(m_taskMutex);
+		--m_numUnfinishedTasks;
+	}
+	m_taskFinishedCondition.notify_all();
+	return true;
+}
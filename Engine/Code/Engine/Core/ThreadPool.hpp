@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef std::function<void()> ThreadPoolTask;
+typedef std::function<void(int beginIndex, int endIndex)> ParallelForRangeFunction;
+
+struct ThreadPoolConfig
+{
+	int m_numWorkerThreads = -1; //-1 uses one worker per hardware thread minus the calling thread
+};
+
+class ThreadPool
+{
+public:
+	explicit ThreadPool(ThreadPoolConfig const& config = ThreadPoolConfig());
+	~ThreadPool();
+	ThreadPool(ThreadPool const& copy) = delete;
+
+	void Startup();
+	void ShutDown();
+
+	int GetNumWorkerThreads() const;
+
+	void AddTask(ThreadPoolTask const& task);
+	void WaitForAllTasks(); //waits for every task in the pool, so do not call it from inside a task
+
+	//splits [0, count) into contiguous ranges and runs them across the workers and the calling thread, returns once every range is done
+	//	only waits on its own ranges, so it can be called from inside a task or from several threads at once
+	void ParallelFor(int count, ParallelForRangeFunction const& function, int minBatchSize = 1);
+
+protected:
+	void WorkerThreadMain();
+	bool RunNextTask(); //pops and runs one task on the calling thread, returns false if the queue was empty
+
+protected:
+	ThreadPoolConfig m_config;
+	std::vector<std::thread> m_workerThreads;
+
+	std::deque<ThreadPoolTask> m_tasks;
+	std::mutex m_taskMutex;
+	std::condition_variable m_taskAddedCondition;
+	std::condition_variable m_taskFinishedCondition;
+	int m_numUnfinishedTasks = 0;
+
+	std::atomic<bool> m_isQuitting{ false };
+};
@@ -12,76 +12,420 @@
 #include "Engine/Math/FloatRange.hpp"
 #include "Engine/Math/IntRange.hpp"
 #include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Math/Splines.hpp"
 #include "Engine/Renderer/DebugRender.hpp"
 #include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/ThreadPool.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
 #include <vector>
+#include <type_traits>
 
-void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY)
+//-----------------------------------------------------------------------------------------------
+// batch kernels: deinterleave 4 verts into x/y/z lanes, transform them together, interleave back
+// summation order matches Mat44::TransformPosition3D / TransformPositionXY3D so results are identical to the per-vertex path
+struct Vec3Lanes
 {
-	// for loop through points in array
-	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	SIMDFloat4 x;
+	SIMDFloat4 y;
+	SIMDFloat4 z;
+};
+
+static Vec3Lanes const LoadVec3Lanes(Vec3 const& a, Vec3 const& b, Vec3 const& c, Vec3 const& d)
+{
+	return Vec3Lanes{ SIMDSet(a.x, b.x, c.x, d.x), SIMDSet(a.y, b.y, c.y, d.y), SIMDSet(a.z, b.z, c.z, d.z) };
+}
+
+static void StoreVec3Lanes(Vec3Lanes const& lanes, Vec3& a, Vec3& b, Vec3& c, Vec3& d)
+{
+	float x[4];
+	float y[4];
+	float z[4];
+	SIMDStore(x, lanes.x);
+	SIMDStore(y, lanes.y);
+	SIMDStore(z, lanes.z);
+	a = Vec3(x[0], y[0], z[0]);
+	b = Vec3(x[1], y[1], z[1]);
+	c = Vec3(x[2], y[2], z[2]);
+	d = Vec3(x[3], y[3], z[3]);
+}
+
+struct Mat44Lanes
+{
+	SIMDFloat4 m_values[16];
+
+	explicit Mat44Lanes(Mat44 const& transform)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPositionXY3D(pos, uniformScaleXY, rotationDegreesAboutZ, translationXY);
+		for (int valueIndex = 0; valueIndex < 16; ++valueIndex)
+		{
+			m_values[valueIndex] = SIMDSplat(transform.m_values[valueIndex]);
+		}
 	}
+};
+
+static Vec3Lanes const TransformVectorLanes(Mat44Lanes const& m, Vec3Lanes const& v)
+{
+	Vec3Lanes result;
+	result.x = SIMDAdd(SIMDAdd(SIMDMul(m.m_values[Mat44::Ix], v.x), SIMDMul(m.m_values[Mat44::Jx], v.y)), SIMDMul(m.m_values[Mat44::Kx], v.z));
+	result.y = SIMDAdd(SIMDAdd(SIMDMul(m.m_values[Mat44::Iy], v.x), SIMDMul(m.m_values[Mat44::Jy], v.y)), SIMDMul(m.m_values[Mat44::Ky], v.z));
+	result.z = SIMDAdd(SIMDAdd(SIMDMul(m.m_values[Mat44::Iz], v.x), SIMDMul(m.m_values[Mat44::Jz], v.y)), SIMDMul(m.m_values[Mat44::Kz], v.z));
+	return result;
 }
 
-void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
+static Vec3Lanes const TransformPositionLanes(Mat44Lanes const& m, Vec3Lanes const& p)
 {
-	// for loop through points in array
-	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	Vec3Lanes result = TransformVectorLanes(m, p);
+	result.x = SIMDAdd(result.x, m.m_values[Mat44::Tx]);
+	result.y = SIMDAdd(result.y, m.m_values[Mat44::Ty]);
+	result.z = SIMDAdd(result.z, m.m_values[Mat44::Tz]);
+	return result;
+}
+
+static void TransformVertexPositionsXY3DBatch(int numVerts, Vertex_PCU* verts, Vec2 const& iBasis, Vec2 const& jBasis, Vec2 const& translationXY)
+{
+	SIMDFloat4 iX = SIMDSplat(iBasis.x);
+	SIMDFloat4 iY = SIMDSplat(iBasis.y);
+	SIMDFloat4 jX = SIMDSplat(jBasis.x);
+	SIMDFloat4 jY = SIMDSplat(jBasis.y);
+	SIMDFloat4 tX = SIMDSplat(translationXY.x);
+	SIMDFloat4 tY = SIMDSplat(translationXY.y);
+
+	int vertIndex = 0;
+	for (; vertIndex + 4 <= numVerts; vertIndex += 4)
+	{
+		Vertex_PCU* quad = &verts[vertIndex];
+		Vec3Lanes pos = LoadVec3Lanes(quad[0].m_position, quad[1].m_position, quad[2].m_position, quad[3].m_position);
+		Vec3Lanes result;
+		result.x = SIMDAdd(SIMDAdd(tX, SIMDMul(pos.x, iX)), SIMDMul(pos.y, jX));
+		result.y = SIMDAdd(SIMDAdd(tY, SIMDMul(pos.x, iY)), SIMDMul(pos.y, jY));
+		result.z = pos.z;
+		StoreVec3Lanes(result, quad[0].m_position, quad[1].m_position, quad[2].m_position, quad[3].m_position);
+	}
+
+	for (; vertIndex < numVerts; ++vertIndex)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPositionXY3D(pos, vectorFwrd, vectorLeft, translationXY);
+		TransformPositionXY3D(verts[vertIndex].m_position, iBasis, jBasis, translationXY);
 	}
 }
 
-void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
+static void TransformVertexPositions3DBatch(int numVerts, Vertex_PCU* verts, Mat44 const& transform)
 {
-	for (int vertIndex = 0; vertIndex < (int)(verts.size()); ++vertIndex)
+	Mat44Lanes m(transform);
+	int vertIndex = 0;
+	for (; vertIndex + 4 <= numVerts; vertIndex += 4)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPositionXY3D(pos, vectorFwrd, vectorLeft, translationXY);
+		Vertex_PCU* quad = &verts[vertIndex];
+		Vec3Lanes pos = LoadVec3Lanes(quad[0].m_position, quad[1].m_position, quad[2].m_position, quad[3].m_position);
+		StoreVec3Lanes(TransformPositionLanes(m, pos), quad[0].m_position, quad[1].m_position, quad[2].m_position, quad[3].m_position);
+	}
+
+	for (; vertIndex < numVerts; ++vertIndex)
+	{
+		TransformPosition3D(verts[vertIndex].m_position, transform);
 	}
 }
 
-void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY, IntRange const& vertsToChangeIndexRange)
+static void TransformVertexTBNs3DBatch(int numVerts, Vertex_PCUTBN* verts, Mat44 const& transform)
 {
-	for (int vertIndex = vertsToChangeIndexRange.m_min; vertIndex < vertsToChangeIndexRange.m_max + 1; ++vertIndex)
+	Mat44Lanes m(transform);
+	int vertIndex = 0;
+	for (; vertIndex + 4 <= numVerts; vertIndex += 4)
+	{
+		Vertex_PCUTBN* quad = &verts[vertIndex];
+		Vec3Lanes pos = LoadVec3Lanes(quad[0].m_position, quad[1].m_position, quad[2].m_position, quad[3].m_position);
+		StoreVec3Lanes(TransformPositionLanes(m, pos), quad[0].m_position, quad[1].m_position, quad[2].m_position, quad[3].m_position);
+
+		Vec3Lanes normal = LoadVec3Lanes(quad[0].m_normal, quad[1].m_normal, quad[2].m_normal, quad[3].m_normal);
+		StoreVec3Lanes(TransformVectorLanes(m, normal), quad[0].m_normal, quad[1].m_normal, quad[2].m_normal, quad[3].m_normal);
+
+		Vec3Lanes tangent = LoadVec3Lanes(quad[0].m_tangent, quad[1].m_tangent, quad[2].m_tangent, quad[3].m_tangent);
+		StoreVec3Lanes(TransformVectorLanes(m, tangent), quad[0].m_tangent, quad[1].m_tangent, quad[2].m_tangent, quad[3].m_tangent);
+
+		Vec3Lanes biTangent = LoadVec3Lanes(quad[0].m_biTangent, quad[1].m_biTangent, quad[2].m_biTangent, quad[3].m_biTangent);
+		StoreVec3Lanes(TransformVectorLanes(m, biTangent), quad[0].m_biTangent, quad[1].m_biTangent, quad[2].m_biTangent, quad[3].m_biTangent);
+	}
+
+	for (; vertIndex < numVerts; ++vertIndex)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPositionXY3D(pos, vectorFwrd, vectorLeft, translationXY);
+		Vertex_PCUTBN& vert = verts[vertIndex];
+		TransformPosition3D(vert.m_position, transform);
+		vert.m_normal = transform.TransformVectorQuantity3D(vert.m_normal);
+		vert.m_tangent = transform.TransformVectorQuantity3D(vert.m_tangent);
+		vert.m_biTangent = transform.TransformVectorQuantity3D(vert.m_biTangent);
 	}
 }
 
+//-----------------------------------------------------------------------------------------------
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY)
+{
+	//one sin/cos for the whole array instead of a polar round trip per vertex
+	Vec2 iBasis = Vec2::MakeFromPolarDegrees(rotationDegreesAboutZ, uniformScaleXY);
+	Vec2 jBasis = iBasis.GetRotated90Degrees();
+	TransformVertexPositionsXY3DBatch(numVerts, verts, iBasis, jBasis, translationXY);
+}
+
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
+{
+	TransformVertexPositionsXY3DBatch(numVerts, verts, vectorFwrd, vectorLeft, translationXY);
+}
+
+void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
+{
+	if (verts.empty()) return;
+	TransformVertexPositionsXY3DBatch((int)verts.size(), verts.data(), vectorFwrd, vectorLeft, translationXY);
+}
+
+void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY, IntRange const& vertsToChangeIndexRange)
+{
+	int numVerts = vertsToChangeIndexRange.m_max - vertsToChangeIndexRange.m_min + 1;
+	if (numVerts <= 0) return;
+	TransformVertexPositionsXY3DBatch(numVerts, &verts[vertsToChangeIndexRange.m_min], vectorFwrd, vectorLeft, translationXY);
+}
+
+void TransformVertexArray3D(int numVerts, Vertex_PCU* verts, Mat44 const& transform)
+{
+	TransformVertexPositions3DBatch(numVerts, verts, transform);
+}
+
+void TransformVertexArray3D(int numVerts, Vertex_PCUTBN* verts, Mat44 const& transform)
+{
+	TransformVertexTBNs3DBatch(numVerts, verts, transform);
+}
+
 void TransformVertexArray3D(Verts& verts, Mat44 const& transform)
 {
-	for (int vertIndex = 0; vertIndex < (int)verts.size(); ++vertIndex)
+	if (verts.empty()) return;
+	TransformVertexPositions3DBatch((int)verts.size(), verts.data(), transform);
+}
+
+void TransformVertexArray3D(Verts& verts, Mat44 const& transform, IntRange const& vertsToChangeIndexRange)
+{
+	int numVerts = vertsToChangeIndexRange.m_max - vertsToChangeIndexRange.m_min + 1;
+	if (numVerts <= 0) return;
+	TransformVertexPositions3DBatch(numVerts, &verts[vertsToChangeIndexRange.m_min], transform);
+}
+
+void TransformVertexArray3D(VertTBNs& verts, Mat44 const& transform, IntRange const& vertsToChangeIndexRange)
+{
+	int numVerts = vertsToChangeIndexRange.m_max - vertsToChangeIndexRange.m_min + 1;
+	if (numVerts <= 0) return;
+	TransformVertexTBNs3DBatch(numVerts, &verts[vertsToChangeIndexRange.m_min], transform);
+}
+
+void TransformVertexArray3DParallel(Verts& verts, Mat44 const& transform, ThreadPool& threadPool)
+{
+	Vertex_PCU* vertData = verts.data();
+	threadPool.ParallelFor((int)verts.size(), [vertData, &transform](int beginIndex, int endIndex)
+		{
+			TransformVertexPositions3DBatch(endIndex - beginIndex, &vertData[beginIndex], transform);
+		}, MIN_VERTS_PER_TRANSFORM_TASK);
+}
+
+void TransformVertexArray3DParallel(VertTBNs& verts, Mat44 const& transform, ThreadPool& threadPool)
+{
+	Vertex_PCUTBN* vertData = verts.data();
+	threadPool.ParallelFor((int)verts.size(), [vertData, &transform](int beginIndex, int endIndex)
+		{
+			TransformVertexTBNs3DBatch(endIndex - beginIndex, &vertData[beginIndex], transform);
+		}, MIN_VERTS_PER_TRANSFORM_TASK);
+}
+
+//-----------------------------------------------------------------------------------------------
+struct TriangleTangentFrame
+{
+	Vec3	m_normal;
+	Vec3	m_tangent;		//unnormalized, only the direction matters once projected onto the vertex normal
+	Vec3	m_biTangent;
+	float	m_handedness = 0.f;	//sign of the uv determinant, -1 where the uvs are mirrored and 0 where they are degenerate
+	float	m_cornerWeights[3] = {};
+};
+
+static float GetCornerAngleRadians(Vec3 const& corner, Vec3 const& next, Vec3 const& prev)
+{
+	Vec3 toNext = (next - corner).GetNormalized();
+	Vec3 toPrev = (prev - corner).GetNormalized();
+	return acosf(GetClamped(DotProduct3D(toNext, toPrev), -1.f, 1.f));
+}
+
+static void RunTangentSpaceTask(int count, int minPerTask, ThreadPool* threadPool, ParallelForRangeFunction const& function)
+{
+	if (threadPool && count > minPerTask)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPosition3D(pos, transform);
+		threadPool->ParallelFor(count, function, minPerTask);
+		return;
 	}
+	function(0, count);
 }
 
-void TransformVertexArray3D(Verts& verts, Mat44 const& transform, IntRange const& vertsToChangeIndexRange)
+//corners of each vertex, grouped by vertex in index buffer order so the sums are always added in the same order
+static void GetCornersOfVerts(std::vector<unsigned int> const& indexes, int numVerts, std::vector<int>& out_firstCornerOfVert, std::vector<int>& out_corners)
 {
-	for (int vertIndex = vertsToChangeIndexRange.m_min; vertIndex < vertsToChangeIndexRange.m_max + 1; ++vertIndex)
+	out_firstCornerOfVert.assign(numVerts + 1, 0);
+	for (unsigned int vertIndex : indexes)
+	{
+		++out_firstCornerOfVert[vertIndex + 1];
+	}
+	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	{
+		out_firstCornerOfVert[vertIndex + 1] += out_firstCornerOfVert[vertIndex];
+	}
+	out_corners.resize(indexes.size());
+	std::vector<int> nextCornerSlot(out_firstCornerOfVert.begin(), out_firstCornerOfVert.end() - 1);
+	for (int cornerIndex = 0; cornerIndex < (int)indexes.size(); ++cornerIndex)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPosition3D(pos, transform);
+		out_corners[nextCornerSlot[indexes[cornerIndex]]++] = cornerIndex;
 	}
 }
 
-void TransformVertexArray3D(VertTBNs& verts, Mat44 const& transform, IntRange const& vertsToChangeIndexRange)
+static Vec3 const GetProjectedOntoPlaneNormalized(Vec3 const& vector, Vec3 const& planeNormal)
+{
+	return (vector - planeNormal * DotProduct3D(vector, planeNormal)).GetNormalized();
+}
+
+void CalculateTangentSpaceBasisVectors(VertTBNs& verts, std::vector<unsigned int>& indexes, bool computeNormals, ThreadPool* threadPool)
 {
-	for (int vertIndex = vertsToChangeIndexRange.m_min; vertIndex < vertsToChangeIndexRange.m_max + 1; ++vertIndex)
+	GUARANTEE_OR_DIE(indexes.size() % 3 == 0, "CalculateTangentSpaceBasisVectors needs a triangle list");
+	int numVerts = (int)verts.size();
+	int numTriangles = (int)indexes.size() / 3;
+	for (unsigned int vertIndex : indexes)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPosition3D(pos, transform);
-		verts[vertIndex].m_normal = transform.TransformVectorQuantity3D(verts[vertIndex].m_normal);
-		verts[vertIndex].m_tangent = transform.TransformVectorQuantity3D(verts[vertIndex].m_tangent);
-		verts[vertIndex].m_biTangent = transform.TransformVectorQuantity3D(verts[vertIndex].m_biTangent);
+		GUARANTEE_OR_DIE(vertIndex < (unsigned int)numVerts, "CalculateTangentSpaceBasisVectors index out of range");
 	}
+
+	Vertex_PCUTBN* vertData = verts.data();
+	unsigned int const* indexData = indexes.data();
+	std::vector<TriangleTangentFrame> triangleFrames(numTriangles);
+	TriangleTangentFrame* frameData = triangleFrames.data();
+
+	RunTangentSpaceTask(numTriangles, MIN_TRIANGLES_PER_TANGENT_TASK, threadPool, [vertData, indexData, frameData](int beginIndex, int endIndex)
+		{
+			for (int triIndex = beginIndex; triIndex < endIndex; ++triIndex)
+			{
+				Vertex_PCUTBN const& vertA = vertData[indexData[triIndex * 3]];
+				Vertex_PCUTBN const& vertB = vertData[indexData[triIndex * 3 + 1]];
+				Vertex_PCUTBN const& vertC = vertData[indexData[triIndex * 3 + 2]];
+				TriangleTangentFrame& frame = frameData[triIndex];
+
+				Vec3 edgeAB = vertB.m_position - vertA.m_position;
+				Vec3 edgeAC = vertC.m_position - vertA.m_position;
+				frame.m_normal = CrossProduct3D(edgeAB, edgeAC).GetNormalized();
+
+				//solve edge = tangent * du + biTangent * dv for both edges; zero uv area leaves the tangents zero
+				Vec2 uvAB = vertB.m_uvTexCoords - vertA.m_uvTexCoords;
+				Vec2 uvAC = vertC.m_uvTexCoords - vertA.m_uvTexCoords;
+				float uvDeterminant = (uvAB.x * uvAC.y) - (uvAC.x * uvAB.y);
+				if (uvDeterminant != 0.f)
+				{
+					float inverseDeterminant = 1.f / uvDeterminant;
+					frame.m_tangent = ((edgeAB * uvAC.y) - (edgeAC * uvAB.y)) * inverseDeterminant;
+					frame.m_biTangent = ((edgeAC * uvAB.x) - (edgeAB * uvAC.x)) * inverseDeterminant;
+					frame.m_handedness = (uvDeterminant > 0.f) ? 1.f : -1.f;
+				}
+
+				frame.m_cornerWeights[0] = GetCornerAngleRadians(vertA.m_position, vertB.m_position, vertC.m_position);
+				frame.m_cornerWeights[1] = GetCornerAngleRadians(vertB.m_position, vertC.m_position, vertA.m_position);
+				frame.m_cornerWeights[2] = GetCornerAngleRadians(vertC.m_position, vertA.m_position, vertB.m_position);
+			}
+		});
+
+	std::vector<int> firstCornerOfVert;
+	std::vector<int> corners;
+	GetCornersOfVerts(indexes, numVerts, firstCornerOfVert, corners);
+
+	//a vertex shared across a uv mirror seam gets a copy for the corners whose handedness differs from its first corner,
+	//	so each side keeps its own bitangent sign like MikkTSpace instead of averaging into a tangent that fits neither
+	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	{
+		float firstHandedness = 0.f;
+		int splitVertIndex = -1;
+		for (int slot = firstCornerOfVert[vertIndex]; slot < firstCornerOfVert[vertIndex + 1]; ++slot)
+		{
+			int cornerIndex = corners[slot];
+			float handedness = triangleFrames[cornerIndex / 3].m_handedness;
+			if (firstHandedness == 0.f)
+			{
+				firstHandedness = handedness;
+			}
+			else if (handedness != 0.f && handedness != firstHandedness)
+			{
+				if (splitVertIndex < 0)
+				{
+					splitVertIndex = (int)verts.size();
+					verts.push_back(verts[vertIndex]);
+				}
+				indexes[cornerIndex] = (unsigned int)splitVertIndex;
+			}
+		}
+	}
+	if ((int)verts.size() != numVerts)
+	{
+		numVerts = (int)verts.size();
+		vertData = verts.data();
+		GetCornersOfVerts(indexes, numVerts, firstCornerOfVert, corners);
+	}
+
+	int const* cornerData = corners.data();
+	int const* firstCornerData = firstCornerOfVert.data();
+	RunTangentSpaceTask(numVerts, MIN_VERTS_PER_TANGENT_TASK, threadPool, [vertData, frameData, cornerData, firstCornerData, computeNormals](int beginIndex, int endIndex)
+		{
+			for (int vertIndex = beginIndex; vertIndex < endIndex; ++vertIndex)
+			{
+				Vertex_PCUTBN& vert = vertData[vertIndex];
+				int firstCorner = firstCornerData[vertIndex];
+				int endCorner = firstCornerData[vertIndex + 1];
+				if (firstCorner == endCorner)
+				{
+					continue;
+				}
+
+				Vec3 normal = vert.m_normal;
+				if (computeNormals)
+				{
+					Vec3 normalSum;
+					for (int slot = firstCorner; slot < endCorner; ++slot)
+					{
+						TriangleTangentFrame const& frame = frameData[cornerData[slot] / 3];
+						normalSum += frame.m_normal * frame.m_cornerWeights[cornerData[slot] % 3];
+					}
+					if (normalSum.GetLengthSquared() > 0.f)
+					{
+						normal = normalSum.GetNormalized();
+					}
+				}
+				normal.Normalize();
+
+				Vec3 tangentSum;
+				Vec3 biTangentSum;
+				for (int slot = firstCorner; slot < endCorner; ++slot)
+				{
+					TriangleTangentFrame const& frame = frameData[cornerData[slot] / 3];
+					float cornerWeight = frame.m_cornerWeights[cornerData[slot] % 3];
+					tangentSum += GetProjectedOntoPlaneNormalized(frame.m_tangent, normal) * cornerWeight;
+					biTangentSum += GetProjectedOntoPlaneNormalized(frame.m_biTangent, normal) * cornerWeight;
+				}
+
+				Vec3 tangent = GetProjectedOntoPlaneNormalized(tangentSum, normal);
+				if (tangent.GetLengthSquared() == 0.f)
+				{
+					//no usable uvs, any direction in the surface will do
+					Vec3 reference = (fabsf(normal.z) < 0.9f) ? Vec3::UP : Vec3::FORWARD;
+					tangent = CrossProduct3D(reference, normal).GetNormalized();
+				}
+
+				//bitangent is rebuilt from normal x tangent with the uv handedness, so mirrored uvs keep the flipped sign
+				Vec3 biTangent = CrossProduct3D(normal, tangent);
+				if (DotProduct3D(biTangent, biTangentSum) < 0.f)
+				{
+					biTangent = -biTangent;
+				}
+
+				vert.m_normal = normal;
+				vert.m_tangent = tangent;
+				vert.m_biTangent = biTangent;
+			}
+		});
 }
 
 
@@ -507,6 +851,146 @@ void AddVertsForRing2D(Verts& verts, Vec2 const& center, float radius, float thi
 	}
 }
 
+void AddVertsForPolyline2D(Verts& verts, int numPoints, Vec2 const* points, float thickness, Rgba8 const& color)
+{
+	constexpr float MITER_LIMIT = 4.f; //sharper joins get their miter clamped to this many half thicknesses
+
+	//drop repeated points, they have no direction
+	std::vector<Vec2> path;
+	path.reserve(numPoints);
+	for (int pointNum = 0; pointNum < numPoints; ++pointNum)
+	{
+		if (path.empty() || GetDistanceSquared2D(path.back(), points[pointNum]) > 1e-12f)
+		{
+			path.push_back(points[pointNum]);
+		}
+	}
+	int numPathPoints = (int)path.size();
+	if (numPathPoints < 2)
+	{
+		return;
+	}
+
+	float halfThickness = 0.5f * thickness;
+	std::vector<Vec2> leftVerts(numPathPoints);
+	std::vector<Vec2> rightVerts(numPathPoints);
+	std::vector<float> us(numPathPoints);
+
+	Vec2 prevDirection = (path[1] - path[0]).GetNormalized();
+	Vec2 capOffset = prevDirection * halfThickness;
+	Vec2 stepLeft = capOffset.GetRotated90Degrees();
+	leftVerts[0] = path[0] - capOffset + stepLeft;
+	rightVerts[0] = path[0] - capOffset - stepLeft;
+	us[0] = 0.f;
+
+	for (int pointNum = 1; pointNum < numPathPoints; ++pointNum)
+	{
+		us[pointNum] = us[pointNum - 1] + GetDistance2D(path[pointNum - 1], path[pointNum]);
+		if (pointNum == numPathPoints - 1)
+		{
+			capOffset = prevDirection * halfThickness;
+			stepLeft = capOffset.GetRotated90Degrees();
+			leftVerts[pointNum] = path[pointNum] + capOffset + stepLeft;
+			rightVerts[pointNum] = path[pointNum] + capOffset - stepLeft;
+			break;
+		}
+
+		//miter: offset along the averaged normal, stretched so both neighbouring edges keep their thickness
+		Vec2 nextDirection = (path[pointNum + 1] - path[pointNum]).GetNormalized();
+		Vec2 prevLeft = prevDirection.GetRotated90Degrees();
+		Vec2 miterLeft = (prevDirection + nextDirection).GetRotated90Degrees();
+		float miterLength = miterLeft.GetLength();
+		if (miterLength < 1e-6f)
+		{
+			miterLeft = prevLeft; //path doubles back on itself
+		}
+		else
+		{
+			miterLeft /= miterLength;
+		}
+		float miterScale = halfThickness / fmaxf(DotProduct2D(miterLeft, prevLeft), 1.f / MITER_LIMIT);
+		leftVerts[pointNum] = path[pointNum] + (miterLeft * miterScale);
+		rightVerts[pointNum] = path[pointNum] - (miterLeft * miterScale);
+		prevDirection = nextDirection;
+	}
+
+	float totalLength = us[numPathPoints - 1];
+	float uPerLength = (totalLength > 0.f) ? 1.f / totalLength : 0.f;
+	verts.reserve(verts.size() + (6 * (numPathPoints - 1)));
+	for (int segmentNum = 0; segmentNum < numPathPoints - 1; ++segmentNum)
+	{
+		float startU = us[segmentNum] * uPerLength;
+		float endU = us[segmentNum + 1] * uPerLength;
+		verts.push_back(Vertex_PCU(rightVerts[segmentNum], color, Vec2(startU, 0.f)));
+		verts.push_back(Vertex_PCU(leftVerts[segmentNum + 1], color, Vec2(endU, 1.f)));
+		verts.push_back(Vertex_PCU(leftVerts[segmentNum], color, Vec2(startU, 1.f)));
+		verts.push_back(Vertex_PCU(leftVerts[segmentNum + 1], color, Vec2(endU, 1.f)));
+		verts.push_back(Vertex_PCU(rightVerts[segmentNum], color, Vec2(startU, 0.f)));
+		verts.push_back(Vertex_PCU(rightVerts[segmentNum + 1], color, Vec2(endU, 0.f)));
+	}
+}
+
+void AddVertsForBezierCurve2D(Verts& verts, CubicBezierCurve2D const& curve, float thickness, Rgba8 const& color, float flatnessTolerance)
+{
+	std::vector<Vec2> points;
+	curve.AddFlattenedPoints(points, flatnessTolerance);
+	AddVertsForPolyline2D(verts, (int)points.size(), points.data(), thickness, color);
+}
+
+void AddVertsForHermiteSpline2D(Verts& verts, CubicHermiteSpline2D const& spline, float thickness, Rgba8 const& color, float flatnessTolerance)
+{
+	std::vector<Vec2> points;
+	spline.AddFlattenedPoints(points, flatnessTolerance);
+	AddVertsForPolyline2D(verts, (int)points.size(), points.data(), thickness, color);
+}
+
+// each item is tessellated into its own array (in parallel when a pool is given), then appended in order
+template <typename CurveType>
+static void AddVertsForCurves2D(Verts& verts, int numCurves, CurveType const* curves, float thickness, Rgba8 const& color, float flatnessTolerance, ThreadPool* threadPool)
+{
+	std::vector<Verts> vertsPerCurve(numCurves);
+	auto tessellateRange = [curves, thickness, &color, flatnessTolerance, &vertsPerCurve](int beginIndex, int endIndex)
+		{
+			std::vector<Vec2> points;
+			for (int curveNum = beginIndex; curveNum < endIndex; ++curveNum)
+			{
+				points.clear();
+				curves[curveNum].AddFlattenedPoints(points, flatnessTolerance);
+				AddVertsForPolyline2D(vertsPerCurve[curveNum], (int)points.size(), points.data(), thickness, color);
+			}
+		};
+
+	if (threadPool == nullptr)
+	{
+		tessellateRange(0, numCurves);
+	}
+	else
+	{
+		threadPool->ParallelFor(numCurves, tessellateRange);
+	}
+
+	size_t numNewVerts = 0;
+	for (Verts const& curveVerts : vertsPerCurve)
+	{
+		numNewVerts += curveVerts.size();
+	}
+	verts.reserve(verts.size() + numNewVerts);
+	for (Verts const& curveVerts : vertsPerCurve)
+	{
+		verts.insert(verts.end(), curveVerts.begin(), curveVerts.end());
+	}
+}
+
+void AddVertsForBezierCurves2D(Verts& verts, int numCurves, CubicBezierCurve2D const* curves, float thickness, Rgba8 const& color, float flatnessTolerance, ThreadPool* threadPool)
+{
+	AddVertsForCurves2D(verts, numCurves, curves, thickness, color, flatnessTolerance, threadPool);
+}
+
+void AddVertsForHermiteSplines2D(Verts& verts, int numSplines, CubicHermiteSpline2D const* splines, float thickness, Rgba8 const& color, float flatnessTolerance, ThreadPool* threadPool)
+{
+	AddVertsForCurves2D(verts, numSplines, splines, thickness, color, flatnessTolerance, threadPool);
+}
+
 void AddVertsForQuad3D(Verts& verts, Vec3 const& bottomLeft, Vec3 const& bottomRight, Vec3 const& topRight, Vec3 const& topLeft, Rgba8 const& color, AABB2 const& uvs)
 {
 	verts.push_back(Vertex_PCU(bottomLeft, color, uvs.m_mins));
@@ -1622,6 +2106,113 @@ void AddVertsForWireFrameCone3D(Verts& verts, float lineThickness, Vec3 const& s
 	TransformVertexArray3D(verts, transform, IntRange(START_INDEX, (int)(verts.size() - 1)));
 }
 
+//-----------------------------------------------------------------------------------------------
+//Vertex_PCU as it was before it became trivially copyable, only here as the benchmark baseline
+struct BaselineVertex_PCU
+{
+	Vec3 m_position;
+	Rgba8 m_color;
+	Vec2 m_uvTexCoords;
+
+	~BaselineVertex_PCU() {}
+	BaselineVertex_PCU() {}
+	explicit BaselineVertex_PCU(Vec2 const& position2D, Rgba8 const& color, Vec2 const& uvTexCoords)
+		:m_position(Vec3(position2D.x, position2D.y, 0.f))
+		,m_color(color)
+		,m_uvTexCoords(uvTexCoords)
+	{
+	}
+};
+static_assert(!std::is_trivially_copyable<BaselineVertex_PCU>::value, "the benchmark baseline must not be trivially copyable");
+
+static void AddBaselineVertsForAABB2D(std::vector<BaselineVertex_PCU>& verts, AABB2 const& alignedBox, Rgba8 const& color, Vec2 const& uvMins, Vec2 const& uvMaxs)
+{
+	Vec2 BL = alignedBox.m_mins;
+	Vec2 BR = Vec2(alignedBox.m_maxs.x, alignedBox.m_mins.y);
+	Vec2 TL = Vec2(alignedBox.m_mins.x, alignedBox.m_maxs.y);
+	Vec2 TR = alignedBox.m_maxs;
+
+	verts.push_back(BaselineVertex_PCU(BL, color, uvMins));
+	verts.push_back(BaselineVertex_PCU(BR, color, Vec2(uvMaxs.x, uvMins.y)));
+	verts.push_back(BaselineVertex_PCU(TR, color, uvMaxs));
+	verts.push_back(BaselineVertex_PCU(BL, color, uvMins));
+	verts.push_back(BaselineVertex_PCU(TR, color, uvMaxs));
+	verts.push_back(BaselineVertex_PCU(TL, color, Vec2(uvMins.x, uvMaxs.y)));
+}
+
+VertexBuildingBenchmarkResults RunVertexBuildingBenchmark(int numQuads)
+{
+	VertexBuildingBenchmarkResults results;
+	if (numQuads <= 0)
+	{
+		return results;
+	}
+	results.m_numQuads = numQuads;
+
+	RandomNumberGenerator rng(1234u);
+	std::vector<AABB2> boxes;
+	boxes.reserve(numQuads);
+	for (int quadIndex = 0; quadIndex < numQuads; ++quadIndex)
+	{
+		Vec2 mins(rng.RollRandomFloatInRange(-100.f, 100.f), rng.RollRandomFloatInRange(-100.f, 100.f));
+		boxes.push_back(AABB2(mins, mins + Vec2(rng.RollRandomFloatInRange(0.1f, 5.f), rng.RollRandomFloatInRange(0.1f, 5.f))));
+	}
+
+	Verts verts;
+	verts.reserve((size_t)numQuads * 6);
+	double startTime = GetCurrentTimeSeconds();
+	for (int quadIndex = 0; quadIndex < numQuads; ++quadIndex)
+	{
+		AddVertsForAABB2D(verts, boxes[quadIndex], Rgba8::WHITE);
+	}
+	results.m_buildAABB2Seconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	TransformVertexArrayXY3D((int)verts.size(), verts.data(), 1.5f, 30.f, Vec2(10.f, -5.f));
+	results.m_transformXYSeconds = GetCurrentTimeSeconds() - startTime;
+
+	Mat44 transform = Mat44::MakeZRotationDegrees(15.f);
+	transform.SetTranslation3D(Vec3(1.f, 2.f, 3.f));
+	startTime = GetCurrentTimeSeconds();
+	TransformVertexArray3D(verts, transform);
+	results.m_transform3DSeconds = GetCurrentTimeSeconds() - startTime;
+
+	Verts copiedVerts;
+	copiedVerts.reserve(verts.size());
+	startTime = GetCurrentTimeSeconds();
+	for (size_t vertIndex = 0; vertIndex < verts.size(); ++vertIndex)
+	{
+		copiedVerts.push_back(verts[vertIndex]);
+	}
+	results.m_copyLoopSeconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	Verts bulkCopiedVerts(verts);
+	results.m_copyBulkSeconds = GetCurrentTimeSeconds() - startTime;
 
+	std::vector<BaselineVertex_PCU> baselineVerts;
+	baselineVerts.reserve((size_t)numQuads * 6);
+	startTime = GetCurrentTimeSeconds();
+	for (int quadIndex = 0; quadIndex < numQuads; ++quadIndex)
+	{
+		AddBaselineVertsForAABB2D(baselineVerts, boxes[quadIndex], Rgba8::WHITE, Vec2(0.f, 0.f), Vec2(1.f, 1.f));
+	}
+	results.m_baselineBuildAABB2Seconds = GetCurrentTimeSeconds() - startTime;
+
+	std::vector<BaselineVertex_PCU> baselineCopiedVerts;
+	baselineCopiedVerts.reserve(baselineVerts.size());
+	startTime = GetCurrentTimeSeconds();
+	for (size_t vertIndex = 0; vertIndex < baselineVerts.size(); ++vertIndex)
+	{
+		baselineCopiedVerts.push_back(baselineVerts[vertIndex]);
+	}
+	results.m_baselineCopyLoopSeconds = GetCurrentTimeSeconds() - startTime;
 
+	startTime = GetCurrentTimeSeconds();
+	std::vector<BaselineVertex_PCU> baselineBulkCopiedVerts(baselineVerts);
+	results.m_baselineCopyBulkSeconds = GetCurrentTimeSeconds() - startTime;
 
+	GUARANTEE_OR_DIE(bulkCopiedVerts.back().m_position == copiedVerts.back().m_position, "vertex copies should match");
+	GUARANTEE_OR_DIE(baselineBulkCopiedVerts.back().m_position == baselineCopiedVerts.back().m_position, "baseline vertex copies should match");
+	return results;
+}
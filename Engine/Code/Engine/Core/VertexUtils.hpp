@@ -15,6 +15,9 @@ struct Capsule2;
 struct Triangle2;
 struct Mat44;
 struct OBB3;
+class ThreadPool;
+class CubicBezierCurve2D;
+class CubicHermiteSpline2D;
 
 typedef std::vector<Vertex_PCU> Verts;
 typedef std::vector<Vertex_PCUTBN> VertTBNs;
@@ -28,6 +31,24 @@ void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const&
 void TransformVertexArray3D(Verts& verts, Mat44 const& transform);
 void TransformVertexArray3D(Verts& verts, Mat44 const& transform, IntRange const& vertsToChangeIndexRange);
 void TransformVertexArray3D(VertTBNs& verts, Mat44 const& transform, IntRange const& vertsToChangeIndexRange);
+void TransformVertexArray3D(int numVerts, Vertex_PCU* verts, Mat44 const& transform);
+void TransformVertexArray3D(int numVerts, Vertex_PCUTBN* verts, Mat44 const& transform);
+
+//splits very large arrays across the thread pool; arrays under MIN_VERTS_PER_TRANSFORM_TASK run on the calling thread
+constexpr int MIN_VERTS_PER_TRANSFORM_TASK = 4096;
+void TransformVertexArray3DParallel(Verts& verts, Mat44 const& transform, ThreadPool& threadPool);
+void TransformVertexArray3DParallel(VertTBNs& verts, Mat44 const& transform, ThreadPool& threadPool);
+
+//smooth normals and MikkTSpace style tangents and bitangents for any indexed triangle list, e.g. meshes loaded from file
+//	each corner adds its triangle's normal and uv tangent weighted by the corner angle, tangents are projected onto the vertex normal
+//	only triangles sharing a vertex index are averaged, so vertexes split at hard edges or uv seams stay split
+//	a vertex shared by mirrored and unmirrored uvs is split in two: the copy is appended to verts and indexes are updated
+//	computeNormals false keeps the authored normals and only rebuilds tangents around them
+//	triangles then vertexes are split across the thread pool; each vertex gathers its own corners so there are no atomics
+//	and the result does not depend on the number of threads
+constexpr int MIN_TRIANGLES_PER_TANGENT_TASK = 1024;
+constexpr int MIN_VERTS_PER_TANGENT_TASK = 2048;
+void CalculateTangentSpaceBasisVectors(VertTBNs& verts, std::vector<unsigned int>& indexes, bool computeNormals = true, ThreadPool* threadPool = nullptr);
 
 void ChangeColorsOfVertexArray(int numVerts, Vertex_PCU* verts, Rgba8 const& color);
 
@@ -58,6 +79,16 @@ void AddVertsForArrow2D(Verts& verts, Vec2 const& start, Vec2 const& end, float
 
 void AddVertsForRing2D(Verts& verts, Vec2 const& center, float radius, float thickness, Rgba8 const& color);
 
+//one continuous ribbon with mitered joins and square caps, as a triangle list (2 triangles per segment)
+void AddVertsForPolyline2D(Verts& verts, int numPoints, Vec2 const* points, float thickness, Rgba8 const& color);
+
+//curves are subdivided adaptively until every piece is within flatnessTolerance of the curve
+//	pass the world size of about a quarter pixel for the current camera so zooming in adds detail only where it shows
+void AddVertsForBezierCurve2D(Verts& verts, CubicBezierCurve2D const& curve, float thickness, Rgba8 const& color, float flatnessTolerance = 0.01f);
+void AddVertsForHermiteSpline2D(Verts& verts, CubicHermiteSpline2D const& spline, float thickness, Rgba8 const& color, float flatnessTolerance = 0.01f);
+void AddVertsForBezierCurves2D(Verts& verts, int numCurves, CubicBezierCurve2D const* curves, float thickness, Rgba8 const& color, float flatnessTolerance = 0.01f, ThreadPool* threadPool = nullptr);
+void AddVertsForHermiteSplines2D(Verts& verts, int numSplines, CubicHermiteSpline2D const* splines, float thickness, Rgba8 const& color, float flatnessTolerance = 0.01f, ThreadPool* threadPool = nullptr);
+
 //Add verts for 3D shapes
 //-------------------------------------------------------------------------------
 void AddVertsForQuad3D(Verts& verts, Vec3 const& bottomLeft, Vec3 const& bottomRight, Vec3 const& topRight, Vec3 const& topLeft, Rgba8 const& color = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
@@ -97,4 +128,24 @@ void AddVertsForWireFrameAABB3D(Verts& verts, AABB3 const& bounds, float lineThi
 void AddVertsForWireFrameOBB3D(Verts& verts, OBB3 const& orientedBox, float lineThickness, Rgba8 const& color = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
 void AddVertsForWireFrameZCylinder3D(Verts& verts, float lineThickness, Vec3 const& bottom, float length, float radius, int numSlices = 16, Rgba8 const& tint = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
 void AddVertsForWireFrameZSphere3D(Verts& verts, float lineThickness, Vec3 const& center, float radius, int numSlices = 32, int numStacks = 16, Rgba8 const& tint = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
-void AddVertsForWireFrameCone3D(Verts& verts, float lineThickness, Vec3 const& start, Vec3 const& end, float radius, Rgba8 const& tint = Rgba8::WHITE, int numSlices = 16);
\ No newline at end of file
+void AddVertsForWireFrameCone3D(Verts& verts, float lineThickness, Vec3 const& start, Vec3 const& end, float radius, Rgba8 const& tint = Rgba8::WHITE, int numSlices = 16);
+
+//-----------------------------------------------------------------------------------------------
+// timing for the per frame vertex work that leans on the inline, trivially copyable math types
+//	the copy loop pushes vertexes one by one, the bulk copy is a plain vector copy (a memmove for trivially copyable types)
+//	the baseline numbers run the same build and copies on a copy of Vertex_PCU with the old user provided constructors
+//	and destructor, which is not trivially copyable, so the speedup shows up in one run
+struct VertexBuildingBenchmarkResults
+{
+	int		m_numQuads = 0;
+	double	m_buildAABB2Seconds = 0.0;
+	double	m_transformXYSeconds = 0.0;
+	double	m_transform3DSeconds = 0.0;
+	double	m_copyLoopSeconds = 0.0;
+	double	m_copyBulkSeconds = 0.0;
+	double	m_baselineBuildAABB2Seconds = 0.0;
+	double	m_baselineCopyLoopSeconds = 0.0;
+	double	m_baselineCopyBulkSeconds = 0.0;
+};
+
+VertexBuildingBenchmarkResults RunVertexBuildingBenchmark(int numQuads);
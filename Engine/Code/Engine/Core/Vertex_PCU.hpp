@@ -10,11 +10,13 @@ public:
 	Rgba8 m_color;
 	Vec2 m_uvTexCoords;
 public:
-	~Vertex_PCU(){}
-	Vertex_PCU(){}
+	//inline and trivially copyable so the AddVertsFor* builders compile down to plain stores and vertex arrays memcpy
+	Vertex_PCU() = default;
 
-	explicit Vertex_PCU(Vec3 const& position, Rgba8 const& color, Vec2 const& uvTexCoords = Vec2(0.f, 0.f));
-	explicit Vertex_PCU(Vec2 const& position2D, Rgba8 const& color, Vec2 const& uvTexCoords = Vec2(0.f, 0.f));
+	constexpr explicit Vertex_PCU(Vec3 const& position, Rgba8 const& color, Vec2 const& uvTexCoords = Vec2(0.f, 0.f))
+		:m_position(position), m_color(color), m_uvTexCoords(uvTexCoords) {}
+	constexpr explicit Vertex_PCU(Vec2 const& position2D, Rgba8 const& color, Vec2 const& uvTexCoords = Vec2(0.f, 0.f))
+		:m_position(position2D.x, position2D.y, 0.f), m_color(color), m_uvTexCoords(uvTexCoords) {}
 
 };
 
@@ -13,10 +13,11 @@ public:
 	Vec3 m_normal;
 
 public:
-	Vertex_PCUTBN() {}
-	~Vertex_PCUTBN() {}
+	Vertex_PCUTBN() = default;
 
-	explicit Vertex_PCUTBN(Vec3 const& position, Rgba8 const& color, Vec3 const& normal, Vec2 uvTexCoords = Vec2(0.f, 1.f));
-	explicit Vertex_PCUTBN(Vec3 const& position, Rgba8 const& color, Vec3 const& tangent, Vec3 const& biTangent, Vec3 const& normal, Vec2 uvTexCoords = Vec2(0.f, 1.f));
+	constexpr explicit Vertex_PCUTBN(Vec3 const& position, Rgba8 const& color, Vec3 const& normal, Vec2 uvTexCoords = Vec2(0.f, 1.f))
+		:m_position(position), m_color(color), m_uvTexCoords(uvTexCoords), m_normal(normal) {}
+	constexpr explicit Vertex_PCUTBN(Vec3 const& position, Rgba8 const& color, Vec3 const& tangent, Vec3 const& biTangent, Vec3 const& normal, Vec2 uvTexCoords = Vec2(0.f, 1.f))
+		:m_position(position), m_color(color), m_uvTexCoords(uvTexCoords), m_tangent(tangent), m_biTangent(biTangent), m_normal(normal) {}
 };
 
@@ -7,24 +7,6 @@ AABB2 const AABB2::ONE = AABB2(1.f, 1.f, 1.f, 1.f);
 AABB2 const AABB2::ZERO_TO_ONE = AABB2(0.f, 0.f, 1.f, 1.f);
 AABB2 const AABB2::ONE_TO_ZERO = AABB2(1.f, 1.f, 0.f, 0.f);
 
-AABB2::AABB2(AABB2 const& copyFrom)
-	:m_mins(copyFrom.m_mins)
-	,m_maxs(copyFrom.m_maxs)
-{
-}
-
-AABB2::AABB2(float minX, float minY, float maxX, float maxY)
-	:m_mins(Vec2(minX, minY))
-	,m_maxs(Vec2(maxX, maxY))
-{
-}
-
-AABB2::AABB2(Vec2 const& mins, Vec2 const& maxs)
-	:m_mins(mins)
-	,m_maxs(maxs)
-{
-}
-
 bool AABB2::IsPointInside(Vec2 const& point) const
 {
 	return point.x >= m_mins.x && point.x <= m_maxs.x
@@ -87,11 +69,8 @@ Vec2 const AABB2::GetUVForPoint(Vec2 const& point) const
 
 Vec2 const AABB2::GetRandomPointInBounds(RandomNumberGenerator* randomNumberGenerator)
 {
-	RandomNumberGenerator rng;
-	if (randomNumberGenerator)
-	{
-		rng = *randomNumberGenerator;
-	}
+	RandomNumberGenerator localRng;
+	RandomNumberGenerator& rng = randomNumberGenerator ? *randomNumberGenerator : localRng;
 	float xPos = rng.RollRandomFloatInRange(m_mins.x, m_maxs.x);
 	float yPos = rng.RollRandomFloatInRange(m_mins.y, m_maxs.y);
 	
@@ -101,11 +80,8 @@ Vec2 const AABB2::GetRandomPointInBounds(RandomNumberGenerator* randomNumberGene
 Vec2 const AABB2::GetRandomPointOnEdgeOfBounds(RandomNumberGenerator* randomNumberGenerator)
 {
 	Vec2 randPos;
-	RandomNumberGenerator rng;
-	if (randomNumberGenerator)
-	{
-		rng = *randomNumberGenerator;
-	}
+	RandomNumberGenerator localRng;
+	RandomNumberGenerator& rng = randomNumberGenerator ? *randomNumberGenerator : localRng;
 
 	int side = rng.RollRandomIntInRange(0, 3);
 	
@@ -14,11 +14,9 @@ public:
 	static const AABB2 ONE_TO_ZERO;
 public:
 	//Constructor/Destruction
-	~AABB2(){}
-	AABB2() {}
-	AABB2(AABB2 const& copyFrom);
-	explicit AABB2(float minX, float minY, float maxX, float maxY);
-	explicit AABB2(Vec2 const& mins, Vec2 const& maxs);
+	AABB2() = default;
+	constexpr explicit AABB2(float minX, float minY, float maxX, float maxY) : m_mins(minX, minY), m_maxs(maxX, maxY) {}
+	constexpr explicit AABB2(Vec2 const& mins, Vec2 const& maxs) : m_mins(mins), m_maxs(maxs) {}
 
 	//Accessors (const methods)
 	bool IsPointInside(Vec2 const& point) const;
@@ -3,24 +3,6 @@
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/MathUtils.hpp"
 
-AABB3::AABB3(AABB3 const& copyFrom)
-	:m_mins(copyFrom.m_mins)
-	,m_maxs(copyFrom.m_maxs)
-{
-}
-
-AABB3::AABB3(float minX, float minY, float minZ, float maxX, float maxY, float maxZ)
-	:m_mins(Vec3(minX, minY, minZ))
-	,m_maxs(Vec3(maxX, maxY, maxZ))
-{
-}
-
-AABB3::AABB3(Vec3 const& mins, Vec3 const& maxs)
-	:m_mins(mins)
-	,m_maxs(maxs)
-{
-}
-
 AABB3::AABB3(AABB2 const& xAndYBounds, Vec2 const& zBounds)
 	:m_mins(Vec3(xAndYBounds.m_mins.x, xAndYBounds.m_mins.y, zBounds.x))
 	,m_maxs(Vec3(xAndYBounds.m_maxs.x, xAndYBounds.m_maxs.y, zBounds.y))
@@ -9,11 +9,9 @@ public:
 	Vec3 m_maxs;
 
 public:
-	AABB3() {}
-	~AABB3() {}
-	AABB3(AABB3 const& copyFrom);
-	explicit AABB3(float minX, float minY, float minZ, float maxX, float maxY, float maxZ);
-	explicit AABB3(Vec3 const& mins, Vec3 const& maxs);
+	AABB3() = default;
+	constexpr explicit AABB3(float minX, float minY, float minZ, float maxX, float maxY, float maxZ) : m_mins(minX, minY, minZ), m_maxs(maxX, maxY, maxZ) {}
+	constexpr explicit AABB3(Vec3 const& mins, Vec3 const& maxs) : m_mins(mins), m_maxs(maxs) {}
 	explicit AABB3(AABB2 const& xAndYBounds, Vec2 const& zBounds);
 
 	bool IsPointInside(Vec3 const& point) const;
@@ -0,0 +1,749 @@
+#include "Engine/Math/BVH3D.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Core/ThreadPool.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <algorithm>
+#include <math.h>
+
+constexpr int	MAX_PRIMITIVES_PER_LEAF = 4;
+constexpr int	MAX_BVH_DEPTH = 48;				//also sizes the traversal stacks
+constexpr int	NUM_SAH_BINS = 12;
+constexpr float	SAH_TRAVERSAL_COST = 1.f;		//relative to one primitive test
+constexpr int	MIN_PRIMITIVES_FOR_PARALLEL_BUILD = 4096;
+constexpr int	MIN_PRIMITIVES_PER_BUILD_TASK = 1024;
+
+//-----------------------------------------------------------------------------------------------
+static float GetAxisValue(Vec3 const& vec, int axis)
+{
+	return (axis == 0) ? vec.x : ((axis == 1) ? vec.y : vec.z);
+}
+
+static float GetSurfaceArea(AABB3 const& box)
+{
+	Vec3 dims = box.m_maxs - box.m_mins;
+	return 2.f * ((dims.x * dims.y) + (dims.y * dims.z) + (dims.z * dims.x));
+}
+
+static void StretchToIncludeBox(AABB3& box, AABB3 const& boxToInclude)
+{
+	box.StretchToIncludePoint(boxToInclude.m_mins);
+	box.StretchToIncludePoint(boxToInclude.m_maxs);
+}
+
+static RaycastResult3D const MakeMissResult(Ray3 const& ray)
+{
+	RaycastResult3D result;
+	result.m_didImpact = false;
+	result.m_impactDistance = ray.m_maxLength;
+	result.m_impactNormal = ray.m_fwrdNormal;
+	result.m_impactPos = ray.m_startPos + (ray.m_fwrdNormal * ray.m_maxLength);
+	return result;
+}
+
+//large finite stand-in for 1/0 so slab math never makes 0 * inf
+static float GetSafeReciprocal(float value)
+{
+	if (fabsf(value) > 1e-20f)
+	{
+		return 1.f / value;
+	}
+	return (value < 0.f) ? -1e20f : 1e20f;
+}
+
+//-----------------------------------------------------------------------------------------------
+int BVH3D::AddAABB3(AABB3 const& box, int userId)
+{
+	m_boxes.push_back(box);
+	return AddPrimitive(BVHPrimitiveType3D::ALIGNED_BOX, (int)m_boxes.size() - 1, userId);
+}
+
+int BVH3D::AddOBB3(OBB3 const& orientedBox, int userId)
+{
+	m_orientedBoxes.push_back(orientedBox);
+	return AddPrimitive(BVHPrimitiveType3D::ORIENTED_BOX, (int)m_orientedBoxes.size() - 1, userId);
+}
+
+int BVH3D::AddSphere(Vec3 const& center, float radius, int userId)
+{
+	m_spheres.push_back(ZSphere3D(center, radius));
+	return AddPrimitive(BVHPrimitiveType3D::SPHERE, (int)m_spheres.size() - 1, userId);
+}
+
+int BVH3D::AddZCylinder(ZCylinder3D const& cylinder, int userId)
+{
+	m_cylinders.push_back(cylinder);
+	return AddPrimitive(BVHPrimitiveType3D::ZCYLINDER, (int)m_cylinders.size() - 1, userId);
+}
+
+int BVH3D::AddTriangle(Vec3 const& vertA, Vec3 const& vertB, Vec3 const& vertC, int userId)
+{
+	Triangle triangle;
+	triangle.m_vertA = vertA;
+	triangle.m_vertB = vertB;
+	triangle.m_vertC = vertC;
+	m_triangles.push_back(triangle);
+	return AddPrimitive(BVHPrimitiveType3D::TRIANGLE, (int)m_triangles.size() - 1, userId);
+}
+
+int BVH3D::AddTriangleMesh(VertTBNs const& verts, std::vector<unsigned int> const& indexes, int userId, Mat44 const& transform)
+{
+	GUARANTEE_OR_DIE(indexes.size() % 3 == 0, "BVH3D triangle mesh index count must be a multiple of 3");
+	int firstPrimitiveIndex = GetNumPrimitives();
+	m_triangles.reserve(m_triangles.size() + indexes.size() / 3);
+	m_primitives.reserve(m_primitives.size() + indexes.size() / 3);
+	for (size_t index = 0; index < indexes.size(); index += 3)
+	{
+		AddTriangle(transform.TransformPosition3D(verts[indexes[index]].m_position),
+			transform.TransformPosition3D(verts[indexes[index + 1]].m_position),
+			transform.TransformPosition3D(verts[indexes[index + 2]].m_position), userId);
+	}
+	return firstPrimitiveIndex;
+}
+
+int BVH3D::AddTriangleMesh(VertTBNs const& verts, int userId, Mat44 const& transform)
+{
+	GUARANTEE_OR_DIE(verts.size() % 3 == 0, "BVH3D triangle list vertex count must be a multiple of 3");
+	int firstPrimitiveIndex = GetNumPrimitives();
+	m_triangles.reserve(m_triangles.size() + verts.size() / 3);
+	m_primitives.reserve(m_primitives.size() + verts.size() / 3);
+	for (size_t vertIndex = 0; vertIndex < verts.size(); vertIndex += 3)
+	{
+		AddTriangle(transform.TransformPosition3D(verts[vertIndex].m_position),
+			transform.TransformPosition3D(verts[vertIndex + 1].m_position),
+			transform.TransformPosition3D(verts[vertIndex + 2].m_position), userId);
+	}
+	return firstPrimitiveIndex;
+}
+
+void BVH3D::Clear()
+{
+	m_boxes.clear();
+	m_orientedBoxes.clear();
+	m_spheres.clear();
+	m_cylinders.clear();
+	m_triangles.clear();
+	m_primitives.clear();
+	m_nodes.clear();
+	m_primitiveOrder.clear();
+	m_isBuilt = false;
+}
+
+int BVH3D::AddPrimitive(BVHPrimitiveType3D type, int shapeIndex, int userId)
+{
+	Primitive primitive;
+	primitive.m_type = type;
+	primitive.m_shapeIndex = shapeIndex;
+	primitive.m_userId = userId;
+	m_primitives.push_back(primitive);
+	m_isBuilt = false;
+	return (int)m_primitives.size() - 1;
+}
+
+AABB3 BVH3D::GetPrimitiveBounds(Primitive const& primitive) const
+{
+	switch (primitive.m_type)
+	{
+		case BVHPrimitiveType3D::ALIGNED_BOX:
+		{
+			return m_boxes[primitive.m_shapeIndex];
+		}
+		case BVHPrimitiveType3D::ORIENTED_BOX:
+		{
+			OBB3 const& box = m_orientedBoxes[primitive.m_shapeIndex];
+			Vec3 iExtent = box.m_iBasis * box.m_halfDimensionsIJK.x;
+			Vec3 jExtent = box.m_jBasis * box.m_halfDimensionsIJK.y;
+			Vec3 kExtent = box.m_kBasis * box.m_halfDimensionsIJK.z;
+			Vec3 halfDims(fabsf(iExtent.x) + fabsf(jExtent.x) + fabsf(kExtent.x),
+				fabsf(iExtent.y) + fabsf(jExtent.y) + fabsf(kExtent.y),
+				fabsf(iExtent.z) + fabsf(jExtent.z) + fabsf(kExtent.z));
+			return AABB3(box.m_center - halfDims, box.m_center + halfDims);
+		}
+		case BVHPrimitiveType3D::SPHERE:
+		{
+			ZSphere3D const& sphere = m_spheres[primitive.m_shapeIndex];
+			Vec3 halfDims(sphere.m_radius, sphere.m_radius, sphere.m_radius);
+			return AABB3(sphere.m_center - halfDims, sphere.m_center + halfDims);
+		}
+		case BVHPrimitiveType3D::ZCYLINDER:
+		{
+			ZCylinder3D const& cylinder = m_cylinders[primitive.m_shapeIndex];
+			return AABB3(cylinder.m_centerXY.x - cylinder.m_radius, cylinder.m_centerXY.y - cylinder.m_radius, cylinder.m_zRange.m_min,
+				cylinder.m_centerXY.x + cylinder.m_radius, cylinder.m_centerXY.y + cylinder.m_radius, cylinder.m_zRange.m_max);
+		}
+		case BVHPrimitiveType3D::TRIANGLE:
+		{
+			Triangle const& triangle = m_triangles[primitive.m_shapeIndex];
+			AABB3 bounds(triangle.m_vertA, triangle.m_vertA);
+			bounds.StretchToIncludePoint(triangle.m_vertB);
+			bounds.StretchToIncludePoint(triangle.m_vertC);
+			return bounds;
+		}
+		default:
+		{
+			ERROR_AND_DIE("BVH3D primitive has no type");
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+void BVH3D::Build(ThreadPool* threadPool)
+{
+	int numPrimitives = GetNumPrimitives();
+	m_nodes.clear();
+	m_primitiveOrder.resize(numPrimitives);
+	m_buildBounds.resize(numPrimitives);
+	m_buildCenters.resize(numPrimitives);
+	for (int primIndex = 0; primIndex < numPrimitives; ++primIndex)
+	{
+		m_primitiveOrder[primIndex] = primIndex;
+		m_buildBounds[primIndex] = GetPrimitiveBounds(m_primitives[primIndex]);
+		m_buildCenters[primIndex] = m_buildBounds[primIndex].GetCenterPos();
+	}
+	m_isBuilt = true;
+	if (numPrimitives == 0)
+	{
+		return;
+	}
+
+	m_nodes.reserve(2 * numPrimitives);
+	m_nodes.push_back(Node());
+	BuildRange rootRange;
+	rootRange.m_end = numPrimitives;
+
+	if (threadPool == nullptr || numPrimitives < MIN_PRIMITIVES_FOR_PARALLEL_BUILD)
+	{
+		BuildNode(m_nodes, rootRange, nullptr);
+	}
+	else
+	{
+		//split the top of the tree here, then build the remaining subtrees side by side into their own arrays
+		std::vector<BuildRange> deferredRanges;
+		BuildNode(m_nodes, rootRange, &deferredRanges);
+
+		std::vector<std::vector<Node>> subtrees(deferredRanges.size());
+		threadPool->ParallelFor((int)deferredRanges.size(), [this, &deferredRanges, &subtrees](int beginIndex, int endIndex)
+			{
+				for (int subtreeIndex = beginIndex; subtreeIndex < endIndex; ++subtreeIndex)
+				{
+					BuildRange localRange = deferredRanges[subtreeIndex];
+					localRange.m_nodeIndex = 0;
+					subtrees[subtreeIndex].push_back(Node());
+					BuildNode(subtrees[subtreeIndex], localRange, nullptr);
+				}
+			});
+
+		//local root replaces the placeholder node, everything under it is appended
+		for (size_t subtreeIndex = 0; subtreeIndex < subtrees.size(); ++subtreeIndex)
+		{
+			std::vector<Node>& subtree = subtrees[subtreeIndex];
+			int firstAppendedIndex = (int)m_nodes.size();
+			for (Node& node : subtree)
+			{
+				if (!node.IsLeaf())
+				{
+					node.m_firstIndex += firstAppendedIndex - 1;
+				}
+			}
+			m_nodes[deferredRanges[subtreeIndex].m_nodeIndex] = subtree[0];
+			m_nodes.insert(m_nodes.end(), subtree.begin() + 1, subtree.end());
+		}
+	}
+
+	std::vector<AABB3>().swap(m_buildBounds);
+	std::vector<Vec3>().swap(m_buildCenters);
+}
+
+void BVH3D::BuildNode(std::vector<Node>& nodes, BuildRange const& range, std::vector<BuildRange>* out_deferredRanges)
+{
+	int numInRange = range.m_end - range.m_begin;
+	if (out_deferredRanges != nullptr && numInRange <= std::max(MIN_PRIMITIVES_PER_BUILD_TASK, GetNumPrimitives() / 64))
+	{
+		out_deferredRanges->push_back(range);
+		return;
+	}
+
+	int* order = m_primitiveOrder.data();
+	AABB3 bounds = m_buildBounds[order[range.m_begin]];
+	AABB3 centerBounds(m_buildCenters[order[range.m_begin]], m_buildCenters[order[range.m_begin]]);
+	for (int orderIndex = range.m_begin + 1; orderIndex < range.m_end; ++orderIndex)
+	{
+		StretchToIncludeBox(bounds, m_buildBounds[order[orderIndex]]);
+		centerBounds.StretchToIncludePoint(m_buildCenters[order[orderIndex]]);
+	}
+	nodes[range.m_nodeIndex].m_mins = bounds.m_mins;
+	nodes[range.m_nodeIndex].m_maxs = bounds.m_maxs;
+
+	if (numInRange == 1 || range.m_depth >= MAX_BVH_DEPTH)
+	{
+		nodes[range.m_nodeIndex].m_firstIndex = range.m_begin;
+		nodes[range.m_nodeIndex].m_numPrimitives = numInRange;
+		return;
+	}
+
+	//binned SAH, centers are dropped into buckets along each axis and every bucket boundary is costed
+	float parentArea = GetSurfaceArea(bounds);
+	float bestCost = (float)numInRange;
+	int bestAxis = -1;
+	int bestSplitBin = 0;
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		float axisMin = GetAxisValue(centerBounds.m_mins, axis);
+		float axisExtent = GetAxisValue(centerBounds.m_maxs, axis) - axisMin;
+		if (axisExtent <= 0.f)
+		{
+			continue;
+		}
+
+		AABB3 binBounds[NUM_SAH_BINS];
+		int binCounts[NUM_SAH_BINS] = {};
+		float binsPerUnit = (float)NUM_SAH_BINS / axisExtent;
+		for (int orderIndex = range.m_begin; orderIndex < range.m_end; ++orderIndex)
+		{
+			int primIndex = order[orderIndex];
+			int bin = std::min(NUM_SAH_BINS - 1, (int)((GetAxisValue(m_buildCenters[primIndex], axis) - axisMin) * binsPerUnit));
+			if (binCounts[bin] == 0)
+			{
+				binBounds[bin] = m_buildBounds[primIndex];
+			}
+			else
+			{
+				StretchToIncludeBox(binBounds[bin], m_buildBounds[primIndex]);
+			}
+			++binCounts[bin];
+		}
+
+		//right side swept first so the left sweep can cost each split as it goes
+		float rightAreas[NUM_SAH_BINS] = {};
+		int rightCounts[NUM_SAH_BINS] = {};
+		AABB3 sweptBounds;
+		int sweptCount = 0;
+		for (int bin = NUM_SAH_BINS - 1; bin > 0; --bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				if (sweptCount == 0)
+				{
+					sweptBounds = binBounds[bin];
+				}
+				else
+				{
+					StretchToIncludeBox(sweptBounds, binBounds[bin]);
+				}
+				sweptCount += binCounts[bin];
+			}
+			rightCounts[bin] = sweptCount;
+			rightAreas[bin] = (sweptCount > 0) ? GetSurfaceArea(sweptBounds) : 0.f;
+		}
+
+		sweptCount = 0;
+		for (int bin = 0; bin < NUM_SAH_BINS - 1; ++bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				if (sweptCount == 0)
+				{
+					sweptBounds = binBounds[bin];
+				}
+				else
+				{
+					StretchToIncludeBox(sweptBounds, binBounds[bin]);
+				}
+				sweptCount += binCounts[bin];
+			}
+			if (sweptCount == 0 || rightCounts[bin + 1] == 0)
+			{
+				continue;
+			}
+
+			float cost = SAH_TRAVERSAL_COST + (((GetSurfaceArea(sweptBounds) * (float)sweptCount) + (rightAreas[bin + 1] * (float)rightCounts[bin + 1])) / parentArea);
+			if (bestAxis < 0 || cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplitBin = bin;
+			}
+		}
+	}
+
+	bool isSmallEnoughForLeaf = numInRange <= MAX_PRIMITIVES_PER_LEAF;
+	if (isSmallEnoughForLeaf && (bestAxis < 0 || (float)numInRange <= bestCost))
+	{
+		nodes[range.m_nodeIndex].m_firstIndex = range.m_begin;
+		nodes[range.m_nodeIndex].m_numPrimitives = numInRange;
+		return;
+	}
+
+	int splitIndex = range.m_begin + (numInRange / 2); //all centers in one spot, any even split will do
+	if (bestAxis >= 0)
+	{
+		float axisMin = GetAxisValue(centerBounds.m_mins, bestAxis);
+		float binsPerUnit = (float)NUM_SAH_BINS / (GetAxisValue(centerBounds.m_maxs, bestAxis) - axisMin);
+		Vec3 const* centers = m_buildCenters.data();
+		int* splitPos = std::partition(order + range.m_begin, order + range.m_end, [centers, bestAxis, axisMin, binsPerUnit, bestSplitBin](int primIndex)
+			{
+				int bin = std::min(NUM_SAH_BINS - 1, (int)((GetAxisValue(centers[primIndex], bestAxis) - axisMin) * binsPerUnit));
+				return bin <= bestSplitBin;
+			});
+		splitIndex = (int)(splitPos - order);
+	}
+
+	int leftChildIndex = (int)nodes.size();
+	nodes.push_back(Node());
+	nodes.push_back(Node());
+	nodes[range.m_nodeIndex].m_firstIndex = leftChildIndex;
+	nodes[range.m_nodeIndex].m_numPrimitives = 0;
+
+	BuildRange leftRange;
+	leftRange.m_nodeIndex = leftChildIndex;
+	leftRange.m_begin = range.m_begin;
+	leftRange.m_end = splitIndex;
+	leftRange.m_depth = range.m_depth + 1;
+	BuildNode(nodes, leftRange, out_deferredRanges);
+
+	BuildRange rightRange;
+	rightRange.m_nodeIndex = leftChildIndex + 1;
+	rightRange.m_begin = splitIndex;
+	rightRange.m_end = range.m_end;
+	rightRange.m_depth = range.m_depth + 1;
+	BuildNode(nodes, rightRange, out_deferredRanges);
+}
+
+//-----------------------------------------------------------------------------------------------
+int BVH3D::GetHeight() const
+{
+	if (m_nodes.empty())
+	{
+		return 0;
+	}
+	return GetNodeHeight(0);
+}
+
+int BVH3D::GetNodeHeight(int nodeIndex) const
+{
+	Node const& node = m_nodes[nodeIndex];
+	if (node.IsLeaf())
+	{
+		return 0;
+	}
+	return 1 + std::max(GetNodeHeight(node.m_firstIndex), GetNodeHeight(node.m_firstIndex + 1));
+}
+
+AABB3 BVH3D::GetBounds() const
+{
+	if (m_nodes.empty())
+	{
+		return AABB3(Vec3(), Vec3());
+	}
+	return AABB3(m_nodes[0].m_mins, m_nodes[0].m_maxs);
+}
+
+RaycastResult3D BVH3D::RaycastVsPrimitive(Ray3 const& ray, int primitiveIndex) const
+{
+	Primitive const& primitive = m_primitives[primitiveIndex];
+	switch (primitive.m_type)
+	{
+		case BVHPrimitiveType3D::ALIGNED_BOX:	return RaycastVsAABB3D(ray, m_boxes[primitive.m_shapeIndex]);
+		case BVHPrimitiveType3D::ORIENTED_BOX:	return RaycastVsOBB3D(ray, m_orientedBoxes[primitive.m_shapeIndex]);
+		case BVHPrimitiveType3D::SPHERE:		return RaycastVsSphere3D(ray, m_spheres[primitive.m_shapeIndex].m_center, m_spheres[primitive.m_shapeIndex].m_radius);
+		case BVHPrimitiveType3D::ZCYLINDER:		return RaycastVsZCylinder3D(ray, m_cylinders[primitive.m_shapeIndex]);
+		case BVHPrimitiveType3D::TRIANGLE:
+		{
+			Triangle const& triangle = m_triangles[primitive.m_shapeIndex];
+			return RaycastVsTriangle3D(ray, triangle.m_vertA, triangle.m_vertB, triangle.m_vertC);
+		}
+		default:								return MakeMissResult(ray);
+	}
+}
+
+BVHRaycastHit3D BVH3D::MakeHit(int primitiveIndex, RaycastResult3D const& result) const
+{
+	BVHRaycastHit3D hit;
+	hit.m_primitiveIndex = primitiveIndex;
+	hit.m_userId = m_primitives[primitiveIndex].m_userId;
+	hit.m_type = m_primitives[primitiveIndex].m_type;
+	hit.m_result = result;
+	return hit;
+}
+
+//-----------------------------------------------------------------------------------------------
+// single ray: x/y/z slabs go through one 4-wide register, the w lane is padding
+struct RayLanes3D
+{
+	explicit RayLanes3D(Ray3 const& ray)
+		: m_start(SIMDSet(ray.m_startPos.x, ray.m_startPos.y, ray.m_startPos.z, 0.f))
+		, m_invFwrd(SIMDSet(GetSafeReciprocal(ray.m_fwrdNormal.x), GetSafeReciprocal(ray.m_fwrdNormal.y), GetSafeReciprocal(ray.m_fwrdNormal.z), 0.f))
+	{
+	}
+
+	SIMDFloat4 m_start;
+	SIMDFloat4 m_invFwrd;
+};
+
+static bool GetRayEntryIntoBox(RayLanes3D const& ray, Vec3 const& mins, Vec3 const& maxs, float maxDist, float& out_entryDist)
+{
+	SIMDFloat4 distsToMins = SIMDMul(SIMDSub(SIMDSet(mins.x, mins.y, mins.z, 0.f), ray.m_start), ray.m_invFwrd);
+	SIMDFloat4 distsToMaxs = SIMDMul(SIMDSub(SIMDSet(maxs.x, maxs.y, maxs.z, 0.f), ray.m_start), ray.m_invFwrd);
+	float entryDists[4];
+	float exitDists[4];
+	SIMDStore(entryDists, SIMDMin(distsToMins, distsToMaxs));
+	SIMDStore(exitDists, SIMDMax(distsToMins, distsToMaxs));
+
+	float entryDist = std::max(std::max(entryDists[0], entryDists[1]), std::max(entryDists[2], 0.f));
+	float exitDist = std::min(std::min(exitDists[0], exitDists[1]), std::min(exitDists[2], maxDist));
+	out_entryDist = entryDist;
+	return entryDist <= exitDist;
+}
+
+template <bool STOP_AT_FIRST_HIT>
+BVHRaycastHit3D BVH3D::RaycastSingle(Ray3 const& ray) const
+{
+	GUARANTEE_OR_DIE(m_isBuilt, "BVH3D must be built before raycasting");
+	int closestPrimIndex = -1;
+	RaycastResult3D closestResult = MakeMissResult(ray);
+	if (m_nodes.empty())
+	{
+		return BVHRaycastHit3D{ -1, -1, BVHPrimitiveType3D::NONE, closestResult };
+	}
+
+	RayLanes3D rayLanes(ray);
+	float rootEntryDist = 0.f;
+	if (!GetRayEntryIntoBox(rayLanes, m_nodes[0].m_mins, m_nodes[0].m_maxs, ray.m_maxLength, rootEntryDist))
+	{
+		return BVHRaycastHit3D{ -1, -1, BVHPrimitiveType3D::NONE, closestResult };
+	}
+
+	//each entry is a node the ray is known to enter, and how far along the ray it enters
+	int nodeStack[MAX_BVH_DEPTH + 2];
+	float entryStack[MAX_BVH_DEPTH + 2];
+	int stackSize = 1;
+	nodeStack[0] = 0;
+	entryStack[0] = rootEntryDist;
+
+	while (stackSize > 0)
+	{
+		--stackSize;
+		if (closestPrimIndex >= 0 && entryStack[stackSize] > closestResult.m_impactDistance)
+		{
+			continue;
+		}
+
+		Node const& node = m_nodes[nodeStack[stackSize]];
+		if (node.IsLeaf())
+		{
+			for (int orderIndex = node.m_firstIndex; orderIndex < node.m_firstIndex + node.m_numPrimitives; ++orderIndex)
+			{
+				int primIndex = m_primitiveOrder[orderIndex];
+				RaycastResult3D result = RaycastVsPrimitive(ray, primIndex);
+				if (result.m_didImpact && (closestPrimIndex < 0 || result.m_impactDistance < closestResult.m_impactDistance))
+				{
+					closestPrimIndex = primIndex;
+					closestResult = result;
+					if (STOP_AT_FIRST_HIT)
+					{
+						return MakeHit(closestPrimIndex, closestResult);
+					}
+				}
+			}
+			continue;
+		}
+
+		float maxDist = (closestPrimIndex >= 0) ? closestResult.m_impactDistance : ray.m_maxLength;
+		Node const& leftChild = m_nodes[node.m_firstIndex];
+		Node const& rightChild = m_nodes[node.m_firstIndex + 1];
+		float leftEntryDist = 0.f;
+		float rightEntryDist = 0.f;
+		bool isLeftHit = GetRayEntryIntoBox(rayLanes, leftChild.m_mins, leftChild.m_maxs, maxDist, leftEntryDist);
+		bool isRightHit = GetRayEntryIntoBox(rayLanes, rightChild.m_mins, rightChild.m_maxs, maxDist, rightEntryDist);
+
+		//push the far child first so the near one is visited next
+		bool isRightNearer = isRightHit && (!isLeftHit || rightEntryDist < leftEntryDist);
+		if (isRightNearer)
+		{
+			if (isLeftHit)
+			{
+				nodeStack[stackSize] = node.m_firstIndex;
+				entryStack[stackSize++] = leftEntryDist;
+			}
+			nodeStack[stackSize] = node.m_firstIndex + 1;
+			entryStack[stackSize++] = rightEntryDist;
+		}
+		else
+		{
+			if (isRightHit)
+			{
+				nodeStack[stackSize] = node.m_firstIndex + 1;
+				entryStack[stackSize++] = rightEntryDist;
+			}
+			if (isLeftHit)
+			{
+				nodeStack[stackSize] = node.m_firstIndex;
+				entryStack[stackSize++] = leftEntryDist;
+			}
+		}
+	}
+
+	if (closestPrimIndex < 0)
+	{
+		return BVHRaycastHit3D{ -1, -1, BVHPrimitiveType3D::NONE, closestResult };
+	}
+	return MakeHit(closestPrimIndex, closestResult);
+}
+
+BVHRaycastHit3D BVH3D::RaycastClosest(Ray3 const& ray) const
+{
+	return RaycastSingle<false>(ray);
+}
+
+bool BVH3D::RaycastAny(Ray3 const& ray, BVHRaycastHit3D* out_firstHitFound) const
+{
+	BVHRaycastHit3D hit = RaycastSingle<true>(ray);
+	if (out_firstHitFound)
+	{
+		*out_firstHitFound = hit;
+	}
+	return hit.m_primitiveIndex >= 0;
+}
+
+//-----------------------------------------------------------------------------------------------
+// packet of up to 4 rays: one SIMD lane per ray, each node is tested against the whole packet at once
+struct RayPacketLanes3D
+{
+	SIMDFloat4 m_startX;
+	SIMDFloat4 m_startY;
+	SIMDFloat4 m_startZ;
+	SIMDFloat4 m_invFwrdX;
+	SIMDFloat4 m_invFwrdY;
+	SIMDFloat4 m_invFwrdZ;
+};
+
+//returns one bit per lane whose ray enters the box before its max distance
+static int GetPacketHitsOnBox(RayPacketLanes3D const& rays, Vec3 const& mins, Vec3 const& maxs, SIMDFloat4 maxDists)
+{
+	SIMDFloat4 distsToMinX = SIMDMul(SIMDSub(SIMDSplat(mins.x), rays.m_startX), rays.m_invFwrdX);
+	SIMDFloat4 distsToMaxX = SIMDMul(SIMDSub(SIMDSplat(maxs.x), rays.m_startX), rays.m_invFwrdX);
+	SIMDFloat4 distsToMinY = SIMDMul(SIMDSub(SIMDSplat(mins.y), rays.m_startY), rays.m_invFwrdY);
+	SIMDFloat4 distsToMaxY = SIMDMul(SIMDSub(SIMDSplat(maxs.y), rays.m_startY), rays.m_invFwrdY);
+	SIMDFloat4 distsToMinZ = SIMDMul(SIMDSub(SIMDSplat(mins.z), rays.m_startZ), rays.m_invFwrdZ);
+	SIMDFloat4 distsToMaxZ = SIMDMul(SIMDSub(SIMDSplat(maxs.z), rays.m_startZ), rays.m_invFwrdZ);
+
+	SIMDFloat4 entryDists = SIMDMax(SIMDMax(SIMDMin(distsToMinX, distsToMaxX), SIMDMin(distsToMinY, distsToMaxY)), SIMDMax(SIMDMin(distsToMinZ, distsToMaxZ), SIMDSplat(0.f)));
+	SIMDFloat4 exitDists = SIMDMin(SIMDMin(SIMDMax(distsToMinX, distsToMaxX), SIMDMax(distsToMinY, distsToMaxY)), SIMDMin(SIMDMax(distsToMinZ, distsToMaxZ), maxDists));
+	return ~SIMDGetMaskBits(SIMDCmpGt(entryDists, exitDists)) & 0xF;
+}
+
+template <bool STOP_AT_FIRST_HIT>
+void BVH3D::RaycastPacket4(int numRays, Ray3 const* rays, BVHRaycastHit3D* out_hits) const
+{
+	GUARANTEE_OR_DIE(m_isBuilt, "BVH3D must be built before raycasting");
+	int closestPrimIndexes[4] = { -1, -1, -1, -1 };
+	RaycastResult3D closestResults[4];
+	float maxDists[4] = { -1.f, -1.f, -1.f, -1.f }; //unused lanes can never enter a box
+	for (int lane = 0; lane < numRays; ++lane)
+	{
+		closestResults[lane] = MakeMissResult(rays[lane]);
+		maxDists[lane] = rays[lane].m_maxLength;
+	}
+
+	if (!m_nodes.empty())
+	{
+		Ray3 const* laneRays[4];
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			laneRays[lane] = &rays[(lane < numRays) ? lane : 0];
+		}
+
+		RayPacketLanes3D packet;
+		packet.m_startX = SIMDSet(laneRays[0]->m_startPos.x, laneRays[1]->m_startPos.x, laneRays[2]->m_startPos.x, laneRays[3]->m_startPos.x);
+		packet.m_startY = SIMDSet(laneRays[0]->m_startPos.y, laneRays[1]->m_startPos.y, laneRays[2]->m_startPos.y, laneRays[3]->m_startPos.y);
+		packet.m_startZ = SIMDSet(laneRays[0]->m_startPos.z, laneRays[1]->m_startPos.z, laneRays[2]->m_startPos.z, laneRays[3]->m_startPos.z);
+		packet.m_invFwrdX = SIMDSet(GetSafeReciprocal(laneRays[0]->m_fwrdNormal.x), GetSafeReciprocal(laneRays[1]->m_fwrdNormal.x), GetSafeReciprocal(laneRays[2]->m_fwrdNormal.x), GetSafeReciprocal(laneRays[3]->m_fwrdNormal.x));
+		packet.m_invFwrdY = SIMDSet(GetSafeReciprocal(laneRays[0]->m_fwrdNormal.y), GetSafeReciprocal(laneRays[1]->m_fwrdNormal.y), GetSafeReciprocal(laneRays[2]->m_fwrdNormal.y), GetSafeReciprocal(laneRays[3]->m_fwrdNormal.y));
+		packet.m_invFwrdZ = SIMDSet(GetSafeReciprocal(laneRays[0]->m_fwrdNormal.z), GetSafeReciprocal(laneRays[1]->m_fwrdNormal.z), GetSafeReciprocal(laneRays[2]->m_fwrdNormal.z), GetSafeReciprocal(laneRays[3]->m_fwrdNormal.z));
+		Vec3 const& orderingFwrd = rays[0].m_fwrdNormal;
+
+		//nodes are tested when popped so lanes that already found something closer drop out
+		int nodeStack[MAX_BVH_DEPTH + 2];
+		int stackSize = 1;
+		nodeStack[0] = 0;
+		while (stackSize > 0)
+		{
+			Node const& node = m_nodes[nodeStack[--stackSize]];
+			int hitLanes = GetPacketHitsOnBox(packet, node.m_mins, node.m_maxs, SIMDLoad(maxDists));
+			if (hitLanes == 0)
+			{
+				continue;
+			}
+
+			if (!node.IsLeaf())
+			{
+				//near child (along the first ray) goes on top
+				Node const& leftChild = m_nodes[node.m_firstIndex];
+				Node const& rightChild = m_nodes[node.m_firstIndex + 1];
+				Vec3 leftToRight = (rightChild.m_mins + rightChild.m_maxs) - (leftChild.m_mins + leftChild.m_maxs);
+				bool isRightNearer = DotProduct3D(leftToRight, orderingFwrd) < 0.f;
+				nodeStack[stackSize++] = isRightNearer ? node.m_firstIndex : node.m_firstIndex + 1;
+				nodeStack[stackSize++] = isRightNearer ? node.m_firstIndex + 1 : node.m_firstIndex;
+				continue;
+			}
+
+			for (int orderIndex = node.m_firstIndex; orderIndex < node.m_firstIndex + node.m_numPrimitives; ++orderIndex)
+			{
+				int primIndex = m_primitiveOrder[orderIndex];
+				for (int lane = 0; lane < numRays; ++lane)
+				{
+					if ((hitLanes & (1 << lane)) == 0 || (STOP_AT_FIRST_HIT && closestPrimIndexes[lane] >= 0))
+					{
+						continue;
+					}
+
+					RaycastResult3D result = RaycastVsPrimitive(rays[lane], primIndex);
+					if (result.m_didImpact && (closestPrimIndexes[lane] < 0 || result.m_impactDistance < closestResults[lane].m_impactDistance))
+					{
+						closestPrimIndexes[lane] = primIndex;
+						closestResults[lane] = result;
+						maxDists[lane] = STOP_AT_FIRST_HIT ? -1.f : result.m_impactDistance;
+					}
+				}
+			}
+
+			if (STOP_AT_FIRST_HIT && std::all_of(closestPrimIndexes, closestPrimIndexes + numRays, [](int primIndex) { return primIndex >= 0; }))
+			{
+				break;
+			}
+		}
+	}
+
+	for (int lane = 0; lane < numRays; ++lane)
+	{
+		if (closestPrimIndexes[lane] < 0)
+		{
+			out_hits[lane] = BVHRaycastHit3D{ -1, -1, BVHPrimitiveType3D::NONE, closestResults[lane] };
+		}
+		else
+		{
+			out_hits[lane] = MakeHit(closestPrimIndexes[lane], closestResults[lane]);
+		}
+	}
+}
+
+void BVH3D::RaycastClosestPacket(int numRays, Ray3 const* rays, BVHRaycastHit3D* out_closestHits) const
+{
+	for (int firstRay = 0; firstRay < numRays; firstRay += 4)
+	{
+		RaycastPacket4<false>(std::min(4, numRays - firstRay), rays + firstRay, out_closestHits + firstRay);
+	}
+}
+
+void BVH3D::RaycastAnyPacket(int numRays, Ray3 const* rays, bool* out_didHit) const
+{
+	BVHRaycastHit3D hits[4];
+	for (int firstRay = 0; firstRay < numRays; firstRay += 4)
+	{
+		int numInPacket = std::min(4, numRays - firstRay);
+		RaycastPacket4<true>(numInPacket, rays + firstRay, hits);
+		for (int lane = 0; lane < numInPacket; ++lane)
+		{
+			out_didHit[firstRay + lane] = hits[lane].m_primitiveIndex >= 0;
+		}
+	}
+}
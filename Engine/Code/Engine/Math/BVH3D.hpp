@@ -0,0 +1,125 @@
+#pragma once
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/ZSphere3D.hpp"
+#include "Engine/Math/ZCylinder3D.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include <vector>
+class ThreadPool;
+
+//-----------------------------------------------------------------------------------------------
+// static bounding volume hierarchy over mixed 3D shapes and triangle soups, for picking and line of sight in big levels
+//	add everything, call Build once, then query; adding after Build needs another Build
+//	built top-down with binned SAH, big subtrees are built on the thread pool when one is given
+//
+enum class BVHPrimitiveType3D
+{
+	NONE = -1,
+	ALIGNED_BOX,
+	ORIENTED_BOX,
+	SPHERE,
+	ZCYLINDER,
+	TRIANGLE,
+	COUNT
+};
+
+struct BVHRaycastHit3D
+{
+	int					m_primitiveIndex = -1;		//value returned by the Add call (triangle meshes count one per triangle)
+	int					m_userId = -1;
+	BVHPrimitiveType3D	m_type = BVHPrimitiveType3D::NONE;
+	RaycastResult3D		m_result;
+};
+
+class BVH3D
+{
+public:
+	//each Add returns the primitive index reported in hits
+	int		AddAABB3(AABB3 const& box, int userId = -1);
+	int		AddOBB3(OBB3 const& orientedBox, int userId = -1);
+	int		AddSphere(Vec3 const& center, float radius, int userId = -1);
+	int		AddZCylinder(ZCylinder3D const& cylinder, int userId = -1);
+	int		AddTriangle(Vec3 const& vertA, Vec3 const& vertB, Vec3 const& vertC, int userId = -1);
+	int		AddTriangleMesh(VertTBNs const& verts, std::vector<unsigned int> const& indexes, int userId = -1, Mat44 const& transform = Mat44()); //returns the first triangle's index
+	int		AddTriangleMesh(VertTBNs const& verts, int userId = -1, Mat44 const& transform = Mat44()); //unindexed triangle list
+	void	Clear();
+
+	void	Build(ThreadPool* threadPool = nullptr);
+	bool	IsBuilt() const { return m_isBuilt; }
+
+	int		GetNumPrimitives() const { return (int)m_primitives.size(); }
+	int		GetNumNodes() const { return (int)m_nodes.size(); }
+	int		GetHeight() const;
+	AABB3	GetBounds() const;
+
+	//hits match the matching RaycastVs* function for that shape exactly
+	BVHRaycastHit3D	RaycastClosest(Ray3 const& ray) const;
+	bool			RaycastAny(Ray3 const& ray, BVHRaycastHit3D* out_firstHitFound = nullptr) const; //stops at the first hit, for line of sight
+
+	//coherent bundles of rays (4-8 from one eye or one muzzle) share node tests 4 rays at a time
+	void			RaycastClosestPacket(int numRays, Ray3 const* rays, BVHRaycastHit3D* out_closestHits) const;
+	void			RaycastAnyPacket(int numRays, Ray3 const* rays, bool* out_didHit) const;
+
+private:
+	struct Primitive
+	{
+		BVHPrimitiveType3D	m_type = BVHPrimitiveType3D::NONE;
+		int					m_shapeIndex = -1;		//into the array for m_type
+		int					m_userId = -1;
+	};
+
+	struct Triangle
+	{
+		Vec3 m_vertA;
+		Vec3 m_vertB;
+		Vec3 m_vertC;
+	};
+
+	//32 bytes, two nodes per cache line
+	struct Node
+	{
+		Vec3	m_mins;
+		int		m_firstIndex = 0;	//left child (right child follows it) or first entry in m_primitiveOrder
+		Vec3	m_maxs;
+		int		m_numPrimitives = 0;	//0 for internal nodes
+
+		bool IsLeaf() const { return m_numPrimitives > 0; }
+	};
+
+	struct BuildRange
+	{
+		int m_nodeIndex = 0;
+		int m_begin = 0;
+		int m_end = 0;
+		int m_depth = 0;
+	};
+
+	int		AddPrimitive(BVHPrimitiveType3D type, int shapeIndex, int userId);
+	AABB3	GetPrimitiveBounds(Primitive const& primitive) const;
+	void	BuildNode(std::vector<Node>& nodes, BuildRange const& range, std::vector<BuildRange>* out_deferredRanges);
+	int		GetNodeHeight(int nodeIndex) const;
+
+	RaycastResult3D RaycastVsPrimitive(Ray3 const& ray, int primitiveIndex) const;
+	BVHRaycastHit3D MakeHit(int primitiveIndex, RaycastResult3D const& result) const;
+
+	template <bool STOP_AT_FIRST_HIT>
+	BVHRaycastHit3D RaycastSingle(Ray3 const& ray) const;
+	template <bool STOP_AT_FIRST_HIT>
+	void			RaycastPacket4(int numRays, Ray3 const* rays, BVHRaycastHit3D* out_hits) const;
+
+private:
+	std::vector<AABB3>			m_boxes;
+	std::vector<OBB3>			m_orientedBoxes;
+	std::vector<ZSphere3D>		m_spheres;
+	std::vector<ZCylinder3D>	m_cylinders;
+	std::vector<Triangle>		m_triangles;
+	std::vector<Primitive>		m_primitives;
+
+	std::vector<Node>			m_nodes;
+	std::vector<int>			m_primitiveOrder;	//leaves index ranges of this
+	std::vector<AABB3>			m_buildBounds;		//per primitive, only alive during Build
+	std::vector<Vec3>			m_buildCenters;
+	bool						m_isBuilt = false;
+};
@@ -0,0 +1,494 @@
+#include "Engine/Math/BatchShapeQueries.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Math/OBB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/OBB3.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// every loop runs four lanes at a time; the last group is padded with zeros and its extra lanes masked off,
+//	so the tail goes through exactly the same math as the rest
+static SIMDFloat4 LoadLanes(float const* values, int index, int count)
+{
+	if (index + 4 <= count)
+	{
+		return SIMDLoad(&values[index]);
+	}
+
+	float padded[4] = { 0.f, 0.f, 0.f, 0.f };
+	for (int lane = 0; index + lane < count; ++lane)
+	{
+		padded[lane] = values[index + lane];
+	}
+	return SIMDLoad(padded);
+}
+
+static void StoreLanes(float* out_values, int index, int count, SIMDFloat4 lanes)
+{
+	if (index + 4 <= count)
+	{
+		SIMDStore(&out_values[index], lanes);
+		return;
+	}
+
+	float stored[4];
+	SIMDStore(stored, lanes);
+	for (int lane = 0; index + lane < count; ++lane)
+	{
+		out_values[index + lane] = stored[lane];
+	}
+}
+
+static void ClearBits(int count, unsigned int* out_bits)
+{
+	int numWords = (count + 31) / 32;
+	for (int wordIndex = 0; wordIndex < numWords; ++wordIndex)
+	{
+		out_bits[wordIndex] = 0;
+	}
+}
+
+//index is a multiple of 4, so a group's four bits never straddle two words
+static void WriteLaneBits(int index, int count, int laneBits, unsigned int* out_bits)
+{
+	int numLanes = count - index;
+	if (numLanes < 4)
+	{
+		laneBits &= (1 << numLanes) - 1;
+	}
+	out_bits[index >> 5] |= static_cast<unsigned int>(laneBits) << (index & 31);
+}
+
+static SIMDFloat4 ClampLanes(SIMDFloat4 value, SIMDFloat4 minValue, SIMDFloat4 maxValue)
+{
+	return SIMDMax(SIMDMin(value, maxValue), minValue);
+}
+
+//same steps as GetNearestPointOnLineSegment, with the bone normalized once up front
+struct BoneLanes
+{
+	SIMDFloat4 m_startX;
+	SIMDFloat4 m_startY;
+	SIMDFloat4 m_endX;
+	SIMDFloat4 m_endY;
+	SIMDFloat4 m_startToEndX;
+	SIMDFloat4 m_startToEndY;
+	SIMDFloat4 m_normalX;
+	SIMDFloat4 m_normalY;
+};
+
+static BoneLanes SplatBone(Vec2 const& boneStart, Vec2 const& boneEnd)
+{
+	Vec2 startToEnd = boneEnd - boneStart;
+	Vec2 boneNormal = startToEnd.GetNormalized();
+
+	BoneLanes bone;
+	bone.m_startX = SIMDSplat(boneStart.x);
+	bone.m_startY = SIMDSplat(boneStart.y);
+	bone.m_endX = SIMDSplat(boneEnd.x);
+	bone.m_endY = SIMDSplat(boneEnd.y);
+	bone.m_startToEndX = SIMDSplat(startToEnd.x);
+	bone.m_startToEndY = SIMDSplat(startToEnd.y);
+	bone.m_normalX = SIMDSplat(boneNormal.x);
+	bone.m_normalY = SIMDSplat(boneNormal.y);
+	return bone;
+}
+
+static void GetNearestLanesOnBone(BoneLanes const& bone, SIMDFloat4 x, SIMDFloat4 y, SIMDFloat4& out_nearestX, SIMDFloat4& out_nearestY)
+{
+	SIMDFloat4 zero = SIMDSplat(0.f);
+	SIMDFloat4 startToPointX = SIMDSub(x, bone.m_startX);
+	SIMDFloat4 startToPointY = SIMDSub(y, bone.m_startY);
+	SIMDFloat4 endToPointX = SIMDSub(x, bone.m_endX);
+	SIMDFloat4 endToPointY = SIMDSub(y, bone.m_endY);
+	SIMDFloat4 startDot = SIMDAdd(SIMDMul(startToPointX, bone.m_startToEndX), SIMDMul(startToPointY, bone.m_startToEndY));
+	SIMDFloat4 endDot = SIMDAdd(SIMDMul(endToPointX, bone.m_startToEndX), SIMDMul(endToPointY, bone.m_startToEndY));
+
+	SIMDFloat4 projectedLength = SIMDAdd(SIMDMul(startToPointX, bone.m_normalX), SIMDMul(startToPointY, bone.m_normalY));
+	SIMDFloat4 projectedX = SIMDAdd(bone.m_startX, SIMDMul(bone.m_normalX, projectedLength));
+	SIMDFloat4 projectedY = SIMDAdd(bone.m_startY, SIMDMul(bone.m_normalY, projectedLength));
+
+	SIMDMask4 pastStart = SIMDCmpGt(startDot, zero);
+	SIMDMask4 beforeEnd = SIMDCmpLt(endDot, zero);
+	out_nearestX = SIMDSelect(pastStart, SIMDSelect(beforeEnd, projectedX, bone.m_endX), bone.m_startX);
+	out_nearestY = SIMDSelect(pastStart, SIMDSelect(beforeEnd, projectedY, bone.m_endY), bone.m_startY);
+}
+
+//ClampLength: scale by maxLength / length only when length > maxLength
+static void ClampLengthLanes2D(SIMDFloat4& x, SIMDFloat4& y, SIMDFloat4 maxLength)
+{
+	SIMDFloat4 length = SIMDSqrt(SIMDAdd(SIMDMul(x, x), SIMDMul(y, y)));
+	SIMDMask4 tooLong = SIMDCmpGt(length, maxLength);
+	SIMDFloat4 scale = SIMDDiv(maxLength, length);	//lanes with length 0 are never too long, so their inf is thrown away
+	x = SIMDSelect(tooLong, SIMDMul(x, scale), x);
+	y = SIMDSelect(tooLong, SIMDMul(y, scale), y);
+}
+
+static void ClampLengthLanes3D(SIMDFloat4& x, SIMDFloat4& y, SIMDFloat4& z, SIMDFloat4 maxLength)
+{
+	SIMDFloat4 length = SIMDSqrt(SIMDAdd(SIMDAdd(SIMDMul(x, x), SIMDMul(y, y)), SIMDMul(z, z)));
+	SIMDMask4 tooLong = SIMDCmpGt(length, maxLength);
+	SIMDFloat4 scale = SIMDDiv(maxLength, length);	//lanes with length 0 are never too long, so their inf is thrown away
+	x = SIMDSelect(tooLong, SIMDMul(x, scale), x);
+	y = SIMDSelect(tooLong, SIMDMul(y, scale), y);
+	z = SIMDSelect(tooLong, SIMDMul(z, scale), z);
+}
+
+//-----------------------------------------------------------------------------------------------
+void ComputePointsInsideDisc2DBits(int count, float const* xs, float const* ys, Vec2 const& discCenter, float discRadius, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 centerX = SIMDSplat(discCenter.x);
+	SIMDFloat4 centerY = SIMDSplat(discCenter.y);
+	SIMDFloat4 radiusSquared = SIMDSplat(discRadius * discRadius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(LoadLanes(xs, index, count), centerX);
+		SIMDFloat4 dispY = SIMDSub(LoadLanes(ys, index, count), centerY);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY));
+		WriteLaneBits(index, count, SIMDGetMaskBits(SIMDCmpLt(distanceSquared, radiusSquared)), out_bits);
+	}
+}
+
+void ComputePointsInsideOBB2DBits(int count, float const* xs, float const* ys, OBB2 const& orientedBox, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 centerX = SIMDSplat(orientedBox.m_center.x);
+	SIMDFloat4 centerY = SIMDSplat(orientedBox.m_center.y);
+	SIMDFloat4 iBasisX = SIMDSplat(orientedBox.m_iBasisNormal.x);
+	SIMDFloat4 iBasisY = SIMDSplat(orientedBox.m_iBasisNormal.y);
+	SIMDFloat4 jBasisX = SIMDSplat(-orientedBox.m_iBasisNormal.y);
+	SIMDFloat4 halfWidth = SIMDSplat(orientedBox.m_halfDimensionsIJ.x);
+	SIMDFloat4 halfHeight = SIMDSplat(orientedBox.m_halfDimensionsIJ.y);
+	SIMDFloat4 negHalfWidth = SIMDNegate(halfWidth);
+	SIMDFloat4 negHalfHeight = SIMDNegate(halfHeight);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(LoadLanes(xs, index, count), centerX);
+		SIMDFloat4 dispY = SIMDSub(LoadLanes(ys, index, count), centerY);
+		SIMDFloat4 iDisp = SIMDAdd(SIMDMul(dispX, iBasisX), SIMDMul(dispY, iBasisY));
+		SIMDFloat4 jDisp = SIMDAdd(SIMDMul(dispX, jBasisX), SIMDMul(dispY, iBasisX));
+
+		SIMDMask4 inside = SIMDMaskAnd(SIMDCmpLt(iDisp, halfWidth), SIMDCmpGt(iDisp, negHalfWidth));
+		inside = SIMDMaskAnd(inside, SIMDMaskAnd(SIMDCmpLt(jDisp, halfHeight), SIMDCmpGt(jDisp, negHalfHeight)));
+		WriteLaneBits(index, count, SIMDGetMaskBits(inside), out_bits);
+	}
+}
+
+void ComputePointsInsideCapsule2DBits(int count, float const* xs, float const* ys, Vec2 const& boneStart, Vec2 const& boneEnd, float radius, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	BoneLanes bone = SplatBone(boneStart, boneEnd);
+	SIMDFloat4 radiusSquared = SIMDSplat(radius * radius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 x = LoadLanes(xs, index, count);
+		SIMDFloat4 y = LoadLanes(ys, index, count);
+		SIMDFloat4 nearestX;
+		SIMDFloat4 nearestY;
+		GetNearestLanesOnBone(bone, x, y, nearestX, nearestY);
+
+		SIMDFloat4 dispX = SIMDSub(nearestX, x);
+		SIMDFloat4 dispY = SIMDSub(nearestY, y);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY));
+		WriteLaneBits(index, count, SIMDGetMaskBits(SIMDCmpLt(distanceSquared, radiusSquared)), out_bits);
+	}
+}
+
+//inside the aperture when dot(disp, forward) >= length(disp) * cos(aperture / 2)
+//	a point on the tip has no direction, IsPointInsideOrientedSector2D sees it at 90 degrees so it is only inside a half disc or wider
+void ComputePointsInsideOrientedSector2DBits(int count, float const* xs, float const* ys, Vec2 const& sectorTip, float sectorForwardDegrees, float sectorApertureDegrees, float sectorRadius, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	Vec2 sectorForward = Vec2::MakeFromPolarDegrees(sectorForwardDegrees);
+	SIMDFloat4 tipX = SIMDSplat(sectorTip.x);
+	SIMDFloat4 tipY = SIMDSplat(sectorTip.y);
+	SIMDFloat4 forwardX = SIMDSplat(sectorForward.x);
+	SIMDFloat4 forwardY = SIMDSplat(sectorForward.y);
+	SIMDFloat4 cosHalfAperture = SIMDSplat(CosDegrees(sectorApertureDegrees * 0.5f));
+	SIMDFloat4 radiusSquared = SIMDSplat(sectorRadius * sectorRadius);
+	SIMDFloat4 zero = SIMDSplat(0.f);
+	bool isTipInsideAperture = !(90.f > sectorApertureDegrees * 0.5f);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(LoadLanes(xs, index, count), tipX);
+		SIMDFloat4 dispY = SIMDSub(LoadLanes(ys, index, count), tipY);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY));
+		SIMDFloat4 forwardDot = SIMDAdd(SIMDMul(dispX, forwardX), SIMDMul(dispY, forwardY));
+		SIMDFloat4 minForwardDot = SIMDMul(SIMDSqrt(distanceSquared), cosHalfAperture);
+
+		int inRangeBits = SIMDGetMaskBits(SIMDCmpLt(distanceSquared, radiusSquared));
+		int outsideApertureBits = SIMDGetMaskBits(SIMDCmpLt(forwardDot, minForwardDot));
+		if (!isTipInsideAperture)
+		{
+			outsideApertureBits |= ~SIMDGetMaskBits(SIMDCmpGt(distanceSquared, zero)) & 0xF;
+		}
+		WriteLaneBits(index, count, inRangeBits & ~outsideApertureBits, out_bits);
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+void ComputePointsInsideSphere3DBits(int count, float const* xs, float const* ys, float const* zs, Vec3 const& sphereCenter, float sphereRadius, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 centerX = SIMDSplat(sphereCenter.x);
+	SIMDFloat4 centerY = SIMDSplat(sphereCenter.y);
+	SIMDFloat4 centerZ = SIMDSplat(sphereCenter.z);
+	SIMDFloat4 radiusSquared = SIMDSplat(sphereRadius * sphereRadius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(LoadLanes(xs, index, count), centerX);
+		SIMDFloat4 dispY = SIMDSub(LoadLanes(ys, index, count), centerY);
+		SIMDFloat4 dispZ = SIMDSub(LoadLanes(zs, index, count), centerZ);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY)), SIMDMul(dispZ, dispZ));
+		WriteLaneBits(index, count, SIMDGetMaskBits(SIMDCmpLt(distanceSquared, radiusSquared)), out_bits);
+	}
+}
+
+void ComputePointsInsideAABB3DBits(int count, float const* xs, float const* ys, float const* zs, AABB3 const& box, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 minX = SIMDSplat(box.m_mins.x);
+	SIMDFloat4 minY = SIMDSplat(box.m_mins.y);
+	SIMDFloat4 minZ = SIMDSplat(box.m_mins.z);
+	SIMDFloat4 maxX = SIMDSplat(box.m_maxs.x);
+	SIMDFloat4 maxY = SIMDSplat(box.m_maxs.y);
+	SIMDFloat4 maxZ = SIMDSplat(box.m_maxs.z);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 x = LoadLanes(xs, index, count);
+		SIMDFloat4 y = LoadLanes(ys, index, count);
+		SIMDFloat4 z = LoadLanes(zs, index, count);
+		SIMDMask4 inside = SIMDMaskAnd(SIMDCmpGt(x, minX), SIMDCmpLt(x, maxX));
+		inside = SIMDMaskAnd(inside, SIMDMaskAnd(SIMDCmpGt(y, minY), SIMDCmpLt(y, maxY)));
+		inside = SIMDMaskAnd(inside, SIMDMaskAnd(SIMDCmpGt(z, minZ), SIMDCmpLt(z, maxZ)));
+		WriteLaneBits(index, count, SIMDGetMaskBits(inside), out_bits);
+	}
+}
+
+void ComputePointsInsideOBB3DBits(int count, float const* xs, float const* ys, float const* zs, OBB3 const& orientedBox, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 centerX = SIMDSplat(orientedBox.m_center.x);
+	SIMDFloat4 centerY = SIMDSplat(orientedBox.m_center.y);
+	SIMDFloat4 centerZ = SIMDSplat(orientedBox.m_center.z);
+	Vec3 const* bases[3] = { &orientedBox.m_iBasis, &orientedBox.m_jBasis, &orientedBox.m_kBasis };
+	float const halfDimensions[3] = { orientedBox.m_halfDimensionsIJK.x, orientedBox.m_halfDimensionsIJK.y, orientedBox.m_halfDimensionsIJK.z };
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(LoadLanes(xs, index, count), centerX);
+		SIMDFloat4 dispY = SIMDSub(LoadLanes(ys, index, count), centerY);
+		SIMDFloat4 dispZ = SIMDSub(LoadLanes(zs, index, count), centerZ);
+
+		int insideBits = 0xF;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			SIMDFloat4 axisDisp = SIMDAdd(SIMDAdd(SIMDMul(dispX, SIMDSplat(bases[axis]->x)), SIMDMul(dispY, SIMDSplat(bases[axis]->y))), SIMDMul(dispZ, SIMDSplat(bases[axis]->z)));
+			SIMDFloat4 halfDimension = SIMDSplat(halfDimensions[axis]);
+			insideBits &= SIMDGetMaskBits(SIMDMaskAnd(SIMDCmpLt(axisDisp, halfDimension), SIMDCmpGt(axisDisp, SIMDNegate(halfDimension))));
+		}
+		WriteLaneBits(index, count, insideBits, out_bits);
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+void ComputeDiscsContainingPoint2DBits(int count, float const* centerXs, float const* centerYs, float const* radii, Vec2 const& point, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 pointX = SIMDSplat(point.x);
+	SIMDFloat4 pointY = SIMDSplat(point.y);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(pointX, LoadLanes(centerXs, index, count));
+		SIMDFloat4 dispY = SIMDSub(pointY, LoadLanes(centerYs, index, count));
+		SIMDFloat4 radius = LoadLanes(radii, index, count);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY));
+		WriteLaneBits(index, count, SIMDGetMaskBits(SIMDCmpLt(distanceSquared, SIMDMul(radius, radius))), out_bits);
+	}
+}
+
+//DoDiscsOverlap counts touching as overlapping (<=), so take every lane that is not strictly farther apart
+void ComputeDiscsOverlappingDisc2DBits(int count, float const* centerXs, float const* centerYs, float const* radii, Vec2 const& discCenter, float discRadius, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 centerX = SIMDSplat(discCenter.x);
+	SIMDFloat4 centerY = SIMDSplat(discCenter.y);
+	SIMDFloat4 radius = SIMDSplat(discRadius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(centerX, LoadLanes(centerXs, index, count));
+		SIMDFloat4 dispY = SIMDSub(centerY, LoadLanes(centerYs, index, count));
+		SIMDFloat4 radiiSum = SIMDAdd(LoadLanes(radii, index, count), radius);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY));
+		int apartBits = SIMDGetMaskBits(SIMDCmpGt(distanceSquared, SIMDMul(radiiSum, radiiSum)));
+		WriteLaneBits(index, count, ~apartBits & 0xF, out_bits);
+	}
+}
+
+void ComputeSpheresContainingPoint3DBits(int count, float const* centerXs, float const* centerYs, float const* centerZs, float const* radii, Vec3 const& point, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 pointX = SIMDSplat(point.x);
+	SIMDFloat4 pointY = SIMDSplat(point.y);
+	SIMDFloat4 pointZ = SIMDSplat(point.z);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(pointX, LoadLanes(centerXs, index, count));
+		SIMDFloat4 dispY = SIMDSub(pointY, LoadLanes(centerYs, index, count));
+		SIMDFloat4 dispZ = SIMDSub(pointZ, LoadLanes(centerZs, index, count));
+		SIMDFloat4 radius = LoadLanes(radii, index, count);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY)), SIMDMul(dispZ, dispZ));
+		WriteLaneBits(index, count, SIMDGetMaskBits(SIMDCmpLt(distanceSquared, SIMDMul(radius, radius))), out_bits);
+	}
+}
+
+void ComputeSpheresOverlappingSphere3DBits(int count, float const* centerXs, float const* centerYs, float const* centerZs, float const* radii, Vec3 const& sphereCenter, float sphereRadius, unsigned int* out_bits)
+{
+	ClearBits(count, out_bits);
+	SIMDFloat4 centerX = SIMDSplat(sphereCenter.x);
+	SIMDFloat4 centerY = SIMDSplat(sphereCenter.y);
+	SIMDFloat4 centerZ = SIMDSplat(sphereCenter.z);
+	SIMDFloat4 radius = SIMDSplat(sphereRadius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(centerX, LoadLanes(centerXs, index, count));
+		SIMDFloat4 dispY = SIMDSub(centerY, LoadLanes(centerYs, index, count));
+		SIMDFloat4 dispZ = SIMDSub(centerZ, LoadLanes(centerZs, index, count));
+		SIMDFloat4 radiiSum = SIMDAdd(LoadLanes(radii, index, count), radius);
+		SIMDFloat4 distanceSquared = SIMDAdd(SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY)), SIMDMul(dispZ, dispZ));
+		int apartBits = SIMDGetMaskBits(SIMDCmpGt(distanceSquared, SIMDMul(radiiSum, radiiSum)));
+		WriteLaneBits(index, count, ~apartBits & 0xF, out_bits);
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+void GetNearestPointsOnDisc2DBatch(int count, float const* xs, float const* ys, Vec2 const& discCenter, float discRadius, float* out_xs, float* out_ys)
+{
+	SIMDFloat4 centerX = SIMDSplat(discCenter.x);
+	SIMDFloat4 centerY = SIMDSplat(discCenter.y);
+	SIMDFloat4 radius = SIMDSplat(discRadius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(LoadLanes(xs, index, count), centerX);
+		SIMDFloat4 dispY = SIMDSub(LoadLanes(ys, index, count), centerY);
+		ClampLengthLanes2D(dispX, dispY, radius);
+		StoreLanes(out_xs, index, count, SIMDAdd(centerX, dispX));
+		StoreLanes(out_ys, index, count, SIMDAdd(centerY, dispY));
+	}
+}
+
+void GetNearestPointsOnOBB2DBatch(int count, float const* xs, float const* ys, OBB2 const& orientedBox, float* out_xs, float* out_ys)
+{
+	SIMDFloat4 centerX = SIMDSplat(orientedBox.m_center.x);
+	SIMDFloat4 centerY = SIMDSplat(orientedBox.m_center.y);
+	SIMDFloat4 iBasisX = SIMDSplat(orientedBox.m_iBasisNormal.x);
+	SIMDFloat4 iBasisY = SIMDSplat(orientedBox.m_iBasisNormal.y);
+	SIMDFloat4 jBasisX = SIMDSplat(-orientedBox.m_iBasisNormal.y);
+	SIMDFloat4 halfWidth = SIMDSplat(orientedBox.m_halfDimensionsIJ.x);
+	SIMDFloat4 halfHeight = SIMDSplat(orientedBox.m_halfDimensionsIJ.y);
+	SIMDFloat4 negHalfWidth = SIMDNegate(halfWidth);
+	SIMDFloat4 negHalfHeight = SIMDNegate(halfHeight);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 x = LoadLanes(xs, index, count);
+		SIMDFloat4 y = LoadLanes(ys, index, count);
+		SIMDFloat4 dispX = SIMDSub(x, centerX);
+		SIMDFloat4 dispY = SIMDSub(y, centerY);
+		SIMDFloat4 iDisp = SIMDAdd(SIMDMul(dispX, iBasisX), SIMDMul(dispY, iBasisY));
+		SIMDFloat4 jDisp = SIMDAdd(SIMDMul(dispX, jBasisX), SIMDMul(dispY, iBasisX));
+
+		SIMDMask4 inside = SIMDMaskAnd(SIMDCmpLt(iDisp, halfWidth), SIMDCmpGt(iDisp, negHalfWidth));
+		inside = SIMDMaskAnd(inside, SIMDMaskAnd(SIMDCmpLt(jDisp, halfHeight), SIMDCmpGt(jDisp, negHalfHeight)));
+
+		SIMDFloat4 nearestI = ClampLanes(iDisp, negHalfWidth, halfWidth);
+		SIMDFloat4 nearestJ = ClampLanes(jDisp, negHalfHeight, halfHeight);
+		SIMDFloat4 nearestX = SIMDAdd(SIMDAdd(centerX, SIMDMul(iBasisX, nearestI)), SIMDMul(jBasisX, nearestJ));
+		SIMDFloat4 nearestY = SIMDAdd(SIMDAdd(centerY, SIMDMul(iBasisY, nearestI)), SIMDMul(iBasisX, nearestJ));
+		StoreLanes(out_xs, index, count, SIMDSelect(inside, x, nearestX));
+		StoreLanes(out_ys, index, count, SIMDSelect(inside, y, nearestY));
+	}
+}
+
+void GetNearestPointsOnCapsule2DBatch(int count, float const* xs, float const* ys, Vec2 const& boneStart, Vec2 const& boneEnd, float radius, float* out_xs, float* out_ys)
+{
+	BoneLanes bone = SplatBone(boneStart, boneEnd);
+	SIMDFloat4 radiusLanes = SIMDSplat(radius);
+	SIMDFloat4 radiusSquared = SIMDSplat(radius * radius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 x = LoadLanes(xs, index, count);
+		SIMDFloat4 y = LoadLanes(ys, index, count);
+		SIMDFloat4 boneX;
+		SIMDFloat4 boneY;
+		GetNearestLanesOnBone(bone, x, y, boneX, boneY);
+
+		SIMDFloat4 dispX = SIMDSub(x, boneX);
+		SIMDFloat4 dispY = SIMDSub(y, boneY);
+		SIMDMask4 inside = SIMDCmpLt(SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY)), radiusSquared);
+		ClampLengthLanes2D(dispX, dispY, radiusLanes);
+		StoreLanes(out_xs, index, count, SIMDSelect(inside, x, SIMDAdd(boneX, dispX)));
+		StoreLanes(out_ys, index, count, SIMDSelect(inside, y, SIMDAdd(boneY, dispY)));
+	}
+}
+
+void GetNearestPointsOnSphere3DBatch(int count, float const* xs, float const* ys, float const* zs, Vec3 const& sphereCenter, float sphereRadius, float* out_xs, float* out_ys, float* out_zs)
+{
+	SIMDFloat4 centerX = SIMDSplat(sphereCenter.x);
+	SIMDFloat4 centerY = SIMDSplat(sphereCenter.y);
+	SIMDFloat4 centerZ = SIMDSplat(sphereCenter.z);
+	SIMDFloat4 radius = SIMDSplat(sphereRadius);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		SIMDFloat4 dispX = SIMDSub(LoadLanes(xs, index, count), centerX);
+		SIMDFloat4 dispY = SIMDSub(LoadLanes(ys, index, count), centerY);
+		SIMDFloat4 dispZ = SIMDSub(LoadLanes(zs, index, count), centerZ);
+		ClampLengthLanes3D(dispX, dispY, dispZ, radius);
+		StoreLanes(out_xs, index, count, SIMDAdd(centerX, dispX));
+		StoreLanes(out_ys, index, count, SIMDAdd(centerY, dispY));
+		StoreLanes(out_zs, index, count, SIMDAdd(centerZ, dispZ));
+	}
+}
+
+void GetNearestPointsOnAABB3DBatch(int count, float const* xs, float const* ys, float const* zs, AABB3 const& box, float* out_xs, float* out_ys, float* out_zs)
+{
+	SIMDFloat4 minX = SIMDSplat(box.m_mins.x);
+	SIMDFloat4 minY = SIMDSplat(box.m_mins.y);
+	SIMDFloat4 minZ = SIMDSplat(box.m_mins.z);
+	SIMDFloat4 maxX = SIMDSplat(box.m_maxs.x);
+	SIMDFloat4 maxY = SIMDSplat(box.m_maxs.y);
+	SIMDFloat4 maxZ = SIMDSplat(box.m_maxs.z);
+
+	for (int index = 0; index < count; index += 4)
+	{
+		StoreLanes(out_xs, index, count, ClampLanes(LoadLanes(xs, index, count), minX, maxX));
+		StoreLanes(out_ys, index, count, ClampLanes(LoadLanes(ys, index, count), minY, maxY));
+		StoreLanes(out_zs, index, count, ClampLanes(LoadLanes(zs, index, count), minZ, maxZ));
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+int GetSetBitIndexes(int count, unsigned int const* bits, int* out_indexes)
+{
+	int numSet = 0;
+	for (int index = 0; index < count; ++index)
+	{
+		out_indexes[numSet] = index;
+		numSet += (bits[index >> 5] >> (index & 31)) & 1;
+	}
+	return numSet;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+struct OBB2;
+struct AABB3;
+struct OBB3;
+
+//-----------------------------------------------------------------------------------------------
+// batch versions of the MathUtils point-in-shape, overlap and nearest point queries for vision cones, pickups and
+//	area of effect checks over thousands of entities
+//	inputs are structure-of-arrays (separate x, y, z arrays) so four entities load into one SIMD register
+//	result bits: entity i is bit (i % 32) of out_bits[i / 32], so the array needs (count + 31) / 32 words
+//	answers match the single query functions bit for bit, except the sector test (see below)
+//	nearest point outputs may not alias the inputs
+//
+
+//one shape vs many points
+void	ComputePointsInsideDisc2DBits(int count, float const* xs, float const* ys, Vec2 const& discCenter, float discRadius, unsigned int* out_bits);
+void	ComputePointsInsideOBB2DBits(int count, float const* xs, float const* ys, OBB2 const& orientedBox, unsigned int* out_bits);
+void	ComputePointsInsideCapsule2DBits(int count, float const* xs, float const* ys, Vec2 const& boneStart, Vec2 const& boneEnd, float radius, unsigned int* out_bits);
+//compares cosines instead of taking acos per point, so points within rounding of the sector edges can differ from IsPointInsideOrientedSector2D
+//	a point exactly on the tip gives the same answer as the single function: inside only when the aperture is 180 degrees or more
+void	ComputePointsInsideOrientedSector2DBits(int count, float const* xs, float const* ys, Vec2 const& sectorTip, float sectorForwardDegrees, float sectorApertureDegrees, float sectorRadius, unsigned int* out_bits);
+
+void	ComputePointsInsideSphere3DBits(int count, float const* xs, float const* ys, float const* zs, Vec3 const& sphereCenter, float sphereRadius, unsigned int* out_bits);
+void	ComputePointsInsideAABB3DBits(int count, float const* xs, float const* ys, float const* zs, AABB3 const& box, unsigned int* out_bits);
+void	ComputePointsInsideOBB3DBits(int count, float const* xs, float const* ys, float const* zs, OBB3 const& orientedBox, unsigned int* out_bits);
+
+//many shapes vs one point or shape
+void	ComputeDiscsContainingPoint2DBits(int count, float const* centerXs, float const* centerYs, float const* radii, Vec2 const& point, unsigned int* out_bits);
+void	ComputeDiscsOverlappingDisc2DBits(int count, float const* centerXs, float const* centerYs, float const* radii, Vec2 const& discCenter, float discRadius, unsigned int* out_bits);
+void	ComputeSpheresContainingPoint3DBits(int count, float const* centerXs, float const* centerYs, float const* centerZs, float const* radii, Vec3 const& point, unsigned int* out_bits);
+void	ComputeSpheresOverlappingSphere3DBits(int count, float const* centerXs, float const* centerYs, float const* centerZs, float const* radii, Vec3 const& sphereCenter, float sphereRadius, unsigned int* out_bits);
+
+//nearest point on one shape for many reference points
+void	GetNearestPointsOnDisc2DBatch(int count, float const* xs, float const* ys, Vec2 const& discCenter, float discRadius, float* out_xs, float* out_ys);
+void	GetNearestPointsOnOBB2DBatch(int count, float const* xs, float const* ys, OBB2 const& orientedBox, float* out_xs, float* out_ys);
+void	GetNearestPointsOnCapsule2DBatch(int count, float const* xs, float const* ys, Vec2 const& boneStart, Vec2 const& boneEnd, float radius, float* out_xs, float* out_ys);
+void	GetNearestPointsOnSphere3DBatch(int count, float const* xs, float const* ys, float const* zs, Vec3 const& sphereCenter, float sphereRadius, float* out_xs, float* out_ys, float* out_zs);
+void	GetNearestPointsOnAABB3DBatch(int count, float const* xs, float const* ys, float const* zs, AABB3 const& box, float* out_xs, float* out_ys, float* out_zs);
+
+//turns result bits into an ascending index list, out_indexes needs room for count indexes; returns how many were written
+int		GetSetBitIndexes(int count, unsigned int const* bits, int* out_indexes);
@@ -10,7 +10,6 @@ public:
 
 public:
 	Capsule2(){}
-	~Capsule2() {}
 	explicit Capsule2(Vec2 const& start, Vec2 const& end, float const& radius);
 	explicit Capsule2(LineSegment2 const& bone, float const& radius);
 
@@ -8,7 +8,6 @@ public:
 
 public:
 	Disc2() {}
-	~Disc2() {}
 	explicit Disc2(Vec2 const& center, float const& radius);
 
 	//Accessors
@@ -0,0 +1,649 @@
+#include "Engine/Math/DynamicAABBTree2D.hpp"
+#include "Engine/Math/OBB2.hpp"
+#include "Engine/Math/Capsule2.hpp"
+#include "Engine/Math/Triangle2.hpp"
+#include "Engine/Math/LineSegment2.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <algorithm>
+#include <queue>
+#include <math.h>
+
+//-----------------------------------------------------------------------------------------------
+static AABB2 const GetUnion(AABB2 const& a, AABB2 const& b)
+{
+	return AABB2(a.m_mins.x < b.m_mins.x ? a.m_mins.x : b.m_mins.x, a.m_mins.y < b.m_mins.y ? a.m_mins.y : b.m_mins.y,
+				 a.m_maxs.x > b.m_maxs.x ? a.m_maxs.x : b.m_maxs.x, a.m_maxs.y > b.m_maxs.y ? a.m_maxs.y : b.m_maxs.y);
+}
+
+static float GetPerimeter(AABB2 const& box)
+{
+	return 2.f * ((box.m_maxs.x - box.m_mins.x) + (box.m_maxs.y - box.m_mins.y));
+}
+
+static bool DoesContain(AABB2 const& outer, AABB2 const& inner)
+{
+	return outer.m_mins.x <= inner.m_mins.x && outer.m_mins.y <= inner.m_mins.y && outer.m_maxs.x >= inner.m_maxs.x && outer.m_maxs.y >= inner.m_maxs.y;
+}
+
+static bool DoBoundsOverlap(AABB2 const& a, AABB2 const& b)
+{
+	return a.m_mins.x <= b.m_maxs.x && a.m_maxs.x >= b.m_mins.x && a.m_mins.y <= b.m_maxs.y && a.m_maxs.y >= b.m_mins.y;
+}
+
+static float GetDistanceSquaredToBounds(Vec2 const& point, AABB2 const& box)
+{
+	float dx = point.x < box.m_mins.x ? box.m_mins.x - point.x : (point.x > box.m_maxs.x ? point.x - box.m_maxs.x : 0.f);
+	float dy = point.y < box.m_mins.y ? box.m_mins.y - point.y : (point.y > box.m_maxs.y ? point.y - box.m_maxs.y : 0.f);
+	return (dx * dx) + (dy * dy);
+}
+
+//slab test against the ray segment [0, maxDist]
+static bool DoesRaySegmentOverlapBounds(Vec2 const& start, Vec2 const& fwrdNormal, float maxDist, AABB2 const& box)
+{
+	float tMin = 0.f;
+	float tMax = maxDist;
+	float const starts[2] = { start.x, start.y };
+	float const directions[2] = { fwrdNormal.x, fwrdNormal.y };
+	float const mins[2] = { box.m_mins.x, box.m_mins.y };
+	float const maxs[2] = { box.m_maxs.x, box.m_maxs.y };
+	for (int axis = 0; axis < 2; ++axis)
+	{
+		if (fabsf(directions[axis]) < 1e-12f)
+		{
+			if (starts[axis] < mins[axis] || starts[axis] > maxs[axis])
+			{
+				return false;
+			}
+			continue;
+		}
+
+		float invDirection = 1.f / directions[axis];
+		float tNear = (mins[axis] - starts[axis]) * invDirection;
+		float tFar = (maxs[axis] - starts[axis]) * invDirection;
+		if (tNear > tFar)
+		{
+			std::swap(tNear, tFar);
+		}
+		tMin = tNear > tMin ? tNear : tMin;
+		tMax = tFar < tMax ? tFar : tMax;
+		if (tMin > tMax)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------------------------
+DynamicAABBTree2D::DynamicAABBTree2D(DynamicAABBTree2DConfig const& config)
+	:m_config(config)
+{
+}
+
+int DynamicAABBTree2D::CreateProxy(AABB2 const& tightBounds, void* userData)
+{
+	int proxyId = AllocateNode();
+	Node& node = m_nodes[proxyId];
+	node.m_bounds = AABB2(tightBounds.m_mins - Vec2(m_config.m_fatMargin, m_config.m_fatMargin), tightBounds.m_maxs + Vec2(m_config.m_fatMargin, m_config.m_fatMargin));
+	node.m_userData = userData;
+	node.m_height = 0;
+	node.m_wasMoved = true;
+	m_movedProxies.push_back(proxyId);
+
+	InsertLeaf(proxyId);
+	++m_numProxies;
+	return proxyId;
+}
+
+void DynamicAABBTree2D::DestroyProxy(int proxyId)
+{
+	GUARANTEE_OR_DIE(proxyId >= 0 && proxyId < (int)m_nodes.size() && m_nodes[proxyId].m_height == 0, "DynamicAABBTree2D::DestroyProxy called with an invalid proxy id");
+	RemoveLeaf(proxyId);
+	FreeNode(proxyId);
+	--m_numProxies;
+}
+
+bool DynamicAABBTree2D::MoveProxy(int proxyId, AABB2 const& tightBounds, Vec2 const& displacement)
+{
+	GUARANTEE_OR_DIE(proxyId >= 0 && proxyId < (int)m_nodes.size() && m_nodes[proxyId].m_height == 0, "DynamicAABBTree2D::MoveProxy called with an invalid proxy id");
+	if (DoesContain(m_nodes[proxyId].m_bounds, tightBounds))
+	{
+		return false;
+	}
+
+	RemoveLeaf(proxyId);
+
+	AABB2 fatBounds(tightBounds.m_mins - Vec2(m_config.m_fatMargin, m_config.m_fatMargin), tightBounds.m_maxs + Vec2(m_config.m_fatMargin, m_config.m_fatMargin));
+	Vec2 predictedDisplacement = displacement * m_config.m_displacementMultiplier;
+	if (predictedDisplacement.x < 0.f)	fatBounds.m_mins.x += predictedDisplacement.x;
+	else								fatBounds.m_maxs.x += predictedDisplacement.x;
+	if (predictedDisplacement.y < 0.f)	fatBounds.m_mins.y += predictedDisplacement.y;
+	else								fatBounds.m_maxs.y += predictedDisplacement.y;
+	m_nodes[proxyId].m_bounds = fatBounds;
+
+	InsertLeaf(proxyId);
+	if (!m_nodes[proxyId].m_wasMoved)
+	{
+		m_nodes[proxyId].m_wasMoved = true;
+		m_movedProxies.push_back(proxyId);
+	}
+	return true;
+}
+
+void DynamicAABBTree2D::Clear()
+{
+	m_nodes.clear();
+	m_movedProxies.clear();
+	m_rootIndex = -1;
+	m_freeListIndex = -1;
+	m_numProxies = 0;
+}
+
+void* DynamicAABBTree2D::GetUserData(int proxyId) const
+{
+	return m_nodes[proxyId].m_userData;
+}
+
+AABB2 const& DynamicAABBTree2D::GetFatBounds(int proxyId) const
+{
+	return m_nodes[proxyId].m_bounds;
+}
+
+int DynamicAABBTree2D::GetHeight() const
+{
+	return m_rootIndex < 0 ? 0 : m_nodes[m_rootIndex].m_height;
+}
+
+//Queries
+//-----------------------------------------------------------------------------------------------
+void DynamicAABBTree2D::QueryOverlaps(AABB2 const& bounds, std::vector<int>& out_proxyIds) const
+{
+	if (m_rootIndex < 0)
+	{
+		return;
+	}
+
+	std::vector<int> stack;
+	stack.reserve(64);
+	stack.push_back(m_rootIndex);
+	while (!stack.empty())
+	{
+		int nodeIndex = stack.back();
+		stack.pop_back();
+		Node const& node = m_nodes[nodeIndex];
+		if (!DoBoundsOverlap(node.m_bounds, bounds))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			out_proxyIds.push_back(nodeIndex);
+		}
+		else
+		{
+			stack.push_back(node.m_child1);
+			stack.push_back(node.m_child2);
+		}
+	}
+}
+
+void DynamicAABBTree2D::QueryOverlaps(Vec2 const& discCenter, float discRadius, std::vector<int>& out_proxyIds) const
+{
+	if (m_rootIndex < 0)
+	{
+		return;
+	}
+
+	float radiusSquared = discRadius * discRadius;
+	std::vector<int> stack;
+	stack.reserve(64);
+	stack.push_back(m_rootIndex);
+	while (!stack.empty())
+	{
+		int nodeIndex = stack.back();
+		stack.pop_back();
+		Node const& node = m_nodes[nodeIndex];
+		if (GetDistanceSquaredToBounds(discCenter, node.m_bounds) > radiusSquared)
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			out_proxyIds.push_back(nodeIndex);
+		}
+		else
+		{
+			stack.push_back(node.m_child1);
+			stack.push_back(node.m_child2);
+		}
+	}
+}
+
+TreeRaycastHit2D DynamicAABBTree2D::Raycast(Ray2 const& ray, TreeRaycastProxyFunction const& rayVsProxy) const
+{
+	TreeRaycastHit2D nearestHit;
+	if (m_rootIndex < 0)
+	{
+		return nearestHit;
+	}
+
+	//every hit shortens the search segment so farther subtrees get culled
+	float searchLength = ray.m_maxLength;
+	std::vector<int> stack;
+	stack.reserve(64);
+	stack.push_back(m_rootIndex);
+	while (!stack.empty())
+	{
+		int nodeIndex = stack.back();
+		stack.pop_back();
+		Node const& node = m_nodes[nodeIndex];
+		if (!DoesRaySegmentOverlapBounds(ray.m_startPos, ray.m_fwrdNormal, searchLength, node.m_bounds))
+		{
+			continue;
+		}
+
+		if (!node.IsLeaf())
+		{
+			stack.push_back(node.m_child1);
+			stack.push_back(node.m_child2);
+			continue;
+		}
+
+		RaycastResult2D result = rayVsProxy ? rayVsProxy(nodeIndex, ray) : RaycastVsAABB2D(ray, node.m_bounds);
+		if (result.m_didImpact && (nearestHit.m_proxyId < 0 || result.m_impactDistance < nearestHit.m_result.m_impactDistance))
+		{
+			nearestHit.m_proxyId = nodeIndex;
+			nearestHit.m_result = result;
+			searchLength = result.m_impactDistance;
+		}
+	}
+	return nearestHit;
+}
+
+int DynamicAABBTree2D::FindNearestProxy(Vec2 const& referencePos, float maxDistance, TreeDistanceProxyFunction const& distanceToProxy) const
+{
+	if (m_rootIndex < 0)
+	{
+		return -1;
+	}
+
+	//best first: always expand the node whose bounds are closest
+	typedef std::pair<float, int> DistanceSquaredAndNode;
+	std::priority_queue<DistanceSquaredAndNode, std::vector<DistanceSquaredAndNode>, std::greater<DistanceSquaredAndNode>> openNodes;
+	openNodes.push(DistanceSquaredAndNode(GetDistanceSquaredToBounds(referencePos, m_nodes[m_rootIndex].m_bounds), m_rootIndex));
+
+	int nearestProxy = -1;
+	float nearestDistance = maxDistance;
+	while (!openNodes.empty())
+	{
+		DistanceSquaredAndNode top = openNodes.top();
+		openNodes.pop();
+		if (top.first > nearestDistance * nearestDistance)
+		{
+			break;
+		}
+
+		Node const& node = m_nodes[top.second];
+		if (node.IsLeaf())
+		{
+			float distance = distanceToProxy ? distanceToProxy(top.second, referencePos) : sqrtf(top.first);
+			if (distance <= nearestDistance)
+			{
+				nearestDistance = distance;
+				nearestProxy = top.second;
+			}
+			continue;
+		}
+
+		openNodes.push(DistanceSquaredAndNode(GetDistanceSquaredToBounds(referencePos, m_nodes[node.m_child1].m_bounds), node.m_child1));
+		openNodes.push(DistanceSquaredAndNode(GetDistanceSquaredToBounds(referencePos, m_nodes[node.m_child2].m_bounds), node.m_child2));
+	}
+	return nearestProxy;
+}
+
+void DynamicAABBTree2D::GetAllOverlappingPairs(std::vector<std::pair<int, int>>& out_pairs) const
+{
+	std::vector<int> overlaps;
+	for (int nodeIndex = 0; nodeIndex < (int)m_nodes.size(); ++nodeIndex)
+	{
+		if (m_nodes[nodeIndex].m_height != 0)
+		{
+			continue;
+		}
+
+		overlaps.clear();
+		QueryOverlaps(m_nodes[nodeIndex].m_bounds, overlaps);
+		for (int otherIndex : overlaps)
+		{
+			if (otherIndex > nodeIndex)
+			{
+				out_pairs.push_back(std::pair<int, int>(nodeIndex, otherIndex));
+			}
+		}
+	}
+}
+
+void DynamicAABBTree2D::GetNewOverlappingPairs(std::vector<std::pair<int, int>>& out_pairs)
+{
+	//a proxy can be destroyed and its id reused between calls, so dedupe and skip anything no longer moved
+	std::sort(m_movedProxies.begin(), m_movedProxies.end());
+	m_movedProxies.erase(std::unique(m_movedProxies.begin(), m_movedProxies.end()), m_movedProxies.end());
+
+	std::vector<int> overlaps;
+	for (int proxyId : m_movedProxies)
+	{
+		Node const& node = m_nodes[proxyId];
+		if (node.m_height != 0 || !node.m_wasMoved)
+		{
+			continue;
+		}
+
+		overlaps.clear();
+		QueryOverlaps(node.m_bounds, overlaps);
+		for (int otherId : overlaps)
+		{
+			//pairs of two moved proxies are reported once, from the lower id
+			if (otherId == proxyId || (m_nodes[otherId].m_wasMoved && otherId < proxyId))
+			{
+				continue;
+			}
+			out_pairs.push_back(otherId < proxyId ? std::pair<int, int>(otherId, proxyId) : std::pair<int, int>(proxyId, otherId));
+		}
+	}
+
+	for (int proxyId : m_movedProxies)
+	{
+		m_nodes[proxyId].m_wasMoved = false;
+	}
+	m_movedProxies.clear();
+}
+
+//Tree maintenance
+//-----------------------------------------------------------------------------------------------
+int DynamicAABBTree2D::AllocateNode()
+{
+	if (m_freeListIndex < 0)
+	{
+		m_nodes.push_back(Node());
+		return (int)m_nodes.size() - 1;
+	}
+
+	int nodeIndex = m_freeListIndex;
+	m_freeListIndex = m_nodes[nodeIndex].m_parent;
+	m_nodes[nodeIndex] = Node();
+	return nodeIndex;
+}
+
+void DynamicAABBTree2D::FreeNode(int nodeIndex)
+{
+	Node& node = m_nodes[nodeIndex];
+	node.m_parent = m_freeListIndex;
+	node.m_child1 = -1;
+	node.m_child2 = -1;
+	node.m_height = -1;
+	node.m_userData = nullptr;
+	node.m_wasMoved = false;
+	m_freeListIndex = nodeIndex;
+}
+
+void DynamicAABBTree2D::InsertLeaf(int leafIndex)
+{
+	if (m_rootIndex < 0)
+	{
+		m_rootIndex = leafIndex;
+		m_nodes[leafIndex].m_parent = -1;
+		return;
+	}
+
+	//walk down picking the child with the lowest perimeter cost (surface area heuristic)
+	AABB2 leafBounds = m_nodes[leafIndex].m_bounds;
+	int siblingIndex = m_rootIndex;
+	while (!m_nodes[siblingIndex].IsLeaf())
+	{
+		Node const& node = m_nodes[siblingIndex];
+		float perimeter = GetPerimeter(node.m_bounds);
+		float combinedPerimeter = GetPerimeter(GetUnion(node.m_bounds, leafBounds));
+		float costHere = 2.f * combinedPerimeter;
+		float inheritanceCost = 2.f * (combinedPerimeter - perimeter);
+
+		Node const& child1 = m_nodes[node.m_child1];
+		float cost1 = GetPerimeter(GetUnion(leafBounds, child1.m_bounds)) + inheritanceCost;
+		if (!child1.IsLeaf())
+		{
+			cost1 -= GetPerimeter(child1.m_bounds);
+		}
+
+		Node const& child2 = m_nodes[node.m_child2];
+		float cost2 = GetPerimeter(GetUnion(leafBounds, child2.m_bounds)) + inheritanceCost;
+		if (!child2.IsLeaf())
+		{
+			cost2 -= GetPerimeter(child2.m_bounds);
+		}
+
+		if (costHere < cost1 && costHere < cost2)
+		{
+			break;
+		}
+		siblingIndex = cost1 < cost2 ? node.m_child1 : node.m_child2;
+	}
+
+	int oldParentIndex = m_nodes[siblingIndex].m_parent;
+	int newParentIndex = AllocateNode(); //may grow m_nodes, so no references are held across this
+	Node& newParent = m_nodes[newParentIndex];
+	newParent.m_parent = oldParentIndex;
+	newParent.m_bounds = GetUnion(leafBounds, m_nodes[siblingIndex].m_bounds);
+	newParent.m_height = m_nodes[siblingIndex].m_height + 1;
+	newParent.m_child1 = siblingIndex;
+	newParent.m_child2 = leafIndex;
+
+	if (oldParentIndex >= 0)
+	{
+		Node& oldParent = m_nodes[oldParentIndex];
+		if (oldParent.m_child1 == siblingIndex)	oldParent.m_child1 = newParentIndex;
+		else									oldParent.m_child2 = newParentIndex;
+	}
+	else
+	{
+		m_rootIndex = newParentIndex;
+	}
+	m_nodes[siblingIndex].m_parent = newParentIndex;
+	m_nodes[leafIndex].m_parent = newParentIndex;
+
+	RefitAncestors(newParentIndex);
+}
+
+void DynamicAABBTree2D::RemoveLeaf(int leafIndex)
+{
+	if (leafIndex == m_rootIndex)
+	{
+		m_rootIndex = -1;
+		return;
+	}
+
+	int parentIndex = m_nodes[leafIndex].m_parent;
+	int grandParentIndex = m_nodes[parentIndex].m_parent;
+	int siblingIndex = m_nodes[parentIndex].m_child1 == leafIndex ? m_nodes[parentIndex].m_child2 : m_nodes[parentIndex].m_child1;
+
+	if (grandParentIndex >= 0)
+	{
+		Node& grandParent = m_nodes[grandParentIndex];
+		if (grandParent.m_child1 == parentIndex)	grandParent.m_child1 = siblingIndex;
+		else										grandParent.m_child2 = siblingIndex;
+		m_nodes[siblingIndex].m_parent = grandParentIndex;
+		FreeNode(parentIndex);
+		RefitAncestors(grandParentIndex);
+	}
+	else
+	{
+		m_rootIndex = siblingIndex;
+		m_nodes[siblingIndex].m_parent = -1;
+		FreeNode(parentIndex);
+	}
+}
+
+void DynamicAABBTree2D::RefitAncestors(int nodeIndex)
+{
+	while (nodeIndex >= 0)
+	{
+		nodeIndex = Balance(nodeIndex);
+		Node& node = m_nodes[nodeIndex];
+		Node const& child1 = m_nodes[node.m_child1];
+		Node const& child2 = m_nodes[node.m_child2];
+		node.m_height = 1 + (child1.m_height > child2.m_height ? child1.m_height : child2.m_height);
+		node.m_bounds = GetUnion(child1.m_bounds, child2.m_bounds);
+		nodeIndex = node.m_parent;
+	}
+}
+
+//rotates the taller grandchild up when the two subtrees of nodeIndex differ in height by more than 1, returns the new subtree root
+int DynamicAABBTree2D::Balance(int indexA)
+{
+	Node& a = m_nodes[indexA];
+	if (a.IsLeaf() || a.m_height < 2)
+	{
+		return indexA;
+	}
+
+	int indexB = a.m_child1;
+	int indexC = a.m_child2;
+	Node& b = m_nodes[indexB];
+	Node& c = m_nodes[indexC];
+	int balance = c.m_height - b.m_height;
+
+	//rotate C up
+	if (balance > 1)
+	{
+		int indexF = c.m_child1;
+		int indexG = c.m_child2;
+		Node& f = m_nodes[indexF];
+		Node& g = m_nodes[indexG];
+
+		c.m_child1 = indexA;
+		c.m_parent = a.m_parent;
+		a.m_parent = indexC;
+		if (c.m_parent >= 0)
+		{
+			Node& cParent = m_nodes[c.m_parent];
+			if (cParent.m_child1 == indexA)	cParent.m_child1 = indexC;
+			else							cParent.m_child2 = indexC;
+		}
+		else
+		{
+			m_rootIndex = indexC;
+		}
+
+		if (f.m_height > g.m_height)
+		{
+			c.m_child2 = indexF;
+			a.m_child2 = indexG;
+			g.m_parent = indexA;
+			a.m_bounds = GetUnion(b.m_bounds, g.m_bounds);
+			c.m_bounds = GetUnion(a.m_bounds, f.m_bounds);
+			a.m_height = 1 + (b.m_height > g.m_height ? b.m_height : g.m_height);
+			c.m_height = 1 + (a.m_height > f.m_height ? a.m_height : f.m_height);
+		}
+		else
+		{
+			c.m_child2 = indexG;
+			a.m_child2 = indexF;
+			f.m_parent = indexA;
+			a.m_bounds = GetUnion(b.m_bounds, f.m_bounds);
+			c.m_bounds = GetUnion(a.m_bounds, g.m_bounds);
+			a.m_height = 1 + (b.m_height > f.m_height ? b.m_height : f.m_height);
+			c.m_height = 1 + (a.m_height > g.m_height ? a.m_height : g.m_height);
+		}
+		return indexC;
+	}
+
+	//rotate B up
+	if (balance < -1)
+	{
+		int indexD = b.m_child1;
+		int indexE = b.m_child2;
+		Node& d = m_nodes[indexD];
+		Node& e = m_nodes[indexE];
+
+		b.m_child1 = indexA;
+		b.m_parent = a.m_parent;
+		a.m_parent = indexB;
+		if (b.m_parent >= 0)
+		{
+			Node& bParent = m_nodes[b.m_parent];
+			if (bParent.m_child1 == indexA)	bParent.m_child1 = indexB;
+			else							bParent.m_child2 = indexB;
+		}
+		else
+		{
+			m_rootIndex = indexB;
+		}
+
+		if (d.m_height > e.m_height)
+		{
+			b.m_child2 = indexD;
+			a.m_child1 = indexE;
+			e.m_parent = indexA;
+			a.m_bounds = GetUnion(c.m_bounds, e.m_bounds);
+			b.m_bounds = GetUnion(a.m_bounds, d.m_bounds);
+			a.m_height = 1 + (c.m_height > e.m_height ? c.m_height : e.m_height);
+			b.m_height = 1 + (a.m_height > d.m_height ? a.m_height : d.m_height);
+		}
+		else
+		{
+			b.m_child2 = indexE;
+			a.m_child1 = indexD;
+			d.m_parent = indexA;
+			a.m_bounds = GetUnion(c.m_bounds, d.m_bounds);
+			b.m_bounds = GetUnion(a.m_bounds, e.m_bounds);
+			a.m_height = 1 + (c.m_height > d.m_height ? c.m_height : d.m_height);
+			b.m_height = 1 + (a.m_height > e.m_height ? a.m_height : e.m_height);
+		}
+		return indexB;
+	}
+
+	return indexA;
+}
+
+//Bounds helpers
+//-----------------------------------------------------------------------------------------------
+AABB2 const GetBoundsForDisc2D(Vec2 const& center, float radius)
+{
+	return AABB2(center - Vec2(radius, radius), center + Vec2(radius, radius));
+}
+
+AABB2 const GetBoundsForOBB2D(OBB2 const& orientedBox)
+{
+	Vec2 corners[4];
+	orientedBox.GetCornerPoints(corners);
+	AABB2 bounds(corners[0], corners[0]);
+	for (int cornerIndex = 1; cornerIndex < 4; ++cornerIndex)
+	{
+		bounds.StretchToIncludePoint(corners[cornerIndex]);
+	}
+	return bounds;
+}
+
+AABB2 const GetBoundsForCapsule2D(Capsule2 const& capsule)
+{
+	AABB2 bounds(capsule.m_start, capsule.m_start);
+	bounds.StretchToIncludePoint(capsule.m_end);
+	bounds.m_mins -= Vec2(capsule.m_radius, capsule.m_radius);
+	bounds.m_maxs += Vec2(capsule.m_radius, capsule.m_radius);
+	return bounds;
+}
+
+AABB2 const GetBoundsForTriangle2D(Triangle2 const& triangle)
+{
+	AABB2 bounds(triangle.m_pointsCounterClockwise[0], triangle.m_pointsCounterClockwise[0]);
+	bounds.StretchToIncludePoint(triangle.m_pointsCounterClockwise[1]);
+	bounds.StretchToIncludePoint(triangle.m_pointsCounterClockwise[2]);
+	return bounds;
+}
+
+AABB2 const GetBoundsForLineSegment2D(LineSegment2 const& lineSegment)
+{
+	AABB2 bounds(lineSegment.m_start, lineSegment.m_start);
+	bounds.StretchToIncludePoint(lineSegment.m_end);
+	return bounds;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <functional>
+#include <utility>
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------
+// incrementally updated bounding volume tree over 2D AABBs, meant as a broadphase for thousands of moving objects
+//	leaves store fattened bounds so small moves do not touch the tree; internal nodes are kept balanced with rotations
+//	proxy ids stay valid until DestroyProxy
+//
+typedef std::function<RaycastResult2D(int proxyId, Ray2 const& ray)> TreeRaycastProxyFunction;		//exact shape test for one proxy
+typedef std::function<float(int proxyId, Vec2 const& referencePos)> TreeDistanceProxyFunction;			//exact distance to one proxy
+
+struct DynamicAABBTree2DConfig
+{
+	float m_fatMargin = 0.5f;					//added on every side of the tight bounds
+	float m_displacementMultiplier = 2.f;		//moving proxies also get their bounds stretched along displacement * this
+};
+
+struct TreeRaycastHit2D
+{
+	int				m_proxyId = -1;
+	RaycastResult2D m_result;
+};
+
+class DynamicAABBTree2D
+{
+public:
+	explicit DynamicAABBTree2D(DynamicAABBTree2DConfig const& config = DynamicAABBTree2DConfig());
+
+	int		CreateProxy(AABB2 const& tightBounds, void* userData);
+	void	DestroyProxy(int proxyId);
+	bool	MoveProxy(int proxyId, AABB2 const& tightBounds, Vec2 const& displacement = Vec2(0.f, 0.f)); //returns true if the proxy was reinserted
+	void	Clear();
+
+	void*			GetUserData(int proxyId) const;
+	AABB2 const&	GetFatBounds(int proxyId) const;
+	int				GetNumProxies() const { return m_numProxies; }
+	int				GetHeight() const;
+
+	//queries test fat bounds; pass a proxy function to refine against the real shape
+	void				QueryOverlaps(AABB2 const& bounds, std::vector<int>& out_proxyIds) const;
+	void				QueryOverlaps(Vec2 const& discCenter, float discRadius, std::vector<int>& out_proxyIds) const;
+	TreeRaycastHit2D	Raycast(Ray2 const& ray, TreeRaycastProxyFunction const& rayVsProxy = nullptr) const; //nearest hit
+	int					FindNearestProxy(Vec2 const& referencePos, float maxDistance, TreeDistanceProxyFunction const& distanceToProxy = nullptr) const;
+
+	//pairs whose fat bounds overlap, each pair once with first < second
+	void	GetAllOverlappingPairs(std::vector<std::pair<int, int>>& out_pairs) const;
+	void	GetNewOverlappingPairs(std::vector<std::pair<int, int>>& out_pairs); //only pairs that involve a proxy created or reinserted since the last call
+
+private:
+	struct Node
+	{
+		AABB2	m_bounds;
+		void*	m_userData = nullptr;
+		int		m_parent = -1;			//next free node while on the free list
+		int		m_child1 = -1;
+		int		m_child2 = -1;
+		int		m_height = -1;			//0 for leaves, -1 while free
+		bool	m_wasMoved = false;
+
+		bool IsLeaf() const { return m_child1 < 0; }
+	};
+
+	int		AllocateNode();
+	void	FreeNode(int nodeIndex);
+	void	InsertLeaf(int leafIndex);
+	void	RemoveLeaf(int leafIndex);
+	int		Balance(int nodeIndex);
+	void	RefitAncestors(int nodeIndex);
+
+private:
+	DynamicAABBTree2DConfig m_config;
+	std::vector<Node>	m_nodes;
+	std::vector<int>	m_movedProxies;
+	int					m_rootIndex = -1;
+	int					m_freeListIndex = -1;
+	int					m_numProxies = 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+// tight bounds for the engine's 2D primitives
+AABB2 const GetBoundsForDisc2D(Vec2 const& center, float radius);
+AABB2 const GetBoundsForOBB2D(OBB2 const& orientedBox);
+AABB2 const GetBoundsForCapsule2D(Capsule2 const& capsule);
+AABB2 const GetBoundsForTriangle2D(Triangle2 const& triangle);
+AABB2 const GetBoundsForLineSegment2D(LineSegment2 const& lineSegment);
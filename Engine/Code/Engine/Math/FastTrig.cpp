@@ -0,0 +1,200 @@
+#include "Engine/Math/FastTrig.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Core/Time.hpp"
+#include <math.h>
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------
+// minimax coefficients on [-pi/4, pi/4] (cephes sinf / cosf)
+constexpr float SIN_C1 = -1.6666654611e-1f;
+constexpr float SIN_C2 = 8.3321608736e-3f;
+constexpr float SIN_C3 = -1.9515295891e-4f;
+constexpr float COS_C1 = 4.166664568298827e-2f;
+constexpr float COS_C2 = -1.388731625493765e-3f;
+constexpr float COS_C3 = 2.443315711809948e-5f;
+
+// pi/2 split in three so quadrant * part stays exact for the first two parts
+constexpr float HALF_PI_PART1 = 1.5703125f;
+constexpr float HALF_PI_PART2 = 4.837512969970703125e-4f;
+constexpr float HALF_PI_PART3 = 7.54978995489188216e-8f;
+constexpr float TWO_OVER_PI = 0.636619772367581343f;
+
+// atan on [0, 1], odd polynomial in z
+constexpr float ATAN_C0 = 0.99997726f;
+constexpr float ATAN_C1 = -0.33262347f;
+constexpr float ATAN_C2 = 0.19354346f;
+constexpr float ATAN_C3 = -0.11643287f;
+constexpr float ATAN_C4 = 0.05265332f;
+constexpr float ATAN_C5 = -0.01172120f;
+
+//-----------------------------------------------------------------------------------------------
+// r must already be in [-pi/4, pi/4]; quadrant picks which polynomial and sign lands in sin / cos
+static inline void SinCosFromReduced(float r, int quadrant, float& out_sin, float& out_cos)
+{
+	float r2 = r * r;
+	float sinR = r + (r * r2 * (SIN_C1 + (r2 * (SIN_C2 + (r2 * SIN_C3)))));
+	float cosR = 1.f - (0.5f * r2) + (r2 * r2 * (COS_C1 + (r2 * (COS_C2 + (r2 * COS_C3)))));
+
+	bool isSwapped = (quadrant & 1) != 0;
+	float sinValue = isSwapped ? cosR : sinR;
+	float cosValue = isSwapped ? sinR : cosR;
+	out_sin = ((quadrant & 2) != 0) ? -sinValue : sinValue;
+	out_cos = (((quadrant + 1) & 2) != 0) ? -cosValue : cosValue;
+}
+
+static inline float AtanZeroToOne(float z)
+{
+	float z2 = z * z;
+	return z * (ATAN_C0 + (z2 * (ATAN_C1 + (z2 * (ATAN_C2 + (z2 * (ATAN_C3 + (z2 * (ATAN_C4 + (z2 * ATAN_C5))))))))));
+}
+
+//-----------------------------------------------------------------------------------------------
+void FastSinCosRadians(float radians, float& out_sin, float& out_cos)
+{
+	float quadrantFloat = floorf((radians * TWO_OVER_PI) + 0.5f);
+	float r = radians - (quadrantFloat * HALF_PI_PART1);
+	r -= quadrantFloat * HALF_PI_PART2;
+	r -= quadrantFloat * HALF_PI_PART3;
+	SinCosFromReduced(r, (int)quadrantFloat, out_sin, out_cos);
+}
+
+void FastSinCosDegrees(float degrees, float& out_sin, float& out_cos)
+{
+	//reducing in degrees is exact (Sterbenz) so 90/180/270 land on exactly 0 and 1
+	float quadrantFloat = floorf((degrees * (1.f / 90.f)) + 0.5f);
+	float reducedDegrees = degrees - (quadrantFloat * 90.f);
+	SinCosFromReduced(reducedDegrees * (pi / 180.f), (int)quadrantFloat, out_sin, out_cos);
+}
+
+float FastSinDegrees(float degrees)
+{
+	float sinValue;
+	float cosValue;
+	FastSinCosDegrees(degrees, sinValue, cosValue);
+	return sinValue;
+}
+
+float FastCosDegrees(float degrees)
+{
+	float sinValue;
+	float cosValue;
+	FastSinCosDegrees(degrees, sinValue, cosValue);
+	return cosValue;
+}
+
+float FastAtan2Radians(float y, float x)
+{
+	float absX = fabsf(x);
+	float absY = fabsf(y);
+	float maxValue = absX > absY ? absX : absY;
+	float minValue = absX > absY ? absY : absX;
+	if (maxValue == 0.f)
+	{
+		return 0.f;
+	}
+
+	float angle = AtanZeroToOne(minValue / maxValue);
+	angle = (absY > absX) ? ((pi * 0.5f) - angle) : angle;
+	angle = (x < 0.f) ? (pi - angle) : angle;
+	return (y < 0.f) ? -angle : angle;
+}
+
+float FastAtan2Degrees(float y, float x)
+{
+	return FastAtan2Radians(y, x) * (180.f / pi);
+}
+
+//-----------------------------------------------------------------------------------------------
+void FastSinCosRadiansBatch(int count, float const* radians, float* out_sines, float* out_cosines)
+{
+	for (int index = 0; index < count; ++index)
+	{
+		FastSinCosRadians(radians[index], out_sines[index], out_cosines[index]);
+	}
+}
+
+void FastSinCosDegreesBatch(int count, float const* degrees, float* out_sines, float* out_cosines)
+{
+	for (int index = 0; index < count; ++index)
+	{
+		FastSinCosDegrees(degrees[index], out_sines[index], out_cosines[index]);
+	}
+}
+
+void FastAtan2DegreesBatch(int count, float const* ys, float const* xs, float* out_degrees)
+{
+	for (int index = 0; index < count; ++index)
+	{
+		out_degrees[index] = FastAtan2Degrees(ys[index], xs[index]);
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+FastTrigBenchmarkResults RunFastTrigBenchmark(int numSamples)
+{
+	FastTrigBenchmarkResults results;
+	if (numSamples <= 0)
+	{
+		return results;
+	}
+	results.m_numSamples = numSamples;
+
+	RandomNumberGenerator rng(1234u);
+	std::vector<float> degrees(numSamples);
+	std::vector<float> xs(numSamples);
+	std::vector<float> ys(numSamples);
+	for (int index = 0; index < numSamples; ++index)
+	{
+		degrees[index] = rng.RollRandomFloatInRange(-720.f, 720.f);
+		xs[index] = rng.RollRandomFloatInRange(-100.f, 100.f);
+		ys[index] = rng.RollRandomFloatInRange(-100.f, 100.f);
+	}
+	std::vector<float> libmSines(numSamples);
+	std::vector<float> libmCosines(numSamples);
+	std::vector<float> fastSines(numSamples);
+	std::vector<float> fastCosines(numSamples);
+	std::vector<float> libmAngles(numSamples);
+	std::vector<float> fastAngles(numSamples);
+
+	double startTime = GetCurrentTimeSeconds();
+	for (int index = 0; index < numSamples; ++index)
+	{
+		libmSines[index] = SinDegrees(degrees[index]);
+		libmCosines[index] = CosDegrees(degrees[index]);
+	}
+	results.m_libmSinCosSeconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	for (int index = 0; index < numSamples; ++index)
+	{
+		FastSinCosDegrees(degrees[index], fastSines[index], fastCosines[index]);
+	}
+	results.m_fastSinCosSeconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	FastSinCosDegreesBatch(numSamples, degrees.data(), fastSines.data(), fastCosines.data());
+	results.m_fastSinCosBatchSeconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	for (int index = 0; index < numSamples; ++index)
+	{
+		libmAngles[index] = Atan2Degrees(ys[index], xs[index]);
+	}
+	results.m_libmAtan2Seconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	FastAtan2DegreesBatch(numSamples, ys.data(), xs.data(), fastAngles.data());
+	results.m_fastAtan2Seconds = GetCurrentTimeSeconds() - startTime;
+
+	for (int index = 0; index < numSamples; ++index)
+	{
+		float sinError = fabsf(fastSines[index] - libmSines[index]);
+		float cosError = fabsf(fastCosines[index] - libmCosines[index]);
+		float atanError = fabsf(GetShortestAngularDispDegrees(libmAngles[index], fastAngles[index]));
+		results.m_maxSinCosError = sinError > results.m_maxSinCosError ? sinError : results.m_maxSinCosError;
+		results.m_maxSinCosError = cosError > results.m_maxSinCosError ? cosError : results.m_maxSinCosError;
+		results.m_maxAtan2ErrorDegrees = atanError > results.m_maxAtan2ErrorDegrees ? atanError : results.m_maxAtan2ErrorDegrees;
+	}
+	return results;
+}
@@ -0,0 +1,38 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// FastTrig.hpp
+//
+// Polynomial sin/cos/atan2 that skip libm. Measured against libm (double reference):
+//	FastSinCosRadians	max abs error ~1.0e-7 for |radians| < 8192 (accuracy drops past that, range reduction is 3-part Cody-Waite)
+//	FastSinCosDegrees	max abs error ~1.0e-7 for |degrees| < 100000, reduction is exact in degrees so multiples of 90 return exact 0/1
+//	FastAtan2Radians	max abs error ~2.0e-6 radians (~1.2e-4 degrees); returns 0 for (0,0)
+//
+// #define ENGINE_FAST_TRIG in your game's EngineBuildPreferences.hpp to route SinCosDegrees / Vec2 / Mat44 rotation helpers through these.
+//
+
+void	FastSinCosRadians(float radians, float& out_sin, float& out_cos);
+void	FastSinCosDegrees(float degrees, float& out_sin, float& out_cos);
+float	FastSinDegrees(float degrees);
+float	FastCosDegrees(float degrees);
+float	FastAtan2Radians(float y, float x);
+float	FastAtan2Degrees(float y, float x);
+
+//batch versions, branchless loops over plain arrays so the compiler can vectorize them; out arrays may not alias the inputs
+void	FastSinCosRadiansBatch(int count, float const* radians, float* out_sines, float* out_cosines);
+void	FastSinCosDegreesBatch(int count, float const* degrees, float* out_sines, float* out_cosines);
+void	FastAtan2DegreesBatch(int count, float const* ys, float const* xs, float* out_degrees);
+
+//-----------------------------------------------------------------------------------------------
+struct FastTrigBenchmarkResults
+{
+	int		m_numSamples = 0;
+	double	m_libmSinCosSeconds = 0.0;
+	double	m_fastSinCosSeconds = 0.0;
+	double	m_fastSinCosBatchSeconds = 0.0;
+	double	m_libmAtan2Seconds = 0.0;
+	double	m_fastAtan2Seconds = 0.0;
+	float	m_maxSinCosError = 0.f;
+	float	m_maxAtan2ErrorDegrees = 0.f;
+};
+
+FastTrigBenchmarkResults RunFastTrigBenchmark(int numSamples);
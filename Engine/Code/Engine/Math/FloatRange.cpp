@@ -145,10 +145,3 @@ void FloatRange::operator/=(const float uniformDivisor)
 	m_min /= uniformDivisor;
 	m_max /= uniformDivisor;
 }
-
-void FloatRange::operator=(const FloatRange& copyFrom)
-{
-	m_min = copyFrom.m_min;
-	m_max = copyFrom.m_max;
-}
-
@@ -15,7 +15,6 @@ public:
 
 public:
 	FloatRange(){}
-	~FloatRange() {}
 	explicit FloatRange(float min, float max);
 	explicit FloatRange(Vec2 const& vectorToConvert);
 	explicit FloatRange(float defaultValue);
@@ -54,7 +53,6 @@ public:
 	void		operator-=(const FloatRange & floatRangeToSubtract);		 
 	void		operator*=(const float uniformScale);			
 	void		operator/=(const float uniformDivisor);		
-	void		operator=(const FloatRange& copyFrom);				
 
 };
 
@@ -0,0 +1,353 @@
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+
+constexpr int ALL_FRUSTUM_PLANES_MASK = (1 << NUM_FRUSTUM_PLANES) - 1;
+
+//-----------------------------------------------------------------------------------------------
+// every test below does the same float ops in the same order, so the single, batch and hierarchical versions agree exactly
+//	center/extent form: s = n.center - d, r = |n|.extents; fully behind when s + r < 0, fully in front when s - r >= 0
+//
+struct FrustumPlanesSIMD
+{
+	SIMDFloat4 m_normalX[NUM_FRUSTUM_PLANES];
+	SIMDFloat4 m_normalY[NUM_FRUSTUM_PLANES];
+	SIMDFloat4 m_normalZ[NUM_FRUSTUM_PLANES];
+	SIMDFloat4 m_absNormalX[NUM_FRUSTUM_PLANES];
+	SIMDFloat4 m_absNormalY[NUM_FRUSTUM_PLANES];
+	SIMDFloat4 m_absNormalZ[NUM_FRUSTUM_PLANES];
+	SIMDFloat4 m_distance[NUM_FRUSTUM_PLANES];
+};
+
+static void SplatFrustumPlanes(Frustum const& frustum, FrustumPlanesSIMD& out_planes)
+{
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+	{
+		Plane3D const& plane = frustum.m_planes[planeIndex];
+		out_planes.m_normalX[planeIndex] = SIMDSplat(plane.m_normal.x);
+		out_planes.m_normalY[planeIndex] = SIMDSplat(plane.m_normal.y);
+		out_planes.m_normalZ[planeIndex] = SIMDSplat(plane.m_normal.z);
+		out_planes.m_absNormalX[planeIndex] = SIMDSplat(fabsf(plane.m_normal.x));
+		out_planes.m_absNormalY[planeIndex] = SIMDSplat(fabsf(plane.m_normal.y));
+		out_planes.m_absNormalZ[planeIndex] = SIMDSplat(fabsf(plane.m_normal.z));
+		out_planes.m_distance[planeIndex] = SIMDSplat(plane.m_distanceAlongNormal);
+	}
+}
+
+static float GetPlaneSeparation(Plane3D const& plane, float centerX, float centerY, float centerZ)
+{
+	return (((plane.m_normal.x * centerX) + (plane.m_normal.y * centerY)) + (plane.m_normal.z * centerZ)) - plane.m_distanceAlongNormal;
+}
+
+static float GetAABB3ProjectedRadius(Plane3D const& plane, float extentX, float extentY, float extentZ)
+{
+	return ((fabsf(plane.m_normal.x) * extentX) + (fabsf(plane.m_normal.y) * extentY)) + (fabsf(plane.m_normal.z) * extentZ);
+}
+
+static bool IsAABB3VisibleForPlanes(Frustum const& frustum, AABB3 const& box, int planeMask)
+{
+	float centerX = (box.m_mins.x + box.m_maxs.x) * 0.5f;
+	float centerY = (box.m_mins.y + box.m_maxs.y) * 0.5f;
+	float centerZ = (box.m_mins.z + box.m_maxs.z) * 0.5f;
+	float extentX = (box.m_maxs.x - box.m_mins.x) * 0.5f;
+	float extentY = (box.m_maxs.y - box.m_mins.y) * 0.5f;
+	float extentZ = (box.m_maxs.z - box.m_mins.z) * 0.5f;
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+	{
+		if ((planeMask & (1 << planeIndex)) == 0)
+		{
+			continue;
+		}
+
+		Plane3D const& plane = frustum.m_planes[planeIndex];
+		float separation = GetPlaneSeparation(plane, centerX, centerY, centerZ);
+		float radius = GetAABB3ProjectedRadius(plane, extentX, extentY, extentZ);
+		if (separation + radius < 0.f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//4-bit lane mask of which of the four boxes are visible
+static int GetVisibleLanesForFourAABB3s(FrustumPlanesSIMD const& planes, AABB3 const* fourBoxes, int planeMask)
+{
+	SIMDFloat4 half = SIMDSplat(0.5f);
+	SIMDFloat4 minsX = SIMDSet(fourBoxes[0].m_mins.x, fourBoxes[1].m_mins.x, fourBoxes[2].m_mins.x, fourBoxes[3].m_mins.x);
+	SIMDFloat4 minsY = SIMDSet(fourBoxes[0].m_mins.y, fourBoxes[1].m_mins.y, fourBoxes[2].m_mins.y, fourBoxes[3].m_mins.y);
+	SIMDFloat4 minsZ = SIMDSet(fourBoxes[0].m_mins.z, fourBoxes[1].m_mins.z, fourBoxes[2].m_mins.z, fourBoxes[3].m_mins.z);
+	SIMDFloat4 maxsX = SIMDSet(fourBoxes[0].m_maxs.x, fourBoxes[1].m_maxs.x, fourBoxes[2].m_maxs.x, fourBoxes[3].m_maxs.x);
+	SIMDFloat4 maxsY = SIMDSet(fourBoxes[0].m_maxs.y, fourBoxes[1].m_maxs.y, fourBoxes[2].m_maxs.y, fourBoxes[3].m_maxs.y);
+	SIMDFloat4 maxsZ = SIMDSet(fourBoxes[0].m_maxs.z, fourBoxes[1].m_maxs.z, fourBoxes[2].m_maxs.z, fourBoxes[3].m_maxs.z);
+	SIMDFloat4 centerX = SIMDMul(SIMDAdd(minsX, maxsX), half);
+	SIMDFloat4 centerY = SIMDMul(SIMDAdd(minsY, maxsY), half);
+	SIMDFloat4 centerZ = SIMDMul(SIMDAdd(minsZ, maxsZ), half);
+	SIMDFloat4 extentX = SIMDMul(SIMDSub(maxsX, minsX), half);
+	SIMDFloat4 extentY = SIMDMul(SIMDSub(maxsY, minsY), half);
+	SIMDFloat4 extentZ = SIMDMul(SIMDSub(maxsZ, minsZ), half);
+
+	SIMDFloat4 zero = SIMDSplat(0.f);
+	int outsideLanes = 0;
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+	{
+		if ((planeMask & (1 << planeIndex)) == 0)
+		{
+			continue;
+		}
+
+		SIMDFloat4 separation = SIMDAdd(SIMDMul(planes.m_normalX[planeIndex], centerX), SIMDMul(planes.m_normalY[planeIndex], centerY));
+		separation = SIMDSub(SIMDAdd(separation, SIMDMul(planes.m_normalZ[planeIndex], centerZ)), planes.m_distance[planeIndex]);
+		SIMDFloat4 radius = SIMDAdd(SIMDMul(planes.m_absNormalX[planeIndex], extentX), SIMDMul(planes.m_absNormalY[planeIndex], extentY));
+		radius = SIMDAdd(radius, SIMDMul(planes.m_absNormalZ[planeIndex], extentZ));
+		outsideLanes |= SIMDGetMaskBits(SIMDCmpLt(SIMDAdd(separation, radius), zero));
+	}
+	return (~outsideLanes) & 0xF;
+}
+
+static int GetVisibleLanesForFourSpheres(FrustumPlanesSIMD const& planes, Vec3 const* fourCenters, float const* fourRadii)
+{
+	SIMDFloat4 centerX = SIMDSet(fourCenters[0].x, fourCenters[1].x, fourCenters[2].x, fourCenters[3].x);
+	SIMDFloat4 centerY = SIMDSet(fourCenters[0].y, fourCenters[1].y, fourCenters[2].y, fourCenters[3].y);
+	SIMDFloat4 centerZ = SIMDSet(fourCenters[0].z, fourCenters[1].z, fourCenters[2].z, fourCenters[3].z);
+	SIMDFloat4 radius = SIMDLoad(fourRadii);
+
+	SIMDFloat4 zero = SIMDSplat(0.f);
+	int outsideLanes = 0;
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+	{
+		SIMDFloat4 separation = SIMDAdd(SIMDMul(planes.m_normalX[planeIndex], centerX), SIMDMul(planes.m_normalY[planeIndex], centerY));
+		separation = SIMDSub(SIMDAdd(separation, SIMDMul(planes.m_normalZ[planeIndex], centerZ)), planes.m_distance[planeIndex]);
+		outsideLanes |= SIMDGetMaskBits(SIMDCmpLt(SIMDAdd(separation, radius), zero));
+	}
+	return (~outsideLanes) & 0xF;
+}
+
+static void ClearVisibilityBits(int count, unsigned int* out_visibilityBits)
+{
+	int numWords = (count + 31) / 32;
+	for (int wordIndex = 0; wordIndex < numWords; ++wordIndex)
+	{
+		out_visibilityBits[wordIndex] = 0;
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+//Gribb-Hartmann: each plane is a sum or difference of rows of the world to clip matrix
+Frustum const Frustum::MakeFromWorldToClipTransform(Mat44 const& worldToClip)
+{
+	float const* values = worldToClip.m_values;
+	float rowX[4] = { values[Mat44::Ix], values[Mat44::Jx], values[Mat44::Kx], values[Mat44::Tx] };
+	float rowY[4] = { values[Mat44::Iy], values[Mat44::Jy], values[Mat44::Ky], values[Mat44::Ty] };
+	float rowZ[4] = { values[Mat44::Iz], values[Mat44::Jz], values[Mat44::Kz], values[Mat44::Tz] };
+	float rowW[4] = { values[Mat44::Iw], values[Mat44::Jw], values[Mat44::Kw], values[Mat44::Tw] };
+
+	float planeCoefficients[NUM_FRUSTUM_PLANES][4];
+	for (int column = 0; column < 4; ++column)
+	{
+		planeCoefficients[FRUSTUM_PLANE_LEFT][column] = rowW[column] + rowX[column];
+		planeCoefficients[FRUSTUM_PLANE_RIGHT][column] = rowW[column] - rowX[column];
+		planeCoefficients[FRUSTUM_PLANE_BOTTOM][column] = rowW[column] + rowY[column];
+		planeCoefficients[FRUSTUM_PLANE_TOP][column] = rowW[column] - rowY[column];
+		planeCoefficients[FRUSTUM_PLANE_NEAR][column] = rowZ[column];
+		planeCoefficients[FRUSTUM_PLANE_FAR][column] = rowW[column] - rowZ[column];
+	}
+
+	Frustum frustum;
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+	{
+		float const* coefficients = planeCoefficients[planeIndex];
+		Vec3 normal(coefficients[0], coefficients[1], coefficients[2]);
+		float length = normal.GetLength();
+		float inverseLength = (length > 0.f) ? (1.f / length) : 0.f;
+		frustum.m_planes[planeIndex] = Plane3D(normal * inverseLength, -coefficients[3] * inverseLength);
+	}
+	return frustum;
+}
+
+bool Frustum::IsPointInside(Vec3 const& point) const
+{
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+	{
+		if (!m_planes[planeIndex].IsPointInFrontOf(point))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Frustum::IsSphereVisible(Vec3 const& center, float radius) const
+{
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+	{
+		if (GetPlaneSeparation(m_planes[planeIndex], center.x, center.y, center.z) + radius < 0.f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Frustum::IsAABB3Visible(AABB3 const& box) const
+{
+	return IsAABB3VisibleForPlanes(*this, box, ALL_FRUSTUM_PLANES_MASK);
+}
+
+//-----------------------------------------------------------------------------------------------
+void Frustum::ComputeSphereVisibilityBits(int count, Vec3 const* centers, float const* radii, unsigned int* out_visibilityBits) const
+{
+	ClearVisibilityBits(count, out_visibilityBits);
+	FrustumPlanesSIMD planes;
+	SplatFrustumPlanes(*this, planes);
+
+	int sphereIndex = 0;
+	for (; sphereIndex + 4 <= count; sphereIndex += 4)
+	{
+		int visibleLanes = GetVisibleLanesForFourSpheres(planes, &centers[sphereIndex], &radii[sphereIndex]);
+		out_visibilityBits[sphereIndex >> 5] |= static_cast<unsigned int>(visibleLanes) << (sphereIndex & 31);
+	}
+	for (; sphereIndex < count; ++sphereIndex)
+	{
+		if (IsSphereVisible(centers[sphereIndex], radii[sphereIndex]))
+		{
+			out_visibilityBits[sphereIndex >> 5] |= 1u << (sphereIndex & 31);
+		}
+	}
+}
+
+int Frustum::GetVisibleSphereIndexes(int count, Vec3 const* centers, float const* radii, int* out_visibleIndexes) const
+{
+	FrustumPlanesSIMD planes;
+	SplatFrustumPlanes(*this, planes);
+
+	int numVisible = 0;
+	int sphereIndex = 0;
+	for (; sphereIndex + 4 <= count; sphereIndex += 4)
+	{
+		int visibleLanes = GetVisibleLanesForFourSpheres(planes, &centers[sphereIndex], &radii[sphereIndex]);
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			out_visibleIndexes[numVisible] = sphereIndex + lane;
+			numVisible += (visibleLanes >> lane) & 1;
+		}
+	}
+	for (; sphereIndex < count; ++sphereIndex)
+	{
+		if (IsSphereVisible(centers[sphereIndex], radii[sphereIndex]))
+		{
+			out_visibleIndexes[numVisible++] = sphereIndex;
+		}
+	}
+	return numVisible;
+}
+
+void Frustum::ComputeAABB3VisibilityBits(int count, AABB3 const* boxes, unsigned int* out_visibilityBits) const
+{
+	ClearVisibilityBits(count, out_visibilityBits);
+	FrustumPlanesSIMD planes;
+	SplatFrustumPlanes(*this, planes);
+
+	int boxIndex = 0;
+	for (; boxIndex + 4 <= count; boxIndex += 4)
+	{
+		int visibleLanes = GetVisibleLanesForFourAABB3s(planes, &boxes[boxIndex], ALL_FRUSTUM_PLANES_MASK);
+		out_visibilityBits[boxIndex >> 5] |= static_cast<unsigned int>(visibleLanes) << (boxIndex & 31);
+	}
+	for (; boxIndex < count; ++boxIndex)
+	{
+		if (IsAABB3VisibleForPlanes(*this, boxes[boxIndex], ALL_FRUSTUM_PLANES_MASK))
+		{
+			out_visibilityBits[boxIndex >> 5] |= 1u << (boxIndex & 31);
+		}
+	}
+}
+
+//branch free compaction: always write the index, only advance past it when visible
+static int AppendVisibleAABB3Indexes(Frustum const& frustum, FrustumPlanesSIMD const& planes, int firstIndex, int count, AABB3 const* boxes, int planeMask, int* out_visibleIndexes)
+{
+	int numVisible = 0;
+	int boxIndex = firstIndex;
+	int endIndex = firstIndex + count;
+	for (; boxIndex + 4 <= endIndex; boxIndex += 4)
+	{
+		int visibleLanes = GetVisibleLanesForFourAABB3s(planes, &boxes[boxIndex], planeMask);
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			out_visibleIndexes[numVisible] = boxIndex + lane;
+			numVisible += (visibleLanes >> lane) & 1;
+		}
+	}
+	for (; boxIndex < endIndex; ++boxIndex)
+	{
+		if (IsAABB3VisibleForPlanes(frustum, boxes[boxIndex], planeMask))
+		{
+			out_visibleIndexes[numVisible++] = boxIndex;
+		}
+	}
+	return numVisible;
+}
+
+int Frustum::GetVisibleAABB3Indexes(int count, AABB3 const* boxes, int* out_visibleIndexes) const
+{
+	FrustumPlanesSIMD planes;
+	SplatFrustumPlanes(*this, planes);
+	return AppendVisibleAABB3Indexes(*this, planes, 0, count, boxes, ALL_FRUSTUM_PLANES_MASK, out_visibleIndexes);
+}
+
+int Frustum::GetVisibleAABB3IndexesHierarchical(int numGroups, AABB3 const* groupBounds, int const* groupStarts, AABB3 const* boxes, int* out_visibleIndexes) const
+{
+	FrustumPlanesSIMD planes;
+	SplatFrustumPlanes(*this, planes);
+
+	int numVisible = 0;
+	for (int groupIndex = 0; groupIndex < numGroups; ++groupIndex)
+	{
+		AABB3 const& bounds = groupBounds[groupIndex];
+		float centerX = (bounds.m_mins.x + bounds.m_maxs.x) * 0.5f;
+		float centerY = (bounds.m_mins.y + bounds.m_maxs.y) * 0.5f;
+		float centerZ = (bounds.m_mins.z + bounds.m_maxs.z) * 0.5f;
+		float extentX = (bounds.m_maxs.x - bounds.m_mins.x) * 0.5f;
+		float extentY = (bounds.m_maxs.y - bounds.m_mins.y) * 0.5f;
+		float extentZ = (bounds.m_maxs.z - bounds.m_mins.z) * 0.5f;
+
+		//planes the group crosses; a box inside the group can only be behind one of those
+		bool isGroupOutside = false;
+		int straddledPlaneMask = 0;
+		for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; ++planeIndex)
+		{
+			Plane3D const& plane = m_planes[planeIndex];
+			float separation = GetPlaneSeparation(plane, centerX, centerY, centerZ);
+			float radius = GetAABB3ProjectedRadius(plane, extentX, extentY, extentZ);
+			if (separation + radius < 0.f)
+			{
+				isGroupOutside = true;
+				break;
+			}
+			if (separation - radius < 0.f)
+			{
+				straddledPlaneMask |= 1 << planeIndex;
+			}
+		}
+		if (isGroupOutside)
+		{
+			continue;
+		}
+
+		int firstBox = groupStarts[groupIndex];
+		int numBoxes = groupStarts[groupIndex + 1] - firstBox;
+		if (straddledPlaneMask == 0)
+		{
+			for (int boxIndex = firstBox; boxIndex < firstBox + numBoxes; ++boxIndex)
+			{
+				out_visibleIndexes[numVisible++] = boxIndex;
+			}
+			continue;
+		}
+
+		numVisible += AppendVisibleAABB3Indexes(*this, planes, firstBox, numBoxes, boxes, straddledPlaneMask, &out_visibleIndexes[numVisible]);
+	}
+	return numVisible;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "Engine/Math/Plane3D.hpp"
+struct AABB3;
+struct Mat44;
+
+enum FrustumPlane : int
+{
+	FRUSTUM_PLANE_LEFT,
+	FRUSTUM_PLANE_RIGHT,
+	FRUSTUM_PLANE_BOTTOM,
+	FRUSTUM_PLANE_TOP,
+	FRUSTUM_PLANE_NEAR,
+	FRUSTUM_PLANE_FAR,
+
+	NUM_FRUSTUM_PLANES
+};
+
+//-----------------------------------------------------------------------------------------------
+// six planes with unit normals pointing into the view volume; a shape is culled only when it is fully behind one plane,
+//	so tests are conservative (a few shapes near the corners pass even though they are just outside)
+//	the batch functions test four shapes per SIMD op and give exactly the same answers as the single shape tests
+//	visibility bits: shape i is bit (i % 32) of out_visibilityBits[i / 32], so the array needs (count + 31) / 32 words
+//	index lists are written in ascending order and need room for count indexes
+//
+struct Frustum
+{
+public:
+	Plane3D m_planes[NUM_FRUSTUM_PLANES];
+
+public:
+	Frustum() {}
+	static Frustum const MakeFromWorldToClipTransform(Mat44 const& worldToClip); //D3D style clip space, 0 <= z <= w
+
+	bool	IsPointInside(Vec3 const& point) const;
+	bool	IsSphereVisible(Vec3 const& center, float radius) const;
+	bool	IsAABB3Visible(AABB3 const& box) const;
+
+	void	ComputeSphereVisibilityBits(int count, Vec3 const* centers, float const* radii, unsigned int* out_visibilityBits) const;
+	int		GetVisibleSphereIndexes(int count, Vec3 const* centers, float const* radii, int* out_visibleIndexes) const; //returns how many were written
+	void	ComputeAABB3VisibilityBits(int count, AABB3 const* boxes, unsigned int* out_visibilityBits) const;
+	int		GetVisibleAABB3Indexes(int count, AABB3 const* boxes, int* out_visibleIndexes) const;
+
+	//boxes are stored group by group, group g owns boxes [groupStarts[g], groupStarts[g + 1]) and groupBounds[g] must contain all of them
+	//	groups fully outside are skipped, groups fully inside are accepted without testing their boxes,
+	//	and straddling groups only test their boxes against the planes the group crosses
+	int		GetVisibleAABB3IndexesHierarchical(int numGroups, AABB3 const* groupBounds, int const* groupStarts, AABB3 const* boxes, int* out_visibleIndexes) const;
+};
@@ -92,9 +92,3 @@ void IntRange::operator/=(const int uniformDivisor)
 	m_min /= uniformDivisor;
 	m_max /= uniformDivisor;
 }
-
-void IntRange::operator=(const IntRange& copyFrom)
-{
-	m_min = copyFrom.m_min;
-	m_max = copyFrom.m_max;
-}
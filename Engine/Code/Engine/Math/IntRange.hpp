@@ -7,7 +7,6 @@ public:
 
 public:
 	IntRange() {}
-	~IntRange() {}
 	explicit IntRange(int const& min, int const& max);
 
 	// Accessors (const)
@@ -39,6 +38,5 @@ public:
 	void		operator-=(const IntRange& intRangeToSubtract);
 	void		operator*=(const int uniformScale);
 	void		operator/=(const int uniformDivisor);
-	void		operator=(const IntRange& copyFrom);
 };
 
@@ -3,6 +3,7 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "math.h"
+#include <type_traits>
 
 IntVec2 const IntVec2::ZERO = IntVec2();
 IntVec2 const IntVec2::ONE = IntVec2(1, 1);
@@ -13,12 +14,7 @@ IntVec2 const IntVec2::EAST = IntVec2(1, 0);
 IntVec2 const IntVec2::SOUTH = IntVec2(0, -1);
 IntVec2 const IntVec2::WEST = IntVec2(-1, 0);
 
-//-----------------------------------------------------------------------------------------------
-IntVec2::IntVec2( const IntVec2& copy )
-	: x( copy.x )
-	, y( copy.y )
-{
-}
+static_assert(std::is_trivially_copyable<IntVec2>::value, "IntVec2 must stay trivially copyable");
 
 //#TODO: make sure flooring is the best option for this, Changing might break Libra
 IntVec2::IntVec2(Vec2 const& copyFromVec2)
@@ -27,13 +23,6 @@ IntVec2::IntVec2(Vec2 const& copyFromVec2)
 {
 }
 
-//-----------------------------------------------------------------------------------------------
-IntVec2::IntVec2( int initialX, int initialY )
-	: x( initialX )
-	, y( initialY)
-{
-}
-
 IntVec2::IntVec2(size_t initialX, size_t initialY)
 	:x((int)(initialX))
 	, y((int)(initialY))
@@ -107,111 +96,3 @@ void IntVec2::RotateMinus90Degrees()
 	x = y;
 	y = -oldX;
 }
-
-
-//Operators
-//-----------------------------------------------------------------------------------------------
-const IntVec2 IntVec2::operator + ( const IntVec2& vecToAdd ) const
-{
-	return IntVec2(x + vecToAdd.x, y + vecToAdd.y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-const IntVec2 IntVec2::operator-( const IntVec2& vecToSubtract ) const
-{
-	return IntVec2(x - vecToSubtract.x, y - vecToSubtract.y);
-}
-
-
-//------------------------------------------------------------------------------------------------
-const IntVec2 IntVec2::operator-() const
-{
-	return IntVec2( -x, -y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-const IntVec2 IntVec2::operator*( int uniformScale ) const
-{
-	return IntVec2(x * uniformScale, y * uniformScale);
-}
-
-
-//------------------------------------------------------------------------------------------------
-const IntVec2 IntVec2::operator*( const IntVec2& vecToMultiply ) const
-{
-	return IntVec2( x * vecToMultiply.x, y * vecToMultiply.y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-const IntVec2 IntVec2::operator/( int inverseScale ) const
-{
-	return IntVec2( x / inverseScale, y / inverseScale );
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void IntVec2::operator+=( const IntVec2& vecToAdd )
-{
-	x += vecToAdd.x;
-	y += vecToAdd.y;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void IntVec2::operator-=( const IntVec2& vecToSubtract )
-{
-	x -= vecToSubtract.x;
-	y -= vecToSubtract.y;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void IntVec2::operator*=( const int uniformScale )
-{
-	x *= uniformScale;
-	y *= uniformScale;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void IntVec2::operator/=( const int uniformDivisor )
-{
-	x /= uniformDivisor;
-	y /= uniformDivisor;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void IntVec2::operator=( const IntVec2& copyFrom )
-{
-	x = copyFrom.x;
-	y = copyFrom.y;
-}
-
-
-
-//-----------------------------------------------------------------------------------------------
-const IntVec2 operator*( int uniformScale, const IntVec2& vecToScale )
-{
-	return IntVec2(vecToScale.x * uniformScale, vecToScale.y * uniformScale);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-bool IntVec2::operator==( const IntVec2& compare ) const
-{
-	return (x == compare.x && y == compare.y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-bool IntVec2::operator!=( const IntVec2& compare ) const
-{
-	return (x != compare.x || y != compare.y);
-}
-
-
-
@@ -19,11 +19,10 @@ public: // NOTE: this is one of the few cases where we break both the "m_" namin
 
 public:
 	// Construction/Destruction
-	~IntVec2() {}												// destructor (do nothing)
-	IntVec2() {}												// default constructor (do nothing)
-	IntVec2( const IntVec2& copyFrom );							// copy constructor (from another IntVec2)
+	// copy, assignment and destruction are left to the compiler so IntVec2 stays trivially copyable
+	IntVec2() = default;										// default constructor (zero)
 	explicit IntVec2(Vec2 const& copyFromVec2);
-	explicit IntVec2( int initialX, int initialY );		// explicit constructor (from x, y)
+	constexpr explicit IntVec2( int initialX, int initialY ) : x( initialX ), y( initialY ) {}	// explicit constructor (from x, y)
 	explicit IntVec2(size_t initialX, size_t initialY);
 	
 	//Accessors (const methods)
@@ -45,28 +44,30 @@ public:
 	// Operators (const)
 	//-----------------------------------------------------------------------------------------------
 
-	bool		operator==( const IntVec2& compare ) const;		// IntVec2 == IntVec2
-	bool		operator!=( const IntVec2& compare ) const;		// IntVec2 != IntVec2
-	const IntVec2	operator+( const IntVec2& vecToAdd ) const;		// IntVec2 + IntVec2
-	const IntVec2	operator-( const IntVec2& vecToSubtract ) const;	// IntVec2 - IntVec2
-	const IntVec2	operator-() const;								// -IntVec2, i.e. "unary negation"
-	const IntVec2	operator*( int uniformScale ) const;			// IntVec2 * float
-	const IntVec2	operator*( const IntVec2& vecToMultiply ) const;	// IntVec2 * IntVec2
-	const IntVec2	operator/( int inverseScale ) const;			// IntVec2 / float
+	constexpr bool			operator==( const IntVec2& compare ) const			{ return x == compare.x && y == compare.y; }
+	constexpr bool			operator!=( const IntVec2& compare ) const			{ return x != compare.x || y != compare.y; }
+	constexpr const IntVec2	operator+( const IntVec2& vecToAdd ) const			{ return IntVec2( x + vecToAdd.x, y + vecToAdd.y ); }
+	constexpr const IntVec2	operator-( const IntVec2& vecToSubtract ) const		{ return IntVec2( x - vecToSubtract.x, y - vecToSubtract.y ); }
+	constexpr const IntVec2	operator-() const									{ return IntVec2( -x, -y ); }
+	constexpr const IntVec2	operator*( int uniformScale ) const					{ return IntVec2( x * uniformScale, y * uniformScale ); }
+	constexpr const IntVec2	operator*( const IntVec2& vecToMultiply ) const		{ return IntVec2( x * vecToMultiply.x, y * vecToMultiply.y ); }
+	constexpr const IntVec2	operator/( int inverseScale ) const					{ return IntVec2( x / inverseScale, y / inverseScale ); }
 
 	// Operators (self-mutating / non-const)
 	//-----------------------------------------------------------------------------------------------
 
-	void		operator+=( const IntVec2& vecToAdd );				// IntVec2 += IntVec2
-	void		operator-=( const IntVec2& vecToSubtract );		// IntVec2 -= IntVec2
-	void		operator*=( const int uniformScale );			// IntVec2 *= float
-	void		operator/=( const int uniformDivisor );		// IntVec2 /= float
-	void		operator=( const IntVec2& copyFrom );				// IntVec2 = IntVec2
+	constexpr void	operator+=( const IntVec2& vecToAdd )			{ x += vecToAdd.x; y += vecToAdd.y; }
+	constexpr void	operator-=( const IntVec2& vecToSubtract )		{ x -= vecToSubtract.x; y -= vecToSubtract.y; }
+	constexpr void	operator*=( const int uniformScale )			{ x *= uniformScale; y *= uniformScale; }
+	constexpr void	operator/=( const int uniformDivisor )			{ x /= uniformDivisor; y /= uniformDivisor; }
 
 	// Standalone "friend" functions that are conceptually, but not actually, part of IntVec2::
 	//-----------------------------------------------------------------------------------------------
 
-	friend const IntVec2 operator*( int uniformScale, const IntVec2& vecToScale );	// float * IntVec2
+	friend constexpr const IntVec2 operator*( int uniformScale, const IntVec2& vecToScale )	// int * IntVec2
+	{
+		return IntVec2( vecToScale.x * uniformScale, vecToScale.y * uniformScale );
+	}
 
 	
 
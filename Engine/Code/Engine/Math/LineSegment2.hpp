@@ -8,7 +8,6 @@ public:
 
 public:
 	LineSegment2() {}
-	~LineSegment2() {}
 	explicit LineSegment2(Vec2 const& start, Vec2 const& end);
 	explicit LineSegment2(Vec2 const& center, Vec2 directionNormalized, float const& length);
 
@@ -3,6 +3,7 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Vec4.hpp"
 #include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 
 const Mat44 Mat44::IFWRD_JLEFT_KUP_TO_DX11RENDER = Mat44(Mat44(Vec4(0.f, 0.f, 1.f, 0.f), Vec4(-1.f, 0.f, 0.f, 0.f), Vec4(0.f, 1.f, 0.f, 0.f), Vec4(0.f, 0.f, 0.f, 1.f)));
@@ -161,30 +162,39 @@ Mat44 const Mat44::MakeNonUniformScale3D(Vec3 const& nonUniformScaleXYZ)
 Mat44 const Mat44::MakeZRotationDegrees(float rotationDegreesAboutZ)
 {
 	Mat44 newMatrix;
-	newMatrix.m_values[Ix] = CosDegrees(rotationDegreesAboutZ);
-	newMatrix.m_values[Iy] = SinDegrees(rotationDegreesAboutZ);
-	newMatrix.m_values[Jx] = -SinDegrees(rotationDegreesAboutZ);
-	newMatrix.m_values[Jy] = CosDegrees(rotationDegreesAboutZ);
+	float sinDegrees;
+	float cosDegrees;
+	SinCosDegrees(rotationDegreesAboutZ, sinDegrees, cosDegrees);
+	newMatrix.m_values[Ix] = cosDegrees;
+	newMatrix.m_values[Iy] = sinDegrees;
+	newMatrix.m_values[Jx] = -sinDegrees;
+	newMatrix.m_values[Jy] = cosDegrees;
 	return newMatrix;
 }
 
 Mat44 const Mat44::MakeYRotationDegrees(float rotationDegreesAboutY)
 {
 	Mat44 newMatrix;
-	newMatrix.m_values[Ix] = CosDegrees(rotationDegreesAboutY);
-	newMatrix.m_values[Iz] = -SinDegrees(rotationDegreesAboutY);
-	newMatrix.m_values[Kx] = SinDegrees(rotationDegreesAboutY);
-	newMatrix.m_values[Kz] = CosDegrees(rotationDegreesAboutY);
+	float sinDegrees;
+	float cosDegrees;
+	SinCosDegrees(rotationDegreesAboutY, sinDegrees, cosDegrees);
+	newMatrix.m_values[Ix] = cosDegrees;
+	newMatrix.m_values[Iz] = -sinDegrees;
+	newMatrix.m_values[Kx] = sinDegrees;
+	newMatrix.m_values[Kz] = cosDegrees;
 	return newMatrix;
 }
 
 Mat44 const Mat44::MakeXRotationDegrees(float rotationDegreesAboutX)
 {
 	Mat44 newMatrix;
-	newMatrix.m_values[Jy] = CosDegrees(rotationDegreesAboutX);
-	newMatrix.m_values[Jz] = SinDegrees(rotationDegreesAboutX);
-	newMatrix.m_values[Ky] = -SinDegrees(rotationDegreesAboutX);
-	newMatrix.m_values[Kz] = CosDegrees(rotationDegreesAboutX);
+	float sinDegrees;
+	float cosDegrees;
+	SinCosDegrees(rotationDegreesAboutX, sinDegrees, cosDegrees);
+	newMatrix.m_values[Jy] = cosDegrees;
+	newMatrix.m_values[Jz] = sinDegrees;
+	newMatrix.m_values[Ky] = -sinDegrees;
+	newMatrix.m_values[Kz] = cosDegrees;
 	return newMatrix;
 }
 
@@ -233,11 +243,13 @@ Vec2 const Mat44::TransformVectorQuantity2D(Vec2 const& vectorQuantityXY) const
 
 Vec3 const Mat44::TransformVectorQuantity3D(Vec3 const& vectorQuantityXYZ) const
 {
-	Vec3 vectorQuantity3D;
-	vectorQuantity3D.x = (m_values[Ix] * vectorQuantityXYZ.x) + (m_values[Jx] * vectorQuantityXYZ.y) + (m_values[Kx] * vectorQuantityXYZ.z);
-	vectorQuantity3D.y = (m_values[Iy] * vectorQuantityXYZ.x) + (m_values[Jy] * vectorQuantityXYZ.y) + (m_values[Ky] * vectorQuantityXYZ.z);
-	vectorQuantity3D.z = (m_values[Iz] * vectorQuantityXYZ.x) + (m_values[Jz] * vectorQuantityXYZ.y) + (m_values[Kz] * vectorQuantityXYZ.z);
-	return vectorQuantity3D;
+	SIMDFloat4 result = SIMDMul(SIMDLoad(&m_values[Ix]), SIMDSplat(vectorQuantityXYZ.x));
+	result = SIMDAdd(result, SIMDMul(SIMDLoad(&m_values[Jx]), SIMDSplat(vectorQuantityXYZ.y)));
+	result = SIMDAdd(result, SIMDMul(SIMDLoad(&m_values[Kx]), SIMDSplat(vectorQuantityXYZ.z)));
+
+	float values[4];
+	SIMDStore(values, result);
+	return Vec3(values[0], values[1], values[2]);
 }
 
 Vec2 const Mat44::TransformPosition2D(Vec2 const& positionXY) const
@@ -250,20 +262,23 @@ Vec2 const Mat44::TransformPosition2D(Vec2 const& positionXY) const
 
 Vec3 const Mat44::TransformPosition3D(Vec3 const& positionXYZ) const
 {
-	Vec3 position3D;
-	position3D.x = (m_values[Ix] * positionXYZ.x) + (m_values[Jx] * positionXYZ.y) + (m_values[Kx] * positionXYZ.z) + m_values[Tx];
-	position3D.y = (m_values[Iy] * positionXYZ.x) + (m_values[Jy] * positionXYZ.y) + (m_values[Ky] * positionXYZ.z) + m_values[Ty];
-	position3D.z = (m_values[Iz] * positionXYZ.x) + (m_values[Jz] * positionXYZ.y) + (m_values[Kz] * positionXYZ.z) + m_values[Tz];
-	return position3D;
+	SIMDFloat4 result = SIMDMul(SIMDLoad(&m_values[Ix]), SIMDSplat(positionXYZ.x));
+	result = SIMDAdd(result, SIMDMul(SIMDLoad(&m_values[Jx]), SIMDSplat(positionXYZ.y)));
+	result = SIMDAdd(result, SIMDMul(SIMDLoad(&m_values[Kx]), SIMDSplat(positionXYZ.z)));
+	result = SIMDAdd(result, SIMDLoad(&m_values[Tx]));
+
+	float values[4];
+	SIMDStore(values, result);
+	return Vec3(values[0], values[1], values[2]);
 }
 
 Vec4 const Mat44::TransformHomogeneous3D(Vec4 const& homogenousPoint3D) const
 {
+	SIMDFloat4 result = SIMDTransformColumns(SIMDLoad(&m_values[Ix]), SIMDLoad(&m_values[Jx]), SIMDLoad(&m_values[Kx]), SIMDLoad(&m_values[Tx]),
+		homogenousPoint3D.x, homogenousPoint3D.y, homogenousPoint3D.z, homogenousPoint3D.w);
+
 	Vec4 point4D;
-	point4D.x = (m_values[Ix] * homogenousPoint3D.x) + (m_values[Jx] * homogenousPoint3D.y) + (m_values[Kx] * homogenousPoint3D.z) + (m_values[Tx] * homogenousPoint3D.w);
-	point4D.y = (m_values[Iy] * homogenousPoint3D.x) + (m_values[Jy] * homogenousPoint3D.y) + (m_values[Ky] * homogenousPoint3D.z) + (m_values[Ty] * homogenousPoint3D.w);
-	point4D.z = (m_values[Iz] * homogenousPoint3D.x) + (m_values[Jz] * homogenousPoint3D.y) + (m_values[Kz] * homogenousPoint3D.z) + (m_values[Tz] * homogenousPoint3D.w);
-	point4D.w = (m_values[Iw] * homogenousPoint3D.x) + (m_values[Jw] * homogenousPoint3D.y) + (m_values[Kw] * homogenousPoint3D.z) + (m_values[Tw] * homogenousPoint3D.w);
+	SIMDStore(&point4D.x, result);
 	return point4D;
 }
 
@@ -335,18 +350,23 @@ Vec4 const Mat44::GetTranslation4D() const
 
 Mat44 const Mat44::GetOrthonormalInverse() const
 {
-	Mat44 inverseMatrix;
+	//rows of the 3x3 become the new bases
+	SIMDFloat4 iBasis = SIMDSet(m_values[Ix], m_values[Jx], m_values[Kx], 0.f);
+	SIMDFloat4 jBasis = SIMDSet(m_values[Iy], m_values[Jy], m_values[Ky], 0.f);
+	SIMDFloat4 kBasis = SIMDSet(m_values[Iz], m_values[Jz], m_values[Kz], 0.f);
 
-	Vec3 iBasis(m_values[Ix], m_values[Jx], m_values[Kx]);
-	Vec3 jBasis(m_values[Iy], m_values[Jy], m_values[Ky]);
-	Vec3 kBasis(m_values[Iz], m_values[Jz], m_values[Kz]);
+	//t' = (-I.t, -J.t, -K.t), lanes of the transposed rows
+	SIMDFloat4 translation = SIMDMul(SIMDNegate(iBasis), SIMDSplat(m_values[Tx]));
+	translation = SIMDSub(translation, SIMDMul(jBasis, SIMDSplat(m_values[Ty])));
+	translation = SIMDSub(translation, SIMDMul(kBasis, SIMDSplat(m_values[Tz])));
 
-	float tx = (-m_values[Ix] * m_values[Tx]) - (m_values[Iy] * m_values[Ty]) - (m_values[Iz] * m_values[Tz]);
-	float ty = (-m_values[Jx] * m_values[Tx]) - (m_values[Jy] * m_values[Ty]) - (m_values[Jz] * m_values[Tz]);
-	float tz = (-m_values[Kx] * m_values[Tx]) - (m_values[Ky] * m_values[Ty]) - (m_values[Kz] * m_values[Tz]);
-	Vec3 translation(tx, ty, tz);
-
-	return Mat44(iBasis, jBasis, kBasis, translation);
+	Mat44 inverseMatrix;
+	SIMDStore(&inverseMatrix.m_values[Ix], iBasis);
+	SIMDStore(&inverseMatrix.m_values[Jx], jBasis);
+	SIMDStore(&inverseMatrix.m_values[Kx], kBasis);
+	SIMDStore(&inverseMatrix.m_values[Tx], translation);
+	inverseMatrix.m_values[Tw] = 1.f;
+	return inverseMatrix;
 }
 
 void Mat44::SetTranslation2D(Vec2 const& translationXY)
@@ -493,60 +513,16 @@ void Mat44::Orthonormalize_IFwd_JLeft_KUp()
 
 void Mat44::Append(Mat44 const& appendThis)
 {
-	Mat44 oldMatrix(m_values);
-	m_values[Ix] = (oldMatrix.m_values[Ix] * appendThis.m_values[Ix]) + (oldMatrix.m_values[Jx] * appendThis.m_values[Iy])
-					+ (oldMatrix.m_values[Kx] * appendThis.m_values[Iz]) + (oldMatrix.m_values[Tx] * appendThis.m_values[Iw]);
-
-	m_values[Iy] = (oldMatrix.m_values[Iy] * appendThis.m_values[Ix]) + (oldMatrix.m_values[Jy] * appendThis.m_values[Iy])
-					+ (oldMatrix.m_values[Ky] * appendThis.m_values[Iz]) + (oldMatrix.m_values[Ty] * appendThis.m_values[Iw]);
-
-	m_values[Iz] = (oldMatrix.m_values[Iz] * appendThis.m_values[Ix]) + (oldMatrix.m_values[Jz] * appendThis.m_values[Iy])
-					+ (oldMatrix.m_values[Kz] * appendThis.m_values[Iz]) + (oldMatrix.m_values[Tz] * appendThis.m_values[Iw]);
-
-	m_values[Iw] = (oldMatrix.m_values[Iw] * appendThis.m_values[Ix]) + (oldMatrix.m_values[Jw] * appendThis.m_values[Iy])
-					+ (oldMatrix.m_values[Kw] * appendThis.m_values[Iz]) + (oldMatrix.m_values[Tw] * appendThis.m_values[Iw]);
-
-
-
-	m_values[Jx] = (oldMatrix.m_values[Ix] * appendThis.m_values[Jx]) + (oldMatrix.m_values[Jx] * appendThis.m_values[Jy])
-					+ (oldMatrix.m_values[Kx] * appendThis.m_values[Jz]) + (oldMatrix.m_values[Tx] * appendThis.m_values[Jw]);
-
-	m_values[Jy] = (oldMatrix.m_values[Iy] * appendThis.m_values[Jx]) + (oldMatrix.m_values[Jy] * appendThis.m_values[Jy])
-					+ (oldMatrix.m_values[Ky] * appendThis.m_values[Jz]) + (oldMatrix.m_values[Ty] * appendThis.m_values[Jw]);
-
-	m_values[Jz] = (oldMatrix.m_values[Iz] * appendThis.m_values[Jx]) + (oldMatrix.m_values[Jz] * appendThis.m_values[Jy]) 
-					+ (oldMatrix.m_values[Kz] * appendThis.m_values[Jz]) + (oldMatrix.m_values[Tz] * appendThis.m_values[Jw]);
-
-	m_values[Jw] = (oldMatrix.m_values[Iw] * appendThis.m_values[Jx]) + (oldMatrix.m_values[Jw] * appendThis.m_values[Jy])
-					+ (oldMatrix.m_values[Kw] * appendThis.m_values[Jz]) + (oldMatrix.m_values[Tw] * appendThis.m_values[Jw]);
-
-
-
-	m_values[Kx] = (oldMatrix.m_values[Ix] * appendThis.m_values[Kx]) + (oldMatrix.m_values[Jx] * appendThis.m_values[Ky])
-					+ (oldMatrix.m_values[Kx] * appendThis.m_values[Kz]) + (oldMatrix.m_values[Tx] * appendThis.m_values[Kw]);
-
-	m_values[Ky] = (oldMatrix.m_values[Iy] * appendThis.m_values[Kx]) + (oldMatrix.m_values[Jy] * appendThis.m_values[Ky])
-					+ (oldMatrix.m_values[Ky] * appendThis.m_values[Kz]) + (oldMatrix.m_values[Ty] * appendThis.m_values[Kw]);
-
-	m_values[Kz] = (oldMatrix.m_values[Iz] * appendThis.m_values[Kx]) + (oldMatrix.m_values[Jz] * appendThis.m_values[Ky])
-					+ (oldMatrix.m_values[Kz] * appendThis.m_values[Kz]) + (oldMatrix.m_values[Tz] * appendThis.m_values[Kw]);
-
-	m_values[Kw] = (oldMatrix.m_values[Iw] * appendThis.m_values[Kx]) + (oldMatrix.m_values[Jw] * appendThis.m_values[Ky])
-					+ (oldMatrix.m_values[Kw] * appendThis.m_values[Kz]) + (oldMatrix.m_values[Tw] * appendThis.m_values[Kw]);
-
-
-	m_values[Tx] = (oldMatrix.m_values[Ix] * appendThis.m_values[Tx]) + (oldMatrix.m_values[Jx] * appendThis.m_values[Ty])
-					+ (oldMatrix.m_values[Kx] * appendThis.m_values[Tz]) + (oldMatrix.m_values[Tx] * appendThis.m_values[Tw]);
-
-	m_values[Ty] = (oldMatrix.m_values[Iy] * appendThis.m_values[Tx]) + (oldMatrix.m_values[Jy] * appendThis.m_values[Ty])
-					+ (oldMatrix.m_values[Ky] * appendThis.m_values[Tz]) + (oldMatrix.m_values[Ty] * appendThis.m_values[Tw]);
-
-	m_values[Tz] = (oldMatrix.m_values[Iz] * appendThis.m_values[Tx]) + (oldMatrix.m_values[Jz] * appendThis.m_values[Ty])
-					+ (oldMatrix.m_values[Kz] * appendThis.m_values[Tz]) + (oldMatrix.m_values[Tz] * appendThis.m_values[Tw]);
-
-	m_values[Tw] = (oldMatrix.m_values[Iw] * appendThis.m_values[Tx]) + (oldMatrix.m_values[Jw] * appendThis.m_values[Ty])
-					+ (oldMatrix.m_values[Kw] * appendThis.m_values[Tz]) + (oldMatrix.m_values[Tw] * appendThis.m_values[Tw]);
+	SIMDFloat4 oldI = SIMDLoad(&m_values[Ix]);
+	SIMDFloat4 oldJ = SIMDLoad(&m_values[Jx]);
+	SIMDFloat4 oldK = SIMDLoad(&m_values[Kx]);
+	SIMDFloat4 oldT = SIMDLoad(&m_values[Tx]);
 
+	float const* m = appendThis.m_values;
+	SIMDStore(&m_values[Ix], SIMDTransformColumns(oldI, oldJ, oldK, oldT, m[Ix], m[Iy], m[Iz], m[Iw]));
+	SIMDStore(&m_values[Jx], SIMDTransformColumns(oldI, oldJ, oldK, oldT, m[Jx], m[Jy], m[Jz], m[Jw]));
+	SIMDStore(&m_values[Kx], SIMDTransformColumns(oldI, oldJ, oldK, oldT, m[Kx], m[Ky], m[Kz], m[Kw]));
+	SIMDStore(&m_values[Tx], SIMDTransformColumns(oldI, oldJ, oldK, oldT, m[Tx], m[Ty], m[Tz], m[Tw]));
 }
 
 void Mat44::AppendZRotation(float degreesRotationAboutZ)
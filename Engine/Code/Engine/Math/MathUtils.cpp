@@ -17,7 +17,10 @@
 #include "Engine/Math/ZCylinder3D.hpp"
 #include "Engine/Math/OBB3.hpp"
 #include "Engine/Math/Plane3D.hpp"
+#include "Engine/Math/FastTrig.hpp"
+#include "Game/EngineBuildPreferences.hpp"
 #include <math.h>
+#include <float.h>
 
 
 
@@ -205,6 +208,27 @@ float Atan2Degrees(float y, float x)
     return ConvertRadiansToDegrees(radians);
 }
 
+void SinCosDegrees(float degrees, float& out_sin, float& out_cos)
+{
+#if defined(ENGINE_FAST_TRIG)
+    FastSinCosDegrees(degrees, out_sin, out_cos);
+#else
+    float radians = ConvertDegreesToRadians(degrees);
+    out_sin = sinf(radians);
+    out_cos = cosf(radians);
+#endif
+}
+
+void SinCosRadians(float radians, float& out_sin, float& out_cos)
+{
+#if defined(ENGINE_FAST_TRIG)
+    FastSinCosRadians(radians, out_sin, out_cos);
+#else
+    out_sin = sinf(radians);
+    out_cos = cosf(radians);
+#endif
+}
+
 float AsinDegrees(float x)
 {
 	float radians = asinf(x);
@@ -1441,268 +1465,156 @@ RaycastResult2D RaycastVsDisc2D(Vec2 const& startPos, Vec2 const& fwrdNormal, fl
 
 RaycastResult2D RaycastVsTileHeatMap(Vec2 const& startPos, Vec2 const& fwrdNormal, float maxDist, TileHeatMap const& solidMap, float tileSolidValue)
 {
-	//#TODO: This only currently works with tiles 1x1
-	IntVec2 tileDimensions = IntVec2::ONE;
+	return RaycastVsTileHeatMap(Ray2(startPos, fwrdNormal, maxDist), solidMap, tileSolidValue, TileGrid2D());
+}
+
+RaycastResult2D RaycastVsTileHeatMap(Ray2 const& ray, TileHeatMap const& solidMap, float tileSolidValue)
+{
+	return RaycastVsTileHeatMap(ray, solidMap, tileSolidValue, TileGrid2D());
+}
+
+RaycastResult2D RaycastVsTileHeatMap(Ray2 const& ray, TileHeatMap const& solidMap, float tileSolidValue, TileGrid2D const& grid)
+{
+	Vec2 const& startPos = ray.m_startPos;
+	Vec2 const& fwrdNormal = ray.m_fwrdNormal;
+	float maxDist = ray.m_maxLength;
 
 	RaycastResult2D result;
+	result.m_didImpact = false;
 	result.m_impactDistance = maxDist;
 	result.m_impactPos = startPos + (fwrdNormal * maxDist);
 	result.m_impactNormal = -fwrdNormal;
 
-	result.m_didImpact = false;
 	IntVec2 mapDimensions = solidMap.m_dimensions;
-	IntVec2 tileCoords((int)(floorf(startPos.x)), (int)(floorf(startPos.y)));
-	int tileIndex = (tileCoords.y * mapDimensions.x) + tileCoords.x;
-
-	//Check if starting pos is inside solid tile
-	if (solidMap.m_values[tileIndex] == tileSolidValue)
+	if (mapDimensions.x <= 0 || mapDimensions.y <= 0)
 	{
-		result.m_didImpact = true;
-		result.m_impactDistance = 0.f;
-		result.m_impactNormal = -fwrdNormal;
-		result.m_impactPos = startPos;
 		return result;
 	}
 
-	float fwrdDistPerXCrossing = 1.f / abs(fwrdNormal.x);
-	int tileStepDirectionX = 1;
-	if (fwrdNormal.x < 0.f)
-	{
-		tileStepDirectionX = -1;
-	}
-
-	//X initialization
-	float xAtFirstXCrossing = (float)(tileCoords.x) + (((float)(tileStepDirectionX) + 1.f) * 0.5f);
-	float xDistToFirstXCrossing = xAtFirstXCrossing - startPos.x;
-	float fwrdDistAtNextXCrossing = fabsf(xDistToFirstXCrossing) * fwrdDistPerXCrossing;
-
-	//Y initialization
-	float fwrdDistPerYCrossing = 1.f / abs(fwrdNormal.y);
-	int tileStepDirectionY = 1;
-	if (fwrdNormal.y < 0.f)
+	//crossing distances stay infinite on an axis the ray does not move along
+	float fwrdDistPerUnitX = (fwrdNormal.x != 0.f) ? 1.f / fabsf(fwrdNormal.x) : FLT_MAX;
+	float fwrdDistPerUnitY = (fwrdNormal.y != 0.f) ? 1.f / fabsf(fwrdNormal.y) : FLT_MAX;
+	int tileStepDirectionX = (fwrdNormal.x < 0.f) ? -1 : 1;
+	int tileStepDirectionY = (fwrdNormal.y < 0.f) ? -1 : 1;
+
+	//a ray starting off the map is first moved to where it enters the map
+	Vec2 mapMins = grid.m_worldMins;
+	Vec2 mapMaxs = grid.m_worldMins + Vec2(grid.m_tileDimensions.x * (float)mapDimensions.x, grid.m_tileDimensions.y * (float)mapDimensions.y);
+	float entryDist = 0.f;
+	Vec2 entryNormal = -fwrdNormal;
+	Vec2 entryPos = startPos;
+	bool isStartOnMap = startPos.x >= mapMins.x && startPos.x < mapMaxs.x && startPos.y >= mapMins.y && startPos.y < mapMaxs.y;
+	if (!isStartOnMap)
 	{
-		tileStepDirectionY = -1;
-	}
-
-	float yAtFirstYCrossing = (float)(tileCoords.y) + (((float)(tileStepDirectionY) + 1.f) * 0.5f);
-	float yDistToFirstCrossing = yAtFirstYCrossing - startPos.y;
-	float fwrdDistAtNextYCrossing = fabsf(yDistToFirstCrossing) * fwrdDistPerYCrossing;
-
-	while (true)
-	{
-		//If next x is closer than next y
-		if (fwrdDistAtNextXCrossing <= fwrdDistAtNextYCrossing)
+		float exitDist = maxDist;
+		if (fwrdNormal.x != 0.f)
 		{
-			if (fwrdDistAtNextXCrossing > maxDist)
+			float distToMinX = (mapMins.x - startPos.x) / fwrdNormal.x;
+			float distToMaxX = (mapMaxs.x - startPos.x) / fwrdNormal.x;
+			float xEntryDist = (distToMinX < distToMaxX) ? distToMinX : distToMaxX;
+			float xExitDist = (distToMinX < distToMaxX) ? distToMaxX : distToMinX;
+			if (xExitDist < exitDist)
 			{
-				//ray went past max distance without hitting
-				result.m_didImpact = false;
-				result.m_impactDistance = maxDist;
-				result.m_impactPos = startPos + (fwrdNormal * maxDist);
-				return result;
+				exitDist = xExitDist;
 			}
-
-			tileCoords.x += tileStepDirectionX;
-			tileIndex = (tileCoords.y * mapDimensions.x) + tileCoords.x;
-
-			if (solidMap.m_values[tileIndex] == tileSolidValue)
+			if (xEntryDist > entryDist)
 			{
-				//RaycastHit
-				result.m_didImpact = true;
-				result.m_impactDistance = fwrdDistAtNextXCrossing;
-
-				Vec2 hitPos = startPos + (fwrdNormal * fwrdDistAtNextXCrossing);
-				result.m_impactPos = hitPos;
-
-				AABB2 tileBounds(Vec2(tileCoords), Vec2(tileCoords + tileDimensions));
-				Vec2 nearestPoint = tileBounds.GetNearestPoint(hitPos);
-
-				if (fwrdNormal.x > 0.f)
-					result.m_impactNormal = Vec2(-1.f, 0.f);
-				else if (fwrdNormal.x < 0.f)
-					result.m_impactNormal = Vec2(1.f, 0.f);
-				else
-					ERROR_AND_DIE("Invalid impact normal");
-
-				return result;
+				entryDist = xEntryDist;
+				entryNormal = Vec2(-(float)tileStepDirectionX, 0.f);
 			}
-
-			fwrdDistAtNextXCrossing += fwrdDistPerXCrossing;
+		}
+		else if (startPos.x < mapMins.x || startPos.x >= mapMaxs.x)
+		{
+			return result;
 		}
 
-		else
+		if (fwrdNormal.y != 0.f)
 		{
-			if (fwrdDistAtNextYCrossing > maxDist)
+			float distToMinY = (mapMins.y - startPos.y) / fwrdNormal.y;
+			float distToMaxY = (mapMaxs.y - startPos.y) / fwrdNormal.y;
+			float yEntryDist = (distToMinY < distToMaxY) ? distToMinY : distToMaxY;
+			float yExitDist = (distToMinY < distToMaxY) ? distToMaxY : distToMinY;
+			if (yExitDist < exitDist)
 			{
-				result.m_didImpact = false;
-				result.m_impactDistance = maxDist;
-				result.m_impactPos = startPos + (fwrdNormal * maxDist);
-				return result;
+				exitDist = yExitDist;
 			}
-
-			tileCoords.y += tileStepDirectionY;
-			tileIndex = (tileCoords.y * mapDimensions.x) + tileCoords.x;
-
-			if (solidMap.m_values[tileIndex] == tileSolidValue)
+			if (yEntryDist > entryDist)
 			{
-				//RaycastHit
-				result.m_didImpact = true;
-				result.m_impactDistance = fwrdDistAtNextYCrossing;
-
-				Vec2 hitPos = startPos + (fwrdNormal * fwrdDistAtNextYCrossing);
-				result.m_impactPos = hitPos;
-
-				AABB2 tileBounds(Vec2(tileCoords), Vec2(tileCoords + tileDimensions));
-				Vec2 nearestPoint = tileBounds.GetNearestPoint(hitPos);
-
-				if (fwrdNormal.y > 0.f)
-					result.m_impactNormal = Vec2(0.f, -1.f);
-				else if (fwrdNormal.y < 0.f)
-					result.m_impactNormal = Vec2(0.f, 1.f);
-				else
-					ERROR_AND_DIE("Invalid impact normal");
-
-				return result;
+				entryDist = yEntryDist;
+				entryNormal = Vec2(0.f, -(float)tileStepDirectionY);
 			}
+		}
+		else if (startPos.y < mapMins.y || startPos.y >= mapMaxs.y)
+		{
+			return result;
+		}
 
-			fwrdDistAtNextYCrossing += fwrdDistPerYCrossing;
+		if (entryDist > exitDist || entryDist > maxDist)
+		{
+			return result; //never crosses the map
 		}
+		entryPos = startPos + (fwrdNormal * entryDist);
 	}
 
-
-}
-
-RaycastResult2D RaycastVsTileHeatMap(Ray2 const& ray, TileHeatMap const& solidMap, float tileSolidValue)
-{
-	//#TODO: This only currently works with tiles 1x1
-	IntVec2 tileDimensions = IntVec2::ONE;
-
-	float maxDist = ray.m_maxLength;
-	Vec2 fwrdNormal = ray.m_fwrdNormal;
-	Vec2 startPos = ray.m_startPos;
-
-	RaycastResult2D result;
-	result.m_impactDistance = ray.m_maxLength;
-	result.m_impactPos = ray.m_startPos + (ray.m_fwrdNormal * ray.m_maxLength);
-	result.m_impactNormal = -ray.m_fwrdNormal;
-	result.m_didImpact = false;
-
-	IntVec2 mapDimensions = solidMap.m_dimensions;
-	IntVec2 tileCoords((int)(floorf(startPos.x)), (int)(floorf(startPos.y)));
+	IntVec2 tileCoords((int)(floorf((entryPos.x - grid.m_worldMins.x) / grid.m_tileDimensions.x)), (int)(floorf((entryPos.y - grid.m_worldMins.y) / grid.m_tileDimensions.y)));
+	tileCoords.x = GetClampedInt(tileCoords.x, 0, mapDimensions.x - 1);
+	tileCoords.y = GetClampedInt(tileCoords.y, 0, mapDimensions.y - 1);
 	int tileIndex = (tileCoords.y * mapDimensions.x) + tileCoords.x;
 
-	//Check if starting pos is inside solid tile
+	//Check if starting (or entry) tile is solid
 	if (solidMap.m_values[tileIndex] == tileSolidValue)
 	{
 		result.m_didImpact = true;
-		result.m_impactDistance = 0.f;
-		result.m_impactNormal = -fwrdNormal;
-		result.m_impactPos = startPos;
+		result.m_impactDistance = entryDist;
+		result.m_impactNormal = entryNormal;
+		result.m_impactPos = entryPos;
 		return result;
 	}
 
-	float fwrdDistPerXCrossing = 1.f / abs(fwrdNormal.x);
-	int tileStepDirectionX = 1;
-	if (fwrdNormal.x < 0.f)
-	{
-		tileStepDirectionX = -1;
-	}
-
-	//X initialization
-	float xAtFirstXCrossing = (float)(tileCoords.x) + (((float)(tileStepDirectionX) + 1.f) * 0.5f);
-	float xDistToFirstXCrossing = xAtFirstXCrossing - startPos.x;
-	float fwrdDistAtNextXCrossing = fabsf(xDistToFirstXCrossing) * fwrdDistPerXCrossing;
-
-	//Y initialization
-	float fwrdDistPerYCrossing = 1.f / abs(fwrdNormal.y);
-	int tileStepDirectionY = 1;
-	if (fwrdNormal.y < 0.f)
-	{
-		tileStepDirectionY = -1;
-	}
+	//distances along the ray to the next vertical (x) and horizontal (y) tile edges, measured from the real start
+	float fwrdDistPerXCrossing = grid.m_tileDimensions.x * fwrdDistPerUnitX;
+	float xAtFirstXCrossing = grid.m_worldMins.x + ((float)(tileCoords.x + ((tileStepDirectionX + 1) / 2)) * grid.m_tileDimensions.x);
+	float fwrdDistAtNextXCrossing = (fwrdNormal.x != 0.f) ? fabsf(xAtFirstXCrossing - startPos.x) * fwrdDistPerUnitX : FLT_MAX;
 
-	float yAtFirstYCrossing = (float)(tileCoords.y) + (((float)(tileStepDirectionY) + 1.f) * 0.5f);
-	float yDistToFirstCrossing = yAtFirstYCrossing - startPos.y;
-	float fwrdDistAtNextYCrossing = fabsf(yDistToFirstCrossing) * fwrdDistPerYCrossing;
+	float fwrdDistPerYCrossing = grid.m_tileDimensions.y * fwrdDistPerUnitY;
+	float yAtFirstYCrossing = grid.m_worldMins.y + ((float)(tileCoords.y + ((tileStepDirectionY + 1) / 2)) * grid.m_tileDimensions.y);
+	float fwrdDistAtNextYCrossing = (fwrdNormal.y != 0.f) ? fabsf(yAtFirstYCrossing - startPos.y) * fwrdDistPerUnitY : FLT_MAX;
 
 	while (true)
 	{
 		//If next x is closer than next y
-		if (fwrdDistAtNextXCrossing <= fwrdDistAtNextYCrossing)
+		bool isXCrossing = fwrdDistAtNextXCrossing <= fwrdDistAtNextYCrossing;
+		float fwrdDistAtCrossing = isXCrossing ? fwrdDistAtNextXCrossing : fwrdDistAtNextYCrossing;
+		if (fwrdDistAtCrossing > maxDist)
 		{
-			if (fwrdDistAtNextXCrossing > maxDist)
-			{
-				//ray went past max distance without hitting
-				result.m_didImpact = false;
-				result.m_impactDistance = maxDist;
-				result.m_impactPos = startPos + (fwrdNormal * maxDist);
-				return result;
-			}
+			return result; //ray went past max distance without hitting
+		}
 
+		if (isXCrossing)
+		{
 			tileCoords.x += tileStepDirectionX;
-			tileIndex = (tileCoords.y * mapDimensions.x) + tileCoords.x;
-
-			if (solidMap.m_values[tileIndex] == tileSolidValue)
-			{
-				//RaycastHit
-				result.m_didImpact = true;
-				result.m_impactDistance = fwrdDistAtNextXCrossing;
-
-				Vec2 hitPos = startPos + (fwrdNormal * fwrdDistAtNextXCrossing);
-				result.m_impactPos = hitPos;
-
-				AABB2 tileBounds(Vec2(tileCoords), Vec2(tileCoords + tileDimensions));
-				Vec2 nearestPoint = tileBounds.GetNearestPoint(hitPos);
-
-				if (fwrdNormal.x > 0.f)
-					result.m_impactNormal = Vec2(-1.f, 0.f);
-				else if (fwrdNormal.x < 0.f)
-					result.m_impactNormal = Vec2(1.f, 0.f);
-				else
-					ERROR_AND_DIE("Invalid impact normal");
-
-				return result;
-			}
-
 			fwrdDistAtNextXCrossing += fwrdDistPerXCrossing;
 		}
-
 		else
 		{
-			if (fwrdDistAtNextYCrossing > maxDist)
-			{
-				result.m_didImpact = false;
-				result.m_impactDistance = maxDist;
-				result.m_impactPos = startPos + (fwrdNormal * maxDist);
-				return result;
-			}
-
 			tileCoords.y += tileStepDirectionY;
-			tileIndex = (tileCoords.y * mapDimensions.x) + tileCoords.x;
-
-			if (solidMap.m_values[tileIndex] == tileSolidValue)
-			{
-				//RaycastHit
-				result.m_didImpact = true;
-				result.m_impactDistance = fwrdDistAtNextYCrossing;
-
-				Vec2 hitPos = startPos + (fwrdNormal * fwrdDistAtNextYCrossing);
-				result.m_impactPos = hitPos;
-
-				AABB2 tileBounds(Vec2(tileCoords), Vec2(tileCoords + tileDimensions));
-				Vec2 nearestPoint = tileBounds.GetNearestPoint(hitPos);
-
-				if (fwrdNormal.y > 0.f)
-					result.m_impactNormal = Vec2(0.f, -1.f);
-				else if (fwrdNormal.y < 0.f)
-					result.m_impactNormal = Vec2(0.f, 1.f);
-				else
-					ERROR_AND_DIE("Invalid impact normal");
+			fwrdDistAtNextYCrossing += fwrdDistPerYCrossing;
+		}
 
-				return result;
-			}
+		if (tileCoords.x < 0 || tileCoords.x >= mapDimensions.x || tileCoords.y < 0 || tileCoords.y >= mapDimensions.y)
+		{
+			return result; //left the map, nothing more to hit
+		}
 
-			fwrdDistAtNextYCrossing += fwrdDistPerYCrossing;
+		tileIndex = (tileCoords.y * mapDimensions.x) + tileCoords.x;
+		if (solidMap.m_values[tileIndex] == tileSolidValue)
+		{
+			//RaycastHit
+			result.m_didImpact = true;
+			result.m_impactDistance = fwrdDistAtCrossing;
+			result.m_impactPos = startPos + (fwrdNormal * fwrdDistAtCrossing);
+			result.m_impactNormal = isXCrossing ? Vec2(-(float)tileStepDirectionX, 0.f) : Vec2(0.f, -(float)tileStepDirectionY);
+			return result;
 		}
 	}
 }
@@ -2287,6 +2199,56 @@ RaycastResult3D RaycastVsPlane3D(Ray3 const& ray, Plane3D const& plane)
 	return result;
 }
 
+RaycastResult3D RaycastVsTriangle3D(Ray3 const& ray, Vec3 const& vertA, Vec3 const& vertB, Vec3 const& vertC)
+{
+	RaycastResult3D result;
+	result.m_didImpact = false;
+	result.m_impactDistance = ray.m_maxLength;
+	result.m_impactNormal = ray.m_fwrdNormal;
+	result.m_impactPos = ray.m_startPos + (ray.m_fwrdNormal * ray.m_maxLength);
+
+	//Moller-Trumbore, solves start + fwrd * t = A + u * AB + v * AC
+	Vec3 edgeAB = vertB - vertA;
+	Vec3 edgeAC = vertC - vertA;
+	Vec3 fwrdCrossAC = CrossProduct3D(ray.m_fwrdNormal, edgeAC);
+	float determinant = DotProduct3D(edgeAB, fwrdCrossAC);
+	if (fabsf(determinant) < 1e-12f)
+	{
+		return result; //ray is parallel to the triangle (or the triangle is degenerate)
+	}
+
+	float invDeterminant = 1.f / determinant;
+	Vec3 aToStart = ray.m_startPos - vertA;
+	float u = DotProduct3D(aToStart, fwrdCrossAC) * invDeterminant;
+	if (u < 0.f || u > 1.f)
+	{
+		return result;
+	}
+
+	Vec3 startCrossAB = CrossProduct3D(aToStart, edgeAB);
+	float v = DotProduct3D(ray.m_fwrdNormal, startCrossAB) * invDeterminant;
+	if (v < 0.f || u + v > 1.f)
+	{
+		return result;
+	}
+
+	float impactDist = DotProduct3D(edgeAC, startCrossAB) * invDeterminant;
+	if (impactDist < 0.f || impactDist >= ray.m_maxLength)
+	{
+		return result;
+	}
+
+	result.m_didImpact = true;
+	result.m_impactDistance = impactDist;
+	result.m_impactPos = ray.m_startPos + (ray.m_fwrdNormal * impactDist);
+	result.m_impactNormal = CrossProduct3D(edgeAB, edgeAC).GetNormalized();
+	if (DotProduct3D(result.m_impactNormal, ray.m_fwrdNormal) > 0.f)
+	{
+		result.m_impactNormal = -result.m_impactNormal;
+	}
+	return result;
+}
+
 float ComputeCubicBezier1D(float A, float B, float C, float D, float t)
 {
 	float aB = Lerp(A, B, t);
@@ -37,6 +37,13 @@ struct RaycastResult2D
 	Vec2 m_impactNormal;
 };
 
+//world placement of a tile map: tile (0,0) has its mins at m_worldMins, every tile is m_tileDimensions big
+struct TileGrid2D
+{
+	Vec2 m_worldMins = Vec2(0.f, 0.f);
+	Vec2 m_tileDimensions = Vec2(1.f, 1.f);
+};
+
 struct Ray3
 {
 	Ray3() {}
@@ -93,6 +100,8 @@ float CosDegrees(float degrees);
 float SinDegrees(float degrees);
 float TanDegrees(float degrees);
 float Atan2Degrees(float y, float x);
+void SinCosDegrees(float degrees, float& out_sin, float& out_cos);		//uses FastSinCosDegrees when ENGINE_FAST_TRIG is defined
+void SinCosRadians(float radians, float& out_sin, float& out_cos);
 float AsinDegrees(float x);
 float AcosDegrees(float x);
 float GetShortestAngularDispDegrees(float startDegrees, float endDegrees);
@@ -213,6 +222,7 @@ RaycastResult2D RaycastVsDisc2D(Vec2 const& startPos, Vec2 const& fwrdNormal, fl
 RaycastResult2D RaycastVsDisc2D(Vec2 const& startPos, Vec2 const& fwrdNormal, float maxDist, Disc2 const& disc);
 RaycastResult2D RaycastVsTileHeatMap(Vec2 const& startPos, Vec2 const& fwrdNormal, float maxDist, TileHeatMap const& solidMap, float tileSolidValue);
 RaycastResult2D RaycastVsTileHeatMap(Ray2 const& ray, TileHeatMap const& solidMap, float tileSolidValue);
+RaycastResult2D RaycastVsTileHeatMap(Ray2 const& ray, TileHeatMap const& solidMap, float tileSolidValue, TileGrid2D const& grid); //tiles outside the map count as open
 RaycastResult2D RaycastVsLineSegment2D(Ray2 const& ray, LineSegment2 const& lineSegment);
 RaycastResult2D RaycastVsAABB2D(Ray2 const& ray, AABB2 const& alignedBox);
 RaycastResult2D RaycastVsOBB2D(Ray2 const& ray, OBB2 const& orientedBox);
@@ -223,6 +233,7 @@ RaycastResult3D RaycastVsAABB3D(Vec3 const& startPos, Vec3 const& fwrdNormal, fl
 RaycastResult3D RaycastVsOBB3D(Ray3 const& ray, OBB3 const& orientedBox);
 RaycastResult3D RaycastVsZCylinder3D(Ray3 const& ray, ZCylinder3D const& cylinder);
 RaycastResult3D RaycastVsPlane3D(Ray3 const& ray, Plane3D const& plane);
+RaycastResult3D RaycastVsTriangle3D(Ray3 const& ray, Vec3 const& vertA, Vec3 const& vertB, Vec3 const& vertC); //double sided, normal faces the ray start
 
 //--------------------------------------------------------------------
 //Curves
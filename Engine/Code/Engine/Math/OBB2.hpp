@@ -9,7 +9,6 @@ public:
 
 public:
 	OBB2() {}
-	~OBB2() {}
 	explicit OBB2(Vec2 const& center, Vec2 const& iBasisNormal, Vec2 const& halfDimensionsIJ);
 
 	void const GetCornerPoints(Vec2* out_forCornerWorldPositions) const;
@@ -11,7 +11,6 @@ public:
 	Vec3 m_kBasis;
 
 	OBB3() {};
-	~OBB3() {};
 	explicit OBB3(Vec3 const& center, Vec3 const& halfDimensions, Vec3 const& iBasis, Vec3 const& jBasis, Vec3 const& kBasis);
 	explicit OBB3(Vec3 const& center, Vec3 const& halfDimensions, EulerAngles const& orientation);
 
@@ -0,0 +1,593 @@
+#include "Engine/Math/PhysicsWorld2D.hpp"
+#include "Engine/Math/OBB2.hpp"
+#include "Engine/Math/Capsule2.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/ThreadPool.hpp"
+#include <algorithm>
+#include <math.h>
+
+//-----------------------------------------------------------------------------------------------
+static uint64_t GetContactKey(PhysicsContact2D const& contact)
+{
+	return (static_cast<uint64_t>(static_cast<unsigned int>(contact.m_bodyIdA)) << 32) | static_cast<unsigned int>(contact.m_bodyIdB);
+}
+
+static bool IsContactKeyLess(PhysicsContact2D const& contactA, PhysicsContact2D const& contactB)
+{
+	return GetContactKey(contactA) < GetContactKey(contactB);
+}
+
+static OBB2 GetOBBForBody(PhysicsBody2D const& body)
+{
+	return OBB2(body.m_position, Vec2::MakeFromPolarDegrees(body.m_orientationDegrees), body.m_halfDimensions);
+}
+
+static Capsule2 GetCapsuleForBody(PhysicsBody2D const& body)
+{
+	Vec2 halfBone = Vec2::MakeFromPolarDegrees(body.m_orientationDegrees, body.m_boneHalfLength);
+	return Capsule2(body.m_position - halfBone, body.m_position + halfBone, body.m_radius);
+}
+
+//-----------------------------------------------------------------------------------------------
+// narrow phase, all normals point from A toward the disc B
+//
+static bool ComputeDiscVsDiscContact(Vec2 const& centerA, float radiusA, Vec2 const& centerB, float radiusB, Vec2 const& fallbackNormal, PhysicsContact2D& contact)
+{
+	Vec2 displacement = centerB - centerA;
+	float combinedRadius = radiusA + radiusB;
+	float distanceSquared = displacement.GetLengthSquared();
+	if (distanceSquared >= combinedRadius * combinedRadius)
+	{
+		return false;
+	}
+
+	float distance = sqrtf(distanceSquared);
+	contact.m_normal = (distance > 0.f) ? (displacement / distance) : fallbackNormal;
+	contact.m_penetration = combinedRadius - distance;
+	contact.m_point = centerA + (contact.m_normal * (radiusA - (0.5f * contact.m_penetration)));
+	return true;
+}
+
+static bool ComputeOBBVsDiscContact(OBB2 const& box, Vec2 const& discCenter, float discRadius, PhysicsContact2D& contact)
+{
+	Vec2 jBasisNormal = box.m_iBasisNormal.GetRotated90Degrees();
+	Vec2 displacement = discCenter - box.m_center;
+	float localX = DotProduct2D(displacement, box.m_iBasisNormal);
+	float localY = DotProduct2D(displacement, jBasisNormal);
+	float halfWidth = box.m_halfDimensionsIJ.x;
+	float halfHeight = box.m_halfDimensionsIJ.y;
+
+	float nearestX = GetClamped(localX, -halfWidth, halfWidth);
+	float nearestY = GetClamped(localY, -halfHeight, halfHeight);
+	float localNormalX = 0.f;
+	float localNormalY = 0.f;
+	if (nearestX == localX && nearestY == localY)
+	{
+		//center is inside, push out through the nearest face
+		float gapX = halfWidth - fabsf(localX);
+		float gapY = halfHeight - fabsf(localY);
+		if (gapX < gapY)
+		{
+			localNormalX = (localX >= 0.f) ? 1.f : -1.f;
+			nearestX = localNormalX * halfWidth;
+			contact.m_penetration = discRadius + gapX;
+		}
+		else
+		{
+			localNormalY = (localY >= 0.f) ? 1.f : -1.f;
+			nearestY = localNormalY * halfHeight;
+			contact.m_penetration = discRadius + gapY;
+		}
+	}
+	else
+	{
+		float offsetX = localX - nearestX;
+		float offsetY = localY - nearestY;
+		float distanceSquared = (offsetX * offsetX) + (offsetY * offsetY);
+		if (distanceSquared >= discRadius * discRadius)
+		{
+			return false;
+		}
+
+		float distance = sqrtf(distanceSquared);
+		localNormalX = offsetX / distance;
+		localNormalY = offsetY / distance;
+		contact.m_penetration = discRadius - distance;
+	}
+
+	contact.m_normal = (box.m_iBasisNormal * localNormalX) + (jBasisNormal * localNormalY);
+	contact.m_point = box.m_center + (box.m_iBasisNormal * nearestX) + (jBasisNormal * nearestY);
+	return true;
+}
+
+static bool ComputeCapsuleVsDiscContact(Capsule2 const& capsule, Vec2 const& discCenter, float discRadius, PhysicsContact2D& contact)
+{
+	Vec2 nearestOnBone = GetNearestPointOnLineSegment(discCenter, capsule.m_start, capsule.m_end);
+	Vec2 boneNormal = (capsule.m_end - capsule.m_start).GetRotated90Degrees().GetNormalized();
+	if (boneNormal == Vec2::ZERO)
+	{
+		boneNormal = Vec2(0.f, 1.f);
+	}
+	return ComputeDiscVsDiscContact(nearestOnBone, capsule.m_radius, discCenter, discRadius, boneNormal, contact);
+}
+
+//-----------------------------------------------------------------------------------------------
+PhysicsWorld2D::PhysicsWorld2D(PhysicsWorld2DConfig const& config)
+	:m_config(config)
+	,m_broadphase(config.m_broadphaseConfig)
+{
+	m_islandContactStarts.push_back(0);
+}
+
+int PhysicsWorld2D::CreateBody(PhysicsBody2D const& body)
+{
+	GUARANTEE_OR_DIE(body.m_inverseMass == 0.f || body.m_shapeType == PhysicsShapeType2D::DISC, "PhysicsWorld2D only supports mass on disc bodies");
+
+	int bodyId = -1;
+	if (!m_freeBodyIds.empty())
+	{
+		bodyId = m_freeBodyIds.back();
+		m_freeBodyIds.pop_back();
+		m_bodies[bodyId] = body;
+	}
+	else
+	{
+		bodyId = (int)m_bodies.size();
+		m_bodies.push_back(body);
+		m_bodyInfos.push_back(BodyInfo());
+	}
+
+	BodyInfo& info = m_bodyInfos[bodyId];
+	info.m_isAlive = true;
+	info.m_proxyId = m_broadphase.CreateProxy(GetBodyBounds(body), reinterpret_cast<void*>(static_cast<intptr_t>(bodyId)));
+	++m_numBodies;
+	return bodyId;
+}
+
+void PhysicsWorld2D::DestroyBody(int bodyId)
+{
+	GUARANTEE_OR_DIE(bodyId >= 0 && bodyId < (int)m_bodies.size() && m_bodyInfos[bodyId].m_isAlive, "PhysicsWorld2D::DestroyBody called with an invalid body id");
+
+	BodyInfo& info = m_bodyInfos[bodyId];
+	m_broadphase.DestroyProxy(info.m_proxyId);
+	info.m_proxyId = -1;
+	info.m_isAlive = false;
+	m_freeBodyIds.push_back(bodyId);
+	--m_numBodies;
+
+	//the id may be reused, so do not let a new body warm start from this one's contacts
+	m_contacts.erase(std::remove_if(m_contacts.begin(), m_contacts.end(), [bodyId](PhysicsContact2D const& contact)
+		{
+			return contact.m_bodyIdA == bodyId || contact.m_bodyIdB == bodyId;
+		}), m_contacts.end());
+
+	//the islands index into m_contacts, which just shifted; Step rebuilds them before they are used again
+	m_islandContacts.clear();
+	m_islandContactStarts.clear();
+	m_islandContactStarts.push_back(0);
+}
+
+void PhysicsWorld2D::Clear()
+{
+	m_bodies.clear();
+	m_bodyInfos.clear();
+	m_freeBodyIds.clear();
+	m_numBodies = 0;
+	m_broadphase.Clear();
+	m_contacts.clear();
+	m_previousContacts.clear();
+	m_islandContacts.clear();
+	m_islandContactStarts.clear();
+	m_islandContactStarts.push_back(0);
+}
+
+PhysicsBody2D& PhysicsWorld2D::GetBody(int bodyId)
+{
+	GUARANTEE_OR_DIE(bodyId >= 0 && bodyId < (int)m_bodies.size() && m_bodyInfos[bodyId].m_isAlive, "PhysicsWorld2D::GetBody called with an invalid body id");
+	return m_bodies[bodyId];
+}
+
+PhysicsBody2D const& PhysicsWorld2D::GetBody(int bodyId) const
+{
+	GUARANTEE_OR_DIE(bodyId >= 0 && bodyId < (int)m_bodies.size() && m_bodyInfos[bodyId].m_isAlive, "PhysicsWorld2D::GetBody called with an invalid body id");
+	return m_bodies[bodyId];
+}
+
+//-----------------------------------------------------------------------------------------------
+void PhysicsWorld2D::Step(float deltaSeconds, ThreadPool* threadPool)
+{
+	if (deltaSeconds <= 0.f)
+	{
+		return;
+	}
+
+	for (int bodyId = 0; bodyId < (int)m_bodies.size(); ++bodyId)
+	{
+		PhysicsBody2D& body = m_bodies[bodyId];
+		if (m_bodyInfos[bodyId].m_isAlive && body.m_inverseMass > 0.f)
+		{
+			body.m_velocity += m_config.m_gravity * deltaSeconds;
+		}
+	}
+
+	UpdateBroadphase(deltaSeconds);
+	FindContacts();
+	BuildIslands();
+
+	int numIslands = GetNumIslands();
+	if (threadPool && numIslands > 1)
+	{
+		threadPool->ParallelFor(numIslands, [this](int beginIndex, int endIndex)
+			{
+				for (int islandIndex = beginIndex; islandIndex < endIndex; ++islandIndex)
+				{
+					SolveIslandVelocities(islandIndex);
+				}
+			});
+	}
+	else
+	{
+		for (int islandIndex = 0; islandIndex < numIslands; ++islandIndex)
+		{
+			SolveIslandVelocities(islandIndex);
+		}
+	}
+
+	for (int bodyId = 0; bodyId < (int)m_bodies.size(); ++bodyId)
+	{
+		PhysicsBody2D& body = m_bodies[bodyId];
+		if (m_bodyInfos[bodyId].m_isAlive)
+		{
+			body.m_position += body.m_velocity * deltaSeconds;
+		}
+	}
+
+	if (threadPool && numIslands > 1)
+	{
+		threadPool->ParallelFor(numIslands, [this](int beginIndex, int endIndex)
+			{
+				for (int islandIndex = beginIndex; islandIndex < endIndex; ++islandIndex)
+				{
+					SolveIslandPositions(islandIndex);
+				}
+			});
+	}
+	else
+	{
+		for (int islandIndex = 0; islandIndex < numIslands; ++islandIndex)
+		{
+			SolveIslandPositions(islandIndex);
+		}
+	}
+}
+
+void PhysicsWorld2D::UpdateBroadphase(float deltaSeconds)
+{
+	for (int bodyId = 0; bodyId < (int)m_bodies.size(); ++bodyId)
+	{
+		BodyInfo const& info = m_bodyInfos[bodyId];
+		if (info.m_isAlive)
+		{
+			PhysicsBody2D const& body = m_bodies[bodyId];
+			m_broadphase.MoveProxy(info.m_proxyId, GetBodyBounds(body), body.m_velocity * deltaSeconds);
+		}
+	}
+}
+
+void PhysicsWorld2D::FindContacts()
+{
+	m_overlappingPairs.clear();
+	m_broadphase.GetAllOverlappingPairs(m_overlappingPairs);
+
+	std::swap(m_contacts, m_previousContacts);
+	m_contacts.clear();
+	for (std::pair<int, int> const& proxyPair : m_overlappingPairs)
+	{
+		int bodyIdA = static_cast<int>(reinterpret_cast<intptr_t>(m_broadphase.GetUserData(proxyPair.first)));
+		int bodyIdB = static_cast<int>(reinterpret_cast<intptr_t>(m_broadphase.GetUserData(proxyPair.second)));
+		PhysicsBody2D const* bodyA = &m_bodies[bodyIdA];
+		PhysicsBody2D const* bodyB = &m_bodies[bodyIdB];
+		if (bodyA->m_inverseMass == 0.f && bodyB->m_inverseMass == 0.f)
+		{
+			continue;
+		}
+
+		//B is always a disc; two discs are ordered by id so the key is stable from step to step
+		bool isDiscA = bodyA->m_shapeType == PhysicsShapeType2D::DISC;
+		bool isDiscB = bodyB->m_shapeType == PhysicsShapeType2D::DISC;
+		if (!isDiscA && !isDiscB)
+		{
+			continue;
+		}
+		if ((isDiscA && !isDiscB) || (isDiscA && isDiscB && bodyIdA > bodyIdB))
+		{
+			std::swap(bodyIdA, bodyIdB);
+		}
+
+		PhysicsContact2D contact;
+		contact.m_bodyIdA = bodyIdA;
+		contact.m_bodyIdB = bodyIdB;
+		if (ComputeContact(contact))
+		{
+			m_contacts.push_back(contact);
+		}
+	}
+	std::sort(m_contacts.begin(), m_contacts.end(), IsContactKeyLess);
+
+	//both lists are sorted by key, so carrying impulses over is a single merge
+	if (m_config.m_enableWarmStarting)
+	{
+		size_t previousIndex = 0;
+		for (PhysicsContact2D& contact : m_contacts)
+		{
+			uint64_t key = GetContactKey(contact);
+			while (previousIndex < m_previousContacts.size() && GetContactKey(m_previousContacts[previousIndex]) < key)
+			{
+				++previousIndex;
+			}
+			if (previousIndex < m_previousContacts.size() && GetContactKey(m_previousContacts[previousIndex]) == key)
+			{
+				contact.m_normalImpulse = m_previousContacts[previousIndex].m_normalImpulse;
+				contact.m_tangentImpulse = m_previousContacts[previousIndex].m_tangentImpulse;
+			}
+		}
+	}
+}
+
+//union find over bodies joined by contacts between two moving bodies; fixed bodies never join islands
+static int FindIslandRoot(std::vector<int>& parents, int bodyId)
+{
+	while (parents[bodyId] != bodyId)
+	{
+		parents[bodyId] = parents[parents[bodyId]];
+		bodyId = parents[bodyId];
+	}
+	return bodyId;
+}
+
+void PhysicsWorld2D::BuildIslands()
+{
+	int numBodySlots = (int)m_bodies.size();
+	m_islandParents.resize(numBodySlots);
+	for (int bodyId = 0; bodyId < numBodySlots; ++bodyId)
+	{
+		m_islandParents[bodyId] = bodyId;
+	}
+
+	for (PhysicsContact2D const& contact : m_contacts)
+	{
+		if (m_bodies[contact.m_bodyIdA].m_inverseMass > 0.f && m_bodies[contact.m_bodyIdB].m_inverseMass > 0.f)
+		{
+			int rootA = FindIslandRoot(m_islandParents, contact.m_bodyIdA);
+			int rootB = FindIslandRoot(m_islandParents, contact.m_bodyIdB);
+			if (rootA != rootB)
+			{
+				m_islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+			}
+		}
+	}
+
+	//number islands in order of their first contact, then bucket contacts keeping their sorted order
+	std::vector<int> islandIndexForRoot(numBodySlots, -1);
+	std::vector<int> contactIslandIndexes(m_contacts.size());
+	int numIslands = 0;
+	for (int contactIndex = 0; contactIndex < (int)m_contacts.size(); ++contactIndex)
+	{
+		PhysicsContact2D const& contact = m_contacts[contactIndex];
+		int movingBodyId = (m_bodies[contact.m_bodyIdA].m_inverseMass > 0.f) ? contact.m_bodyIdA : contact.m_bodyIdB;
+		int root = FindIslandRoot(m_islandParents, movingBodyId);
+		if (islandIndexForRoot[root] < 0)
+		{
+			islandIndexForRoot[root] = numIslands++;
+		}
+		contactIslandIndexes[contactIndex] = islandIndexForRoot[root];
+	}
+
+	m_islandContactStarts.assign(numIslands + 1, 0);
+	for (int islandIndex : contactIslandIndexes)
+	{
+		++m_islandContactStarts[islandIndex + 1];
+	}
+	for (int islandIndex = 0; islandIndex < numIslands; ++islandIndex)
+	{
+		m_islandContactStarts[islandIndex + 1] += m_islandContactStarts[islandIndex];
+	}
+
+	std::vector<int> islandFillCounts(m_islandContactStarts.begin(), m_islandContactStarts.end() - 1);
+	m_islandContacts.resize(m_contacts.size());
+	for (int contactIndex = 0; contactIndex < (int)m_contacts.size(); ++contactIndex)
+	{
+		m_islandContacts[islandFillCounts[contactIslandIndexes[contactIndex]]++] = contactIndex;
+	}
+	m_constraints.resize(m_contacts.size());
+}
+
+//-----------------------------------------------------------------------------------------------
+void PhysicsWorld2D::SolveIslandVelocities(int islandIndex)
+{
+	int contactsBegin = m_islandContactStarts[islandIndex];
+	int contactsEnd = m_islandContactStarts[islandIndex + 1];
+
+	//closing speeds are all read before any warm start impulse is applied, so the bounce does not depend on contact order
+	for (int islandContactIndex = contactsBegin; islandContactIndex < contactsEnd; ++islandContactIndex)
+	{
+		int contactIndex = m_islandContacts[islandContactIndex];
+		PhysicsContact2D const& contact = m_contacts[contactIndex];
+		ContactConstraint& constraint = m_constraints[contactIndex];
+		PhysicsBody2D const& bodyA = m_bodies[contact.m_bodyIdA];
+		PhysicsBody2D const& bodyB = m_bodies[contact.m_bodyIdB];
+
+		float inverseMassSum = bodyA.m_inverseMass + bodyB.m_inverseMass;
+		constraint.m_tangent = contact.m_normal.GetRotated90Degrees();
+		constraint.m_normalMass = 1.f / inverseMassSum;
+		constraint.m_tangentMass = constraint.m_normalMass;
+		constraint.m_friction = sqrtf(bodyA.m_friction * bodyB.m_friction);
+
+		float closingSpeed = DotProduct2D(bodyB.m_velocity - bodyA.m_velocity, contact.m_normal);
+		float elasticity = bodyA.m_elasticity * bodyB.m_elasticity;
+		constraint.m_bounceSpeed = (closingSpeed < -m_config.m_restitutionThreshold) ? (-elasticity * closingSpeed) : 0.f;
+	}
+
+	//fixed bodies can touch several islands at once, so only moving bodies are ever written to
+	for (int islandContactIndex = contactsBegin; islandContactIndex < contactsEnd; ++islandContactIndex)
+	{
+		int contactIndex = m_islandContacts[islandContactIndex];
+		PhysicsContact2D& contact = m_contacts[contactIndex];
+		ContactConstraint const& constraint = m_constraints[contactIndex];
+		PhysicsBody2D& bodyA = m_bodies[contact.m_bodyIdA];
+		PhysicsBody2D& bodyB = m_bodies[contact.m_bodyIdB];
+
+		if (!m_config.m_enableWarmStarting)
+		{
+			contact.m_normalImpulse = 0.f;
+			contact.m_tangentImpulse = 0.f;
+			continue;
+		}
+
+		Vec2 impulse = (contact.m_normal * contact.m_normalImpulse) + (constraint.m_tangent * contact.m_tangentImpulse);
+		if (bodyA.m_inverseMass > 0.f)
+		{
+			bodyA.m_velocity -= impulse * bodyA.m_inverseMass;
+		}
+		if (bodyB.m_inverseMass > 0.f)
+		{
+			bodyB.m_velocity += impulse * bodyB.m_inverseMass;
+		}
+	}
+
+	for (int iteration = 0; iteration < m_config.m_numVelocityIterations; ++iteration)
+	{
+		for (int islandContactIndex = contactsBegin; islandContactIndex < contactsEnd; ++islandContactIndex)
+		{
+			int contactIndex = m_islandContacts[islandContactIndex];
+			PhysicsContact2D& contact = m_contacts[contactIndex];
+			ContactConstraint const& constraint = m_constraints[contactIndex];
+			PhysicsBody2D& bodyA = m_bodies[contact.m_bodyIdA];
+			PhysicsBody2D& bodyB = m_bodies[contact.m_bodyIdB];
+
+			//friction first, bounded by the current normal impulse
+			float tangentSpeed = DotProduct2D(bodyB.m_velocity - bodyA.m_velocity, constraint.m_tangent);
+			float maxFriction = constraint.m_friction * contact.m_normalImpulse;
+			float newTangentImpulse = GetClamped(contact.m_tangentImpulse - (constraint.m_tangentMass * tangentSpeed), -maxFriction, maxFriction);
+			float tangentImpulseDelta = newTangentImpulse - contact.m_tangentImpulse;
+			contact.m_tangentImpulse = newTangentImpulse;
+
+			Vec2 frictionImpulse = constraint.m_tangent * tangentImpulseDelta;
+			if (bodyA.m_inverseMass > 0.f)
+			{
+				bodyA.m_velocity -= frictionImpulse * bodyA.m_inverseMass;
+			}
+			if (bodyB.m_inverseMass > 0.f)
+			{
+				bodyB.m_velocity += frictionImpulse * bodyB.m_inverseMass;
+			}
+
+			//contacts can only push, so the accumulated normal impulse is kept non-negative
+			float normalSpeed = DotProduct2D(bodyB.m_velocity - bodyA.m_velocity, contact.m_normal);
+			float newNormalImpulse = fmaxf(contact.m_normalImpulse - (constraint.m_normalMass * normalSpeed), 0.f);
+			float normalImpulseDelta = newNormalImpulse - contact.m_normalImpulse;
+			contact.m_normalImpulse = newNormalImpulse;
+
+			Vec2 normalImpulse = contact.m_normal * normalImpulseDelta;
+			if (bodyA.m_inverseMass > 0.f)
+			{
+				bodyA.m_velocity -= normalImpulse * bodyA.m_inverseMass;
+			}
+			if (bodyB.m_inverseMass > 0.f)
+			{
+				bodyB.m_velocity += normalImpulse * bodyB.m_inverseMass;
+			}
+		}
+	}
+
+	//bounce once the contacts are resolved, so a body pressed into several others does not gain energy from each of them
+	for (int islandContactIndex = contactsBegin; islandContactIndex < contactsEnd; ++islandContactIndex)
+	{
+		int contactIndex = m_islandContacts[islandContactIndex];
+		PhysicsContact2D& contact = m_contacts[contactIndex];
+		ContactConstraint const& constraint = m_constraints[contactIndex];
+		if (constraint.m_bounceSpeed <= 0.f || contact.m_normalImpulse <= 0.f)
+		{
+			continue;
+		}
+
+		PhysicsBody2D& bodyA = m_bodies[contact.m_bodyIdA];
+		PhysicsBody2D& bodyB = m_bodies[contact.m_bodyIdB];
+		float normalSpeed = DotProduct2D(bodyB.m_velocity - bodyA.m_velocity, contact.m_normal);
+		float newNormalImpulse = fmaxf(contact.m_normalImpulse - (constraint.m_normalMass * (normalSpeed - constraint.m_bounceSpeed)), 0.f);
+		float normalImpulseDelta = newNormalImpulse - contact.m_normalImpulse;
+		contact.m_normalImpulse = newNormalImpulse;
+
+		Vec2 normalImpulse = contact.m_normal * normalImpulseDelta;
+		if (bodyA.m_inverseMass > 0.f)
+		{
+			bodyA.m_velocity -= normalImpulse * bodyA.m_inverseMass;
+		}
+		if (bodyB.m_inverseMass > 0.f)
+		{
+			bodyB.m_velocity += normalImpulse * bodyB.m_inverseMass;
+		}
+	}
+}
+
+void PhysicsWorld2D::SolveIslandPositions(int islandIndex)
+{
+	int contactsBegin = m_islandContactStarts[islandIndex];
+	int contactsEnd = m_islandContactStarts[islandIndex + 1];
+	for (int iteration = 0; iteration < m_config.m_numPositionIterations; ++iteration)
+	{
+		for (int islandContactIndex = contactsBegin; islandContactIndex < contactsEnd; ++islandContactIndex)
+		{
+			PhysicsContact2D const& contact = m_contacts[m_islandContacts[islandContactIndex]];
+			PhysicsContact2D currentContact;
+			currentContact.m_bodyIdA = contact.m_bodyIdA;
+			currentContact.m_bodyIdB = contact.m_bodyIdB;
+			if (!ComputeContact(currentContact))
+			{
+				continue;
+			}
+
+			float correction = GetClamped(m_config.m_baumgarteFactor * (currentContact.m_penetration - m_config.m_linearSlop), 0.f, m_config.m_maxLinearCorrection);
+			if (correction <= 0.f)
+			{
+				continue;
+			}
+
+			PhysicsBody2D& bodyA = m_bodies[contact.m_bodyIdA];
+			PhysicsBody2D& bodyB = m_bodies[contact.m_bodyIdB];
+			Vec2 push = currentContact.m_normal * (correction / (bodyA.m_inverseMass + bodyB.m_inverseMass));
+			if (bodyA.m_inverseMass > 0.f)
+			{
+				bodyA.m_position -= push * bodyA.m_inverseMass;
+			}
+			if (bodyB.m_inverseMass > 0.f)
+			{
+				bodyB.m_position += push * bodyB.m_inverseMass;
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+bool PhysicsWorld2D::ComputeContact(PhysicsContact2D& contact) const
+{
+	PhysicsBody2D const& bodyA = m_bodies[contact.m_bodyIdA];
+	PhysicsBody2D const& bodyB = m_bodies[contact.m_bodyIdB];
+	switch (bodyA.m_shapeType)
+	{
+	case PhysicsShapeType2D::DISC:		return ComputeDiscVsDiscContact(bodyA.m_position, bodyA.m_radius, bodyB.m_position, bodyB.m_radius, Vec2(1.f, 0.f), contact);
+	case PhysicsShapeType2D::OBB:		return ComputeOBBVsDiscContact(GetOBBForBody(bodyA), bodyB.m_position, bodyB.m_radius, contact);
+	case PhysicsShapeType2D::CAPSULE:	return ComputeCapsuleVsDiscContact(GetCapsuleForBody(bodyA), bodyB.m_position, bodyB.m_radius, contact);
+	default:							return false;
+	}
+}
+
+AABB2 PhysicsWorld2D::GetBodyBounds(PhysicsBody2D const& body) const
+{
+	switch (body.m_shapeType)
+	{
+	case PhysicsShapeType2D::OBB:		return GetBoundsForOBB2D(GetOBBForBody(body));
+	case PhysicsShapeType2D::CAPSULE:	return GetBoundsForCapsule2D(GetCapsuleForBody(body));
+	default:							return GetBoundsForDisc2D(body.m_position, body.m_radius);
+	}
+}
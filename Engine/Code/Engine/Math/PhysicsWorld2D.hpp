@@ -0,0 +1,126 @@
+#pragma once
+#include "Engine/Math/DynamicAABBTree2D.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include <stdint.h>
+#include <vector>
+class ThreadPool;
+
+//-----------------------------------------------------------------------------------------------
+// 2D rigid body step for crowds of discs bouncing off each other and off fixed OBBs and capsules
+//	contacts come from a DynamicAABBTree2D broadphase, are split into islands of touching bodies, and each island runs
+//	a sequential impulse solver (warm started from last step's impulses) followed by a few position correction passes
+//	islands share no moving bodies, so they are solved in parallel when a thread pool is given; results do not
+//	depend on the number of threads
+//	the same shape pairs as the Bounce* functions in MathUtils: only discs can have mass, and bodies do not rotate
+//
+enum class PhysicsShapeType2D
+{
+	DISC,
+	OBB,
+	CAPSULE,
+	COUNT
+};
+
+struct PhysicsBody2D
+{
+	PhysicsShapeType2D	m_shapeType = PhysicsShapeType2D::DISC;
+	Vec2				m_position;
+	Vec2				m_velocity;					//fixed bodies with a velocity are moved but never pushed (kinematic)
+	float				m_orientationDegrees = 0.f;	//OBB and capsule only
+	float				m_radius = 1.f;				//disc and capsule
+	Vec2				m_halfDimensions = Vec2(1.f, 1.f);	//OBB
+	float				m_boneHalfLength = 1.f;		//capsule, along its orientation
+	float				m_inverseMass = 0.f;		//0 for fixed bodies
+	float				m_elasticity = 1.f;			//multiplied with the other body's, like combinedElasticity
+	float				m_friction = 0.f;
+	void*				m_userData = nullptr;
+
+	void SetMass(float mass) { m_inverseMass = (mass > 0.f) ? (1.f / mass) : 0.f; }
+};
+
+struct PhysicsContact2D
+{
+	int		m_bodyIdA = -1;
+	int		m_bodyIdB = -1;
+	Vec2	m_normal;						//from A toward B
+	Vec2	m_point;
+	float	m_penetration = 0.f;
+	float	m_normalImpulse = 0.f;			//accumulated this step, carried into the next for warm starting
+	float	m_tangentImpulse = 0.f;
+};
+
+struct PhysicsWorld2DConfig
+{
+	Vec2	m_gravity = Vec2(0.f, 0.f);
+	int		m_numVelocityIterations = 8;
+	int		m_numPositionIterations = 3;
+	float	m_restitutionThreshold = 1.f;	//closing speeds below this do not bounce, so resting contacts settle
+	float	m_linearSlop = 0.01f;			//overlap left in place so resting contacts stay touching between steps
+	float	m_baumgarteFactor = 0.2f;		//fraction of the remaining overlap removed per position pass
+	float	m_maxLinearCorrection = 0.2f;
+	bool	m_enableWarmStarting = true;
+	DynamicAABBTree2DConfig m_broadphaseConfig;
+};
+
+class PhysicsWorld2D
+{
+public:
+	explicit PhysicsWorld2D(PhysicsWorld2DConfig const& config = PhysicsWorld2DConfig());
+
+	int		CreateBody(PhysicsBody2D const& body);
+	void	DestroyBody(int bodyId);
+	void	Clear();
+
+	//bodies may be moved or changed freely between steps
+	PhysicsBody2D&			GetBody(int bodyId);
+	PhysicsBody2D const&	GetBody(int bodyId) const;
+	int						GetNumBodies() const { return m_numBodies; }
+
+	void	Step(float deltaSeconds, ThreadPool* threadPool = nullptr);
+
+	//touching pairs found by the last step, sorted by body ids
+	std::vector<PhysicsContact2D> const&	GetContacts() const { return m_contacts; }
+	int										GetNumIslands() const { return (int)m_islandContactStarts.size() - 1; }
+
+private:
+	struct BodyInfo
+	{
+		int		m_proxyId = -1;
+		bool	m_isAlive = false;
+	};
+
+	struct ContactConstraint
+	{
+		Vec2	m_tangent;
+		float	m_normalMass = 0.f;
+		float	m_tangentMass = 0.f;
+		float	m_bounceSpeed = 0.f;		//separating speed restitution asks for, 0 below the threshold
+		float	m_friction = 0.f;
+	};
+
+	void	UpdateBroadphase(float deltaSeconds);
+	void	FindContacts();
+	void	BuildIslands();
+	void	SolveIslandVelocities(int islandIndex);
+	void	SolveIslandPositions(int islandIndex);
+	bool	ComputeContact(PhysicsContact2D& contact) const;
+	AABB2	GetBodyBounds(PhysicsBody2D const& body) const;
+
+private:
+	PhysicsWorld2DConfig			m_config;
+	std::vector<PhysicsBody2D>		m_bodies;
+	std::vector<BodyInfo>			m_bodyInfos;
+	std::vector<int>				m_freeBodyIds;
+	int								m_numBodies = 0;
+	DynamicAABBTree2D				m_broadphase;
+
+	std::vector<PhysicsContact2D>	m_contacts;
+	std::vector<PhysicsContact2D>	m_previousContacts;
+	std::vector<ContactConstraint>	m_constraints;
+	std::vector<std::pair<int, int>> m_overlappingPairs;
+
+	//islands as runs of contact indexes, island i is [m_islandContactStarts[i], m_islandContactStarts[i + 1])
+	std::vector<int>				m_islandContacts;
+	std::vector<int>				m_islandContactStarts;
+	std::vector<int>				m_islandParents;
+};
@@ -5,7 +5,6 @@ struct Plane3D
 public:
 	Plane3D(Vec3 const& normal, float distance);
 	Plane3D() {};
-	~Plane3D() {}
 	Vec3 GetNearestPointToOrigin() const;
 	Vec3 GetNearestPoint(Vec3 const& referencePos) const;
 	float GetAltitudeFromPoint(Vec3 const& referencePos) const;
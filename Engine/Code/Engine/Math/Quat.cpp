@@ -0,0 +1,281 @@
+#include "Engine/Math/Quat.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <math.h>
+
+Quat const Quat::IDENTITY = Quat(0.f, 0.f, 0.f, 1.f);
+
+//past this the two rotations are so close that slerp's sin(theta) divide loses precision, so nlerp instead
+constexpr float SLERP_NLERP_THRESHOLD = 0.9995f;
+
+Quat::Quat(float initialX, float initialY, float initialZ, float initialW)
+	:x(initialX)
+	,y(initialY)
+	,z(initialZ)
+	,w(initialW)
+{
+}
+
+Quat const Quat::MakeFromAxisAngleDegrees(Vec3 const& unitAxis, float rotationDegrees)
+{
+	float halfSin = 0.f;
+	float halfCos = 1.f;
+	SinCosDegrees(rotationDegrees * 0.5f, halfSin, halfCos);
+	return Quat(unitAxis.x * halfSin, unitAxis.y * halfSin, unitAxis.z * halfSin, halfCos);
+}
+
+//yaw * pitch * roll with the half angle products expanded
+Quat const Quat::MakeFromEulerAngles(EulerAngles const& orientation)
+{
+	float sY = 0.f;
+	float cY = 1.f;
+	float sP = 0.f;
+	float cP = 1.f;
+	float sR = 0.f;
+	float cR = 1.f;
+	SinCosDegrees(orientation.m_yawDegrees * 0.5f, sY, cY);
+	SinCosDegrees(orientation.m_pitchDegrees * 0.5f, sP, cP);
+	SinCosDegrees(orientation.m_rollDegrees * 0.5f, sR, cR);
+
+	Quat result;
+	result.x = (sR * cP * cY) - (cR * sP * sY);
+	result.y = (cR * sP * cY) + (sR * cP * sY);
+	result.z = (cR * cP * sY) - (sR * sP * cY);
+	result.w = (cR * cP * cY) + (sR * sP * sY);
+	return result;
+}
+
+//Shepperd's method, divides by the largest of the four components so it stays accurate near 180 degrees
+Quat const Quat::MakeFromMatrix(Mat44 const& matrix)
+{
+	float const* values = matrix.m_values;
+	float m00 = values[Mat44::Ix];
+	float m01 = values[Mat44::Jx];
+	float m02 = values[Mat44::Kx];
+	float m10 = values[Mat44::Iy];
+	float m11 = values[Mat44::Jy];
+	float m12 = values[Mat44::Ky];
+	float m20 = values[Mat44::Iz];
+	float m21 = values[Mat44::Jz];
+	float m22 = values[Mat44::Kz];
+
+	Quat result;
+	float trace = m00 + m11 + m22;
+	if (trace > 0.f)
+	{
+		float scale = sqrtf(trace + 1.f) * 2.f;
+		result.w = 0.25f * scale;
+		result.x = (m21 - m12) / scale;
+		result.y = (m02 - m20) / scale;
+		result.z = (m10 - m01) / scale;
+	}
+	else if (m00 > m11 && m00 > m22)
+	{
+		float scale = sqrtf(1.f + m00 - m11 - m22) * 2.f;
+		result.w = (m21 - m12) / scale;
+		result.x = 0.25f * scale;
+		result.y = (m01 + m10) / scale;
+		result.z = (m02 + m20) / scale;
+	}
+	else if (m11 > m22)
+	{
+		float scale = sqrtf(1.f + m11 - m00 - m22) * 2.f;
+		result.w = (m02 - m20) / scale;
+		result.x = (m01 + m10) / scale;
+		result.y = 0.25f * scale;
+		result.z = (m12 + m21) / scale;
+	}
+	else
+	{
+		float scale = sqrtf(1.f + m22 - m00 - m11) * 2.f;
+		result.w = (m10 - m01) / scale;
+		result.x = (m02 + m20) / scale;
+		result.y = (m12 + m21) / scale;
+		result.z = 0.25f * scale;
+	}
+	result.Normalize();
+	return result;
+}
+
+//-----------------------------------------------------------------------------------------------
+EulerAngles const Quat::GetAsEulerAngles() const
+{
+	Vec3 iBasis;
+	Vec3 jBasis;
+	Vec3 kBasis;
+	GetAsVectors_IFwd_JLeft_KUp(iBasis, jBasis, kBasis);
+
+	//atan2 rather than asin(-iBasis.z) keeps pitch accurate near straight up and down
+	float horizontalLength = sqrtf((iBasis.x * iBasis.x) + (iBasis.y * iBasis.y));
+	float pitchDegrees = Atan2Degrees(-iBasis.z, horizontalLength);
+
+	//looking straight up or down, yaw and roll turn about the same axis so put it all in yaw
+	if (horizontalLength < 0.00001f)
+	{
+		return EulerAngles(Atan2Degrees(-jBasis.x, jBasis.y), pitchDegrees, 0.f);
+	}
+	return EulerAngles(Atan2Degrees(iBasis.y, iBasis.x), pitchDegrees, Atan2Degrees(jBasis.z, kBasis.z));
+}
+
+Mat44 const Quat::GetAsMatrix_IFwd_JLeft_KUp() const
+{
+	Vec3 iBasis;
+	Vec3 jBasis;
+	Vec3 kBasis;
+	GetAsVectors_IFwd_JLeft_KUp(iBasis, jBasis, kBasis);
+	return Mat44(iBasis, jBasis, kBasis, Vec3(0.f, 0.f, 0.f));
+}
+
+void Quat::GetAsVectors_IFwd_JLeft_KUp(Vec3& out_forwardIBasis, Vec3& out_leftJBasis, Vec3& out_upKBasis) const
+{
+	float xx = x * x;
+	float yy = y * y;
+	float zz = z * z;
+	float xy = x * y;
+	float xz = x * z;
+	float yz = y * z;
+	float wx = w * x;
+	float wy = w * y;
+	float wz = w * z;
+
+	out_forwardIBasis = Vec3(1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy));
+	out_leftJBasis = Vec3(2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx));
+	out_upKBasis = Vec3(2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy));
+}
+
+float Quat::GetLength() const
+{
+	return sqrtf((x * x) + (y * y) + (z * z) + (w * w));
+}
+
+Quat const Quat::GetNormalized() const
+{
+	Quat result = *this;
+	result.Normalize();
+	return result;
+}
+
+Quat const Quat::GetConjugate() const
+{
+	return Quat(-x, -y, -z, w);
+}
+
+//v + 2w(q x v) + 2q x (q x v), two cross products instead of building a matrix
+Vec3 const Quat::Rotate(Vec3 const& vectorToRotate) const
+{
+	Vec3 axis(x, y, z);
+	Vec3 twiceCross = CrossProduct3D(axis, vectorToRotate) * 2.f;
+	return vectorToRotate + (twiceCross * w) + CrossProduct3D(axis, twiceCross);
+}
+
+//for many vectors the 3x3 matrix is cheaper: 9 multiplies each, and the loop has no dependencies between vectors
+void Quat::RotateVec3s(int count, Vec3 const* vectorsToRotate, Vec3* out_rotatedVectors) const
+{
+	Vec3 iBasis;
+	Vec3 jBasis;
+	Vec3 kBasis;
+	GetAsVectors_IFwd_JLeft_KUp(iBasis, jBasis, kBasis);
+
+	for (int vectorIndex = 0; vectorIndex < count; ++vectorIndex)
+	{
+		float vecX = vectorsToRotate[vectorIndex].x;
+		float vecY = vectorsToRotate[vectorIndex].y;
+		float vecZ = vectorsToRotate[vectorIndex].z;
+		out_rotatedVectors[vectorIndex].x = (iBasis.x * vecX) + (jBasis.x * vecY) + (kBasis.x * vecZ);
+		out_rotatedVectors[vectorIndex].y = (iBasis.y * vecX) + (jBasis.y * vecY) + (kBasis.y * vecZ);
+		out_rotatedVectors[vectorIndex].z = (iBasis.z * vecX) + (jBasis.z * vecY) + (kBasis.z * vecZ);
+	}
+}
+
+void Quat::Normalize()
+{
+	float length = GetLength();
+	if (length == 0.f)
+	{
+		*this = IDENTITY;
+		return;
+	}
+
+	float inverseLength = 1.f / length;
+	x *= inverseLength;
+	y *= inverseLength;
+	z *= inverseLength;
+	w *= inverseLength;
+}
+
+//-----------------------------------------------------------------------------------------------
+bool Quat::operator==(Quat const& compare) const
+{
+	return x == compare.x && y == compare.y && z == compare.z && w == compare.w;
+}
+
+bool Quat::operator!=(Quat const& compare) const
+{
+	return !(*this == compare);
+}
+
+Quat const Quat::operator*(Quat const& quatToApplyFirst) const
+{
+	Quat const& b = quatToApplyFirst;
+	Quat result;
+	result.x = (w * b.x) + (x * b.w) + (y * b.z) - (z * b.y);
+	result.y = (w * b.y) - (x * b.z) + (y * b.w) + (z * b.x);
+	result.z = (w * b.z) + (x * b.y) - (y * b.x) + (z * b.w);
+	result.w = (w * b.w) - (x * b.x) - (y * b.y) - (z * b.z);
+	return result;
+}
+
+void Quat::operator*=(Quat const& quatToApplyFirst)
+{
+	*this = *this * quatToApplyFirst;
+}
+
+//-----------------------------------------------------------------------------------------------
+float DotProduct4D(Quat const& a, Quat const& b)
+{
+	return (a.x * b.x) + (a.y * b.y) + (a.z * b.z) + (a.w * b.w);
+}
+
+Quat const NormalizedLerp(Quat const& start, Quat const& end, float fractionTowardEnd)
+{
+	//q and -q are the same rotation, flip end so we blend the short way around
+	float endSign = (DotProduct4D(start, end) < 0.f) ? -1.f : 1.f;
+	float fractionOfStart = 1.f - fractionTowardEnd;
+	float fractionOfEnd = fractionTowardEnd * endSign;
+
+	Quat result;
+	result.x = (start.x * fractionOfStart) + (end.x * fractionOfEnd);
+	result.y = (start.y * fractionOfStart) + (end.y * fractionOfEnd);
+	result.z = (start.z * fractionOfStart) + (end.z * fractionOfEnd);
+	result.w = (start.w * fractionOfStart) + (end.w * fractionOfEnd);
+	result.Normalize();
+	return result;
+}
+
+Quat const Slerp(Quat const& start, Quat const& end, float fractionTowardEnd)
+{
+	float cosTheta = DotProduct4D(start, end);
+	float endSign = 1.f;
+	if (cosTheta < 0.f)
+	{
+		cosTheta = -cosTheta;
+		endSign = -1.f;
+	}
+
+	if (cosTheta > SLERP_NLERP_THRESHOLD)
+	{
+		return NormalizedLerp(start, end, fractionTowardEnd);
+	}
+
+	float theta = acosf(cosTheta);
+	float inverseSinTheta = 1.f / sinf(theta);
+	float fractionOfStart = sinf((1.f - fractionTowardEnd) * theta) * inverseSinTheta;
+	float fractionOfEnd = sinf(fractionTowardEnd * theta) * inverseSinTheta * endSign;
+
+	Quat result;
+	result.x = (start.x * fractionOfStart) + (end.x * fractionOfEnd);
+	result.y = (start.y * fractionOfStart) + (end.y * fractionOfEnd);
+	result.z = (start.z * fractionOfStart) + (end.z * fractionOfEnd);
+	result.w = (start.w * fractionOfStart) + (end.w * fractionOfEnd);
+	return result;
+}
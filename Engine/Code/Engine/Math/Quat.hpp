@@ -0,0 +1,51 @@
+#pragma once
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+struct Mat44;
+
+//-----------------------------------------------------------------------------------------------
+// unit quaternion rotation, same conventions as EulerAngles / GetAsMatrix_IFwd_JLeft_KUp
+//	(yaw about +Z, then pitch about +Y, then roll about +X)
+//	composing and rotating needs no trig, so convert once and keep orientations as Quats in hierarchies and animation
+//	a * b rotates by b first, then by a, matching Mat44 Append order
+//
+struct Quat
+{
+public:
+	static const Quat IDENTITY;
+
+	float x = 0.f;
+	float y = 0.f;
+	float z = 0.f;
+	float w = 1.f;
+
+public:
+	Quat() {}
+	explicit Quat(float initialX, float initialY, float initialZ, float initialW);
+	static Quat const	MakeFromAxisAngleDegrees(Vec3 const& unitAxis, float rotationDegrees);
+	static Quat const	MakeFromEulerAngles(EulerAngles const& orientation);
+	static Quat const	MakeFromMatrix(Mat44 const& matrix); //rotation part only, IJK must be orthonormal
+
+	//Accessors
+	EulerAngles const	GetAsEulerAngles() const;
+	Mat44 const			GetAsMatrix_IFwd_JLeft_KUp() const;
+	void				GetAsVectors_IFwd_JLeft_KUp(Vec3& out_forwardIBasis, Vec3& out_leftJBasis, Vec3& out_upKBasis) const;
+	float				GetLength() const;
+	Quat const			GetNormalized() const;
+	Quat const			GetConjugate() const;		//inverse rotation for unit quaternions
+	Vec3 const			Rotate(Vec3 const& vectorToRotate) const;
+	void				RotateVec3s(int count, Vec3 const* vectorsToRotate, Vec3* out_rotatedVectors) const; //in place is fine
+
+	//Mutators
+	void Normalize();
+
+	//Operators
+	bool		operator==(Quat const& compare) const;
+	bool		operator!=(Quat const& compare) const;
+	Quat const	operator*(Quat const& quatToApplyFirst) const;
+	void		operator*=(Quat const& quatToApplyFirst);
+};
+
+float		DotProduct4D(Quat const& a, Quat const& b);
+Quat const	NormalizedLerp(Quat const& start, Quat const& end, float fractionTowardEnd);	//cheap, slightly uneven speed
+Quat const	Slerp(Quat const& start, Quat const& end, float fractionTowardEnd);			//constant angular speed, always takes the short way
@@ -1,22 +1,136 @@
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Math/Vec2.hpp"
-#include <stdlib.h>
+#include "Engine/Math/RawNoise.hpp"
+#include <atomic>
 
+constexpr uint64_t PCG_MULTIPLIER = 6364136223846793005ULL;
+
+static std::atomic<unsigned int> s_nextDefaultSeed(0);
+
+RandomNumberGenerator::RandomNumberGenerator()
+{
+	//hash sequential counts so default seeds are spread apart
+	SetSeed(Get1dNoiseUint(static_cast<int>(s_nextDefaultSeed++), 0x9E3779B9), 0);
+}
+
+RandomNumberGenerator::RandomNumberGenerator(unsigned int seed, unsigned int streamId)
+{
+	SetSeed(seed, streamId);
+}
+
+void RandomNumberGenerator::SetSeed(unsigned int seed)
+{
+	SetSeed(seed, m_streamId);
+}
+
+void RandomNumberGenerator::SetSeed(unsigned int seed, unsigned int streamId)
+{
+	//standard pcg32 seeding, the increment must be odd
+	m_seed = seed;
+	m_streamId = streamId;
+	m_state = 0;
+	m_increment = (static_cast<uint64_t>(streamId) << 1) | 1u;
+	GetNextUint();
+	m_state += seed;
+	GetNextUint();
+}
+
+unsigned int RandomNumberGenerator::GetSeed() const
+{
+	return m_seed;
+}
+
+unsigned int RandomNumberGenerator::GetStreamId() const
+{
+	return m_streamId;
+}
+
+RandomNumberGenerator RandomNumberGenerator::CreateStream(unsigned int streamId) const
+{
+	return RandomNumberGenerator(m_seed, streamId);
+}
+
+RandomNumberGeneratorState RandomNumberGenerator::GetState() const
+{
+	RandomNumberGeneratorState state;
+	state.m_state = m_state;
+	state.m_increment = m_increment;
+	state.m_seed = m_seed;
+	state.m_streamId = m_streamId;
+	return state;
+}
+
+void RandomNumberGenerator::SetState(RandomNumberGeneratorState const& state)
+{
+	m_state = state.m_state;
+	m_increment = state.m_increment | 1u;
+	m_seed = state.m_seed;
+	m_streamId = state.m_streamId;
+}
+
+//-----------------------------------------------------------------------------------------------
+inline unsigned int RandomNumberGenerator::GetNextUint()
+{
+	uint64_t oldState = m_state;
+	m_state = (oldState * PCG_MULTIPLIER) + m_increment;
+	unsigned int xorShifted = static_cast<unsigned int>(((oldState >> 18u) ^ oldState) >> 27u);
+	unsigned int rotation = static_cast<unsigned int>(oldState >> 59u);
+	return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+}
+
+//Lemire's multiply-shift, rejecting the few values that would bias the low results; 0 means the full 32-bit range
+inline unsigned int RandomNumberGenerator::GetNextUintLessThan(unsigned int maxNotInclusive)
+{
+	if (maxNotInclusive == 0)
+	{
+		return GetNextUint();
+	}
+
+	uint64_t product = static_cast<uint64_t>(GetNextUint()) * maxNotInclusive;
+	unsigned int lowBits = static_cast<unsigned int>(product);
+	if (lowBits < maxNotInclusive)
+	{
+		unsigned int threshold = (0u - maxNotInclusive) % maxNotInclusive;
+		while (lowBits < threshold)
+		{
+			product = static_cast<uint64_t>(GetNextUint()) * maxNotInclusive;
+			lowBits = static_cast<unsigned int>(product);
+		}
+	}
+	return static_cast<unsigned int>(product >> 32u);
+}
+
+//top 24 bits, so every result is exactly representable and both 0 and 1 can come up
+static float GetFloatZeroToOneFromUint(unsigned int bits)
+{
+	constexpr float ONE_OVER_MAX_24_BITS = 1.f / 16777215.f;
+	return static_cast<float>(bits >> 8u) * ONE_OVER_MAX_24_BITS;
+}
+
+unsigned int RandomNumberGenerator::RollRandomUint()
+{
+	return GetNextUint();
+}
 
 int RandomNumberGenerator::RollRandomIntLessThan(int maxNotInclusive)
 {
-	return rand() % maxNotInclusive;
+	//an empty range has no valid answer; returning 0 without rolling keeps the result in [0, max) for every valid max
+	if (maxNotInclusive <= 0)
+	{
+		return 0;
+	}
+	return static_cast<int>(GetNextUintLessThan(static_cast<unsigned int>(maxNotInclusive)));
 }
 
 int RandomNumberGenerator::RollRandomIntInRange(int minInclusive, int maxInclusive)
 {
-	int range = (maxInclusive - minInclusive) + 1;
-	return minInclusive + RollRandomIntLessThan(range);
+	unsigned int range = (static_cast<unsigned int>(maxInclusive) - static_cast<unsigned int>(minInclusive)) + 1u;
+	return static_cast<int>(static_cast<unsigned int>(minInclusive) + GetNextUintLessThan(range));
 }
 
 float RandomNumberGenerator::RollRandomFloatZeroToOne()
 {
-	return (float)(rand() / (float)(32767));
+	return GetFloatZeroToOneFromUint(GetNextUint());
 }
 
 float RandomNumberGenerator::RollRandomFloatInRange(float minInclusive, float maxInclusive)
@@ -36,4 +150,53 @@ Vec2 RandomNumberGenerator::RollRandomVec2DInRange(Vec2 const& minInclusive, Vec
 	return Vec2(xPos, yPos);
 }
 
+//-----------------------------------------------------------------------------------------------
+void RandomNumberGenerator::RollRandomUints(int count, unsigned int* out_values)
+{
+	for (int index = 0; index < count; ++index)
+	{
+		out_values[index] = GetNextUint();
+	}
+}
+
+void RandomNumberGenerator::RollRandomIntsInRange(int count, int* out_values, int minInclusive, int maxInclusive)
+{
+	unsigned int range = (static_cast<unsigned int>(maxInclusive) - static_cast<unsigned int>(minInclusive)) + 1u;
+	for (int index = 0; index < count; ++index)
+	{
+		out_values[index] = static_cast<int>(static_cast<unsigned int>(minInclusive) + GetNextUintLessThan(range));
+	}
+}
+
+void RandomNumberGenerator::RollRandomFloatsZeroToOne(int count, float* out_values)
+{
+	for (int index = 0; index < count; ++index)
+	{
+		out_values[index] = GetFloatZeroToOneFromUint(GetNextUint());
+	}
+}
+
+void RandomNumberGenerator::RollRandomFloatsInRange(int count, float* out_values, float minInclusive, float maxInclusive)
+{
+	float range = maxInclusive - minInclusive;
+	for (int index = 0; index < count; ++index)
+	{
+		out_values[index] = minInclusive + range * GetFloatZeroToOneFromUint(GetNextUint());
+	}
+}
 
+void RandomNumberGenerator::RollRandomVec2sInRange(int count, Vec2* out_values, Vec2 const& minInclusive, Vec2 const& maxInclusive)
+{
+	Vec2 range = maxInclusive - minInclusive;
+	for (int index = 0; index < count; ++index)
+	{
+		out_values[index].x = minInclusive.x + range.x * GetFloatZeroToOneFromUint(GetNextUint());
+		out_values[index].y = minInclusive.y + range.y * GetFloatZeroToOneFromUint(GetNextUint());
+	}
+}
+
+RandomNumberGenerator& RandomNumberGenerator::GetForCurrentThread()
+{
+	thread_local RandomNumberGenerator s_threadRandomNumberGenerator;
+	return s_threadRandomNumberGenerator;
+}
@@ -1,19 +1,61 @@
 #pragma once
+#include <stdint.h>
 struct Vec2;
+
+//everything needed to resume a generator exactly where it left off (save games, replays, rollback)
+struct RandomNumberGeneratorState
+{
+	uint64_t m_state = 0;
+	uint64_t m_increment = 1;
+	unsigned int m_seed = 0;
+	unsigned int m_streamId = 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+// PCG32 (XSH-RR): 64 bits of state, full 32-bit output, period 2^64 per stream
+//	generators with the same seed and different stream ids produce independent sequences, so give each system
+//	(or each entity / job in a parallel update) its own stream and results do not depend on thread scheduling
+//	a single generator is not safe to share between threads; use one per thread, e.g. GetForCurrentThread()
+//
 class RandomNumberGenerator
 {
 public:
-	int RollRandomIntLessThan(int maxNotInclusive);
+	RandomNumberGenerator(); //picks a unique seed so separately constructed generators do not repeat each other
+	explicit RandomNumberGenerator(unsigned int seed, unsigned int streamId = 0);
+
+	void SetSeed(unsigned int seed);
+	void SetSeed(unsigned int seed, unsigned int streamId);
+	unsigned int GetSeed() const;
+	unsigned int GetStreamId() const;
+	RandomNumberGenerator CreateStream(unsigned int streamId) const; //same seed, independent sequence
+
+	RandomNumberGeneratorState GetState() const;
+	void SetState(RandomNumberGeneratorState const& state);
+
+	unsigned int RollRandomUint();
+	int RollRandomIntLessThan(int maxNotInclusive); //returns 0 without advancing the sequence when maxNotInclusive <= 0
 	int RollRandomIntInRange(int minInclusive, int maxInclusive);
 	float RollRandomFloatZeroToOne();
 	float RollRandomFloatInRange(float minInclusive, float maxInclusive);
 	bool RollWithPercentChance(float percentSuccess);
 	Vec2 RollRandomVec2DInRange(Vec2 const& minInclusive, Vec2 const& maxInclusive);
 
+	//bulk fills, same values as calling the single versions in a loop
+	void RollRandomUints(int count, unsigned int* out_values);
+	void RollRandomIntsInRange(int count, int* out_values, int minInclusive, int maxInclusive);
+	void RollRandomFloatsZeroToOne(int count, float* out_values);
+	void RollRandomFloatsInRange(int count, float* out_values, float minInclusive, float maxInclusive);
+	void RollRandomVec2sInRange(int count, Vec2* out_values, Vec2 const& minInclusive, Vec2 const& maxInclusive);
+
+	static RandomNumberGenerator& GetForCurrentThread(); //lazily created, uniquely seeded per thread
+
 private:
-	// to be added later
-	// 
-	//unsigned int m_seed = 0;
-	//int m_position = 0;
-};
+	unsigned int GetNextUint();
+	unsigned int GetNextUintLessThan(unsigned int maxNotInclusive);
 
+private:
+	uint64_t m_state = 0;
+	uint64_t m_increment = 1;
+	unsigned int m_seed = 0;
+	unsigned int m_streamId = 0;
+};
@@ -0,0 +1,155 @@
+#include "Engine/Math/RawNoise.hpp"
+
+//large primes with non-boring bits, used to fold extra dimensions into one index
+constexpr int NOISE_PRIME_Y = 198491317;
+constexpr int NOISE_PRIME_Z = 6542989;
+constexpr int NOISE_PRIME_T = 357239;
+
+constexpr double ONE_OVER_MAX_UINT = 1.0 / 4294967295.0;
+constexpr double ONE_OVER_MAX_INT = 1.0 / 2147483647.0;
+
+//-----------------------------------------------------------------------------------------------
+inline unsigned int MangleBits(int index, unsigned int seed)
+{
+	constexpr unsigned int BIT_NOISE1 = 0xB5297A4D;
+	constexpr unsigned int BIT_NOISE2 = 0x68E31DA4;
+	constexpr unsigned int BIT_NOISE3 = 0x1B56C4E9;
+
+	unsigned int mangledBits = static_cast<unsigned int>(index);
+	mangledBits *= BIT_NOISE1;
+	mangledBits += seed;
+	mangledBits ^= (mangledBits >> 8);
+	mangledBits += BIT_NOISE2;
+	mangledBits ^= (mangledBits << 8);
+	mangledBits *= BIT_NOISE3;
+	mangledBits ^= (mangledBits >> 8);
+	return mangledBits;
+}
+
+//index math is done unsigned so wrapping is well defined
+inline int FoldIndexes(int indexX, int indexY)
+{
+	return static_cast<int>(static_cast<unsigned int>(indexX) + (static_cast<unsigned int>(NOISE_PRIME_Y) * static_cast<unsigned int>(indexY)));
+}
+
+inline int FoldIndexes(int indexX, int indexY, int indexZ)
+{
+	return static_cast<int>(static_cast<unsigned int>(FoldIndexes(indexX, indexY)) + (static_cast<unsigned int>(NOISE_PRIME_Z) * static_cast<unsigned int>(indexZ)));
+}
+
+inline int FoldIndexes(int indexX, int indexY, int indexZ, int indexT)
+{
+	return static_cast<int>(static_cast<unsigned int>(FoldIndexes(indexX, indexY, indexZ)) + (static_cast<unsigned int>(NOISE_PRIME_T) * static_cast<unsigned int>(indexT)));
+}
+
+inline float UintToZeroToOne(unsigned int bits)
+{
+	return static_cast<float>(ONE_OVER_MAX_UINT * static_cast<double>(bits));
+}
+
+inline float UintToNegOneToOne(unsigned int bits)
+{
+	return static_cast<float>(ONE_OVER_MAX_INT * static_cast<double>(static_cast<int>(bits)));
+}
+
+//-----------------------------------------------------------------------------------------------
+unsigned int Get1dNoiseUint(int indexX, unsigned int seed)
+{
+	return MangleBits(indexX, seed);
+}
+
+unsigned int Get2dNoiseUint(int indexX, int indexY, unsigned int seed)
+{
+	return MangleBits(FoldIndexes(indexX, indexY), seed);
+}
+
+unsigned int Get3dNoiseUint(int indexX, int indexY, int indexZ, unsigned int seed)
+{
+	return MangleBits(FoldIndexes(indexX, indexY, indexZ), seed);
+}
+
+unsigned int Get4dNoiseUint(int indexX, int indexY, int indexZ, int indexT, unsigned int seed)
+{
+	return MangleBits(FoldIndexes(indexX, indexY, indexZ, indexT), seed);
+}
+
+float Get1dNoiseZeroToOne(int indexX, unsigned int seed)
+{
+	return UintToZeroToOne(Get1dNoiseUint(indexX, seed));
+}
+
+float Get2dNoiseZeroToOne(int indexX, int indexY, unsigned int seed)
+{
+	return UintToZeroToOne(Get2dNoiseUint(indexX, indexY, seed));
+}
+
+float Get3dNoiseZeroToOne(int indexX, int indexY, int indexZ, unsigned int seed)
+{
+	return UintToZeroToOne(Get3dNoiseUint(indexX, indexY, indexZ, seed));
+}
+
+float Get4dNoiseZeroToOne(int indexX, int indexY, int indexZ, int indexT, unsigned int seed)
+{
+	return UintToZeroToOne(Get4dNoiseUint(indexX, indexY, indexZ, indexT, seed));
+}
+
+float Get1dNoiseNegOneToOne(int indexX, unsigned int seed)
+{
+	return UintToNegOneToOne(Get1dNoiseUint(indexX, seed));
+}
+
+float Get2dNoiseNegOneToOne(int indexX, int indexY, unsigned int seed)
+{
+	return UintToNegOneToOne(Get2dNoiseUint(indexX, indexY, seed));
+}
+
+float Get3dNoiseNegOneToOne(int indexX, int indexY, int indexZ, unsigned int seed)
+{
+	return UintToNegOneToOne(Get3dNoiseUint(indexX, indexY, indexZ, seed));
+}
+
+float Get4dNoiseNegOneToOne(int indexX, int indexY, int indexZ, int indexT, unsigned int seed)
+{
+	return UintToNegOneToOne(Get4dNoiseUint(indexX, indexY, indexZ, indexT, seed));
+}
+
+//-----------------------------------------------------------------------------------------------
+void Get1dNoiseUintBatch(int count, int firstIndexX, unsigned int* out_values, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = MangleBits(static_cast<int>(static_cast<unsigned int>(firstIndexX) + static_cast<unsigned int>(sampleNum)), seed);
+	}
+}
+
+void Get1dNoiseZeroToOneBatch(int count, int firstIndexX, float* out_values, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = UintToZeroToOne(MangleBits(static_cast<int>(static_cast<unsigned int>(firstIndexX) + static_cast<unsigned int>(sampleNum)), seed));
+	}
+}
+
+void Get2dNoiseZeroToOneBatch(int count, int const* indexXs, int const* indexYs, float* out_values, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = UintToZeroToOne(MangleBits(FoldIndexes(indexXs[sampleNum], indexYs[sampleNum]), seed));
+	}
+}
+
+void Get3dNoiseZeroToOneBatch(int count, int const* indexXs, int const* indexYs, int const* indexZs, float* out_values, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = UintToZeroToOne(MangleBits(FoldIndexes(indexXs[sampleNum], indexYs[sampleNum], indexZs[sampleNum]), seed));
+	}
+}
+
+void Get4dNoiseZeroToOneBatch(int count, int const* indexXs, int const* indexYs, int const* indexZs, int const* indexTs, float* out_values, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = UintToZeroToOne(MangleBits(FoldIndexes(indexXs[sampleNum], indexYs[sampleNum], indexZs[sampleNum], indexTs[sampleNum]), seed));
+	}
+}
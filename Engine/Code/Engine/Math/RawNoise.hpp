@@ -0,0 +1,30 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// RawNoise.hpp
+//
+// Stateless hash noise (Squirrel3 bit mangling). The same (position, seed) always gives the same value,
+//	so any worker can compute any sample in any order and regenerate it later. Not for cryptography.
+//	Neighbouring positions give unrelated values; use SmoothNoise.hpp for noise that varies smoothly.
+//
+
+unsigned int	Get1dNoiseUint(int indexX, unsigned int seed = 0);
+unsigned int	Get2dNoiseUint(int indexX, int indexY, unsigned int seed = 0);
+unsigned int	Get3dNoiseUint(int indexX, int indexY, int indexZ, unsigned int seed = 0);
+unsigned int	Get4dNoiseUint(int indexX, int indexY, int indexZ, int indexT, unsigned int seed = 0);
+
+float			Get1dNoiseZeroToOne(int indexX, unsigned int seed = 0);
+float			Get2dNoiseZeroToOne(int indexX, int indexY, unsigned int seed = 0);
+float			Get3dNoiseZeroToOne(int indexX, int indexY, int indexZ, unsigned int seed = 0);
+float			Get4dNoiseZeroToOne(int indexX, int indexY, int indexZ, int indexT, unsigned int seed = 0);
+
+float			Get1dNoiseNegOneToOne(int indexX, unsigned int seed = 0);
+float			Get2dNoiseNegOneToOne(int indexX, int indexY, unsigned int seed = 0);
+float			Get3dNoiseNegOneToOne(int indexX, int indexY, int indexZ, unsigned int seed = 0);
+float			Get4dNoiseNegOneToOne(int indexX, int indexY, int indexZ, int indexT, unsigned int seed = 0);
+
+//batch versions, branch free loops over plain arrays so the compiler can vectorize them
+void			Get1dNoiseUintBatch(int count, int firstIndexX, unsigned int* out_values, unsigned int seed = 0); //consecutive indexes
+void			Get1dNoiseZeroToOneBatch(int count, int firstIndexX, float* out_values, unsigned int seed = 0);
+void			Get2dNoiseZeroToOneBatch(int count, int const* indexXs, int const* indexYs, float* out_values, unsigned int seed = 0);
+void			Get3dNoiseZeroToOneBatch(int count, int const* indexXs, int const* indexYs, int const* indexZs, float* out_values, unsigned int seed = 0);
+void			Get4dNoiseZeroToOneBatch(int count, int const* indexXs, int const* indexYs, int const* indexZs, int const* indexTs, float* out_values, unsigned int seed = 0);
@@ -0,0 +1,248 @@
+#include "Engine/Math/RaycastBatch2D.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Core/ThreadPool.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <algorithm>
+
+constexpr int MIN_RAYS_PER_RAYCAST_TASK = 16;
+constexpr int MIN_RAYS_PER_TILE_RAYCAST_TASK = 32;
+
+//-----------------------------------------------------------------------------------------------
+void DiscBatch2D::Clear()
+{
+	m_centerXs.clear();
+	m_centerYs.clear();
+	m_radii.clear();
+}
+
+void DiscBatch2D::Reserve(int numDiscs)
+{
+	m_centerXs.reserve(numDiscs);
+	m_centerYs.reserve(numDiscs);
+	m_radii.reserve(numDiscs);
+}
+
+int DiscBatch2D::AddDisc(Vec2 const& center, float radius)
+{
+	m_centerXs.push_back(center.x);
+	m_centerYs.push_back(center.y);
+	m_radii.push_back(radius);
+	return (int)m_radii.size() - 1;
+}
+
+//-----------------------------------------------------------------------------------------------
+struct RayLanes2D
+{
+	explicit RayLanes2D(Ray2 const& ray)
+		: m_startX(SIMDSplat(ray.m_startPos.x))
+		, m_startY(SIMDSplat(ray.m_startPos.y))
+		, m_fwrdX(SIMDSplat(ray.m_fwrdNormal.x))
+		, m_fwrdY(SIMDSplat(ray.m_fwrdNormal.y))
+		, m_leftX(SIMDSplat(-ray.m_fwrdNormal.y))
+		, m_leftY(SIMDSplat(ray.m_fwrdNormal.x))
+		, m_maxDist(SIMDSplat(ray.m_maxLength))
+	{
+	}
+
+	SIMDFloat4 m_startX;
+	SIMDFloat4 m_startY;
+	SIMDFloat4 m_fwrdX;
+	SIMDFloat4 m_fwrdY;
+	SIMDFloat4 m_leftX;
+	SIMDFloat4 m_leftY;
+	SIMDFloat4 m_maxDist;
+};
+
+// same tests and arithmetic order as RaycastVsDisc2D, 4 discs at a time
+// returns one bit per disc that was hit, out_impactDistances holds the hit distance of those lanes
+static int GetDiscImpactDistances4(RayLanes2D const& ray, float const* centerXs, float const* centerYs, float const* radii, float* out_impactDistances)
+{
+	SIMDFloat4 radius = SIMDLoad(radii);
+	SIMDFloat4 dispX = SIMDSub(SIMDLoad(centerXs), ray.m_startX);
+	SIMDFloat4 dispY = SIMDSub(SIMDLoad(centerYs), ray.m_startY);
+	SIMDFloat4 radiusSquared = SIMDMul(radius, radius);
+	SIMDFloat4 negativeRadius = SIMDNegate(radius);
+
+	SIMDMask4 isStartInside = SIMDCmpLt(SIMDAdd(SIMDMul(dispX, dispX), SIMDMul(dispY, dispY)), radiusSquared);
+
+	SIMDFloat4 dispOnLeft = SIMDAdd(SIMDMul(dispX, ray.m_leftX), SIMDMul(dispY, ray.m_leftY));
+	SIMDFloat4 dispOnFwrd = SIMDAdd(SIMDMul(dispX, ray.m_fwrdX), SIMDMul(dispY, ray.m_fwrdY));
+	SIMDMask4 isHit = SIMDMaskAnd(SIMDCmpLt(dispOnLeft, radius), SIMDCmpGt(dispOnLeft, negativeRadius));
+	isHit = SIMDMaskAnd(isHit, SIMDCmpLt(dispOnFwrd, SIMDAdd(ray.m_maxDist, radius)));
+	isHit = SIMDMaskAnd(isHit, SIMDCmpGt(dispOnFwrd, negativeRadius));
+
+	SIMDFloat4 adjustSquared = SIMDMax(SIMDSub(radiusSquared, SIMDMul(dispOnLeft, dispOnLeft)), SIMDSplat(0.f));
+	SIMDFloat4 impactDist = SIMDSub(dispOnFwrd, SIMDSqrt(adjustSquared));
+	isHit = SIMDMaskAnd(isHit, SIMDCmpLt(impactDist, ray.m_maxDist));
+	isHit = SIMDMaskAnd(isHit, SIMDCmpGt(impactDist, SIMDSplat(0.f)));
+	isHit = SIMDMaskOr(isHit, isStartInside);
+
+	SIMDStore(out_impactDistances, SIMDSelect(isStartInside, SIMDSplat(0.f), impactDist));
+	return SIMDGetMaskBits(isHit);
+}
+
+// calls visitor(discIndex, impactDist) for each hit in index order, stops early when visitor returns false
+template <typename HitVisitor>
+static void ForEachDiscHit(Ray2 const& ray, DiscBatch2D const& discs, HitVisitor const& visitor)
+{
+	RayLanes2D rayLanes(ray);
+	int numDiscs = discs.GetNumDiscs();
+	float impactDistances[4];
+
+	int firstDisc = 0;
+	for (; firstDisc + 4 <= numDiscs; firstDisc += 4)
+	{
+		int hitBits = GetDiscImpactDistances4(rayLanes, &discs.m_centerXs[firstDisc], &discs.m_centerYs[firstDisc], &discs.m_radii[firstDisc], impactDistances);
+		for (int lane = 0; hitBits != 0; ++lane, hitBits >>= 1)
+		{
+			if ((hitBits & 1) != 0 && !visitor(firstDisc + lane, impactDistances[lane]))
+			{
+				return;
+			}
+		}
+	}
+
+	//tail, padded with zero-radius discs that can never be hit
+	int numLeft = numDiscs - firstDisc;
+	if (numLeft > 0)
+	{
+		float centerXs[4] = {};
+		float centerYs[4] = {};
+		float radii[4] = {};
+		for (int lane = 0; lane < numLeft; ++lane)
+		{
+			centerXs[lane] = discs.m_centerXs[firstDisc + lane];
+			centerYs[lane] = discs.m_centerYs[firstDisc + lane];
+			radii[lane] = discs.m_radii[firstDisc + lane];
+		}
+
+		int hitBits = GetDiscImpactDistances4(rayLanes, centerXs, centerYs, radii, impactDistances);
+		for (int lane = 0; lane < numLeft; ++lane)
+		{
+			if ((hitBits & (1 << lane)) != 0 && !visitor(firstDisc + lane, impactDistances[lane]))
+			{
+				return;
+			}
+		}
+	}
+}
+
+static DiscBatchRaycastHit2D const MakeDiscHit(Ray2 const& ray, DiscBatch2D const& discs, int discIndex)
+{
+	DiscBatchRaycastHit2D hit;
+	hit.m_discIndex = discIndex;
+	Vec2 discCenter(discs.m_centerXs[discIndex], discs.m_centerYs[discIndex]);
+	hit.m_result = RaycastVsDisc2D(ray.m_startPos, ray.m_fwrdNormal, ray.m_maxLength, discCenter, discs.m_radii[discIndex]);
+	return hit;
+}
+
+//-----------------------------------------------------------------------------------------------
+DiscBatchRaycastHit2D RaycastVsDiscBatch2DNearest(Ray2 const& ray, DiscBatch2D const& discs)
+{
+	int nearestDisc = -1;
+	float nearestDist = 0.f;
+	ForEachDiscHit(ray, discs, [&nearestDisc, &nearestDist](int discIndex, float impactDist)
+		{
+			if (nearestDisc < 0 || impactDist < nearestDist)
+			{
+				nearestDisc = discIndex;
+				nearestDist = impactDist;
+			}
+			return true;
+		});
+
+	if (nearestDisc < 0)
+	{
+		return DiscBatchRaycastHit2D();
+	}
+	return MakeDiscHit(ray, discs, nearestDisc);
+}
+
+bool RaycastVsDiscBatch2DAny(Ray2 const& ray, DiscBatch2D const& discs, DiscBatchRaycastHit2D* out_firstHitFound)
+{
+	int hitDisc = -1;
+	ForEachDiscHit(ray, discs, [&hitDisc](int discIndex, float impactDist)
+		{
+			UNUSED(impactDist);
+			hitDisc = discIndex;
+			return false;
+		});
+
+	if (hitDisc < 0)
+	{
+		return false;
+	}
+	if (out_firstHitFound)
+	{
+		*out_firstHitFound = MakeDiscHit(ray, discs, hitDisc);
+	}
+	return true;
+}
+
+int RaycastVsDiscBatch2DAll(Ray2 const& ray, DiscBatch2D const& discs, std::vector<DiscBatchRaycastHit2D>& out_hitsNearestFirst)
+{
+	size_t firstNewHit = out_hitsNearestFirst.size();
+	ForEachDiscHit(ray, discs, [&ray, &discs, &out_hitsNearestFirst](int discIndex, float impactDist)
+		{
+			UNUSED(impactDist);
+			out_hitsNearestFirst.push_back(MakeDiscHit(ray, discs, discIndex));
+			return true;
+		});
+
+	std::stable_sort(out_hitsNearestFirst.begin() + firstNewHit, out_hitsNearestFirst.end(),
+		[](DiscBatchRaycastHit2D const& a, DiscBatchRaycastHit2D const& b) { return a.m_result.m_impactDistance < b.m_result.m_impactDistance; });
+	return (int)(out_hitsNearestFirst.size() - firstNewHit);
+}
+
+void RaycastVsDiscBatch2DNearest(int numRays, Ray2 const* rays, DiscBatch2D const& discs, DiscBatchRaycastHit2D* out_nearestHits, ThreadPool* threadPool)
+{
+	if (threadPool == nullptr)
+	{
+		for (int rayIndex = 0; rayIndex < numRays; ++rayIndex)
+		{
+			out_nearestHits[rayIndex] = RaycastVsDiscBatch2DNearest(rays[rayIndex], discs);
+		}
+		return;
+	}
+
+	threadPool->ParallelFor(numRays, [rays, &discs, out_nearestHits](int beginIndex, int endIndex)
+		{
+			for (int rayIndex = beginIndex; rayIndex < endIndex; ++rayIndex)
+			{
+				out_nearestHits[rayIndex] = RaycastVsDiscBatch2DNearest(rays[rayIndex], discs);
+			}
+		}, MIN_RAYS_PER_RAYCAST_TASK);
+}
+
+//-----------------------------------------------------------------------------------------------
+void RaycastVsTileHeatMap(int numRays, Ray2 const* rays, TileHeatMap const& solidMap, float tileSolidValue, RaycastResult2D* out_results, TileGrid2D const& grid, ThreadPool* threadPool)
+{
+	if (threadPool == nullptr)
+	{
+		for (int rayIndex = 0; rayIndex < numRays; ++rayIndex)
+		{
+			out_results[rayIndex] = RaycastVsTileHeatMap(rays[rayIndex], solidMap, tileSolidValue, grid);
+		}
+		return;
+	}
+
+	threadPool->ParallelFor(numRays, [rays, &solidMap, tileSolidValue, out_results, &grid](int beginIndex, int endIndex)
+		{
+			for (int rayIndex = beginIndex; rayIndex < endIndex; ++rayIndex)
+			{
+				out_results[rayIndex] = RaycastVsTileHeatMap(rays[rayIndex], solidMap, tileSolidValue, grid);
+			}
+		}, MIN_RAYS_PER_TILE_RAYCAST_TASK);
+}
+
+int RaycastVsTileHeatMapFindFirstClear(int numRays, Ray2 const* rays, TileHeatMap const& solidMap, float tileSolidValue, TileGrid2D const& grid)
+{
+	for (int rayIndex = 0; rayIndex < numRays; ++rayIndex)
+	{
+		if (!RaycastVsTileHeatMap(rays[rayIndex], solidMap, tileSolidValue, grid).m_didImpact)
+		{
+			return rayIndex;
+		}
+	}
+	return -1;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Engine/Math/MathUtils.hpp"
+#include <vector>
+class ThreadPool;
+
+//-----------------------------------------------------------------------------------------------
+// packed (structure of arrays) discs so one ray can be tested against 4 discs per SIMD step
+struct DiscBatch2D
+{
+	std::vector<float> m_centerXs;
+	std::vector<float> m_centerYs;
+	std::vector<float> m_radii;
+
+	void	Clear();
+	void	Reserve(int numDiscs);
+	int		AddDisc(Vec2 const& center, float radius); //returns the disc index used in hits
+	int		GetNumDiscs() const { return (int)m_radii.size(); }
+};
+
+struct DiscBatchRaycastHit2D
+{
+	int				m_discIndex = -1;
+	RaycastResult2D m_result;
+};
+
+//-----------------------------------------------------------------------------------------------
+// each hit matches RaycastVsDisc2D against that disc exactly; the SIMD pass only decides which discs were hit
+DiscBatchRaycastHit2D	RaycastVsDiscBatch2DNearest(Ray2 const& ray, DiscBatch2D const& discs);
+bool					RaycastVsDiscBatch2DAny(Ray2 const& ray, DiscBatch2D const& discs, DiscBatchRaycastHit2D* out_firstHitFound = nullptr); //stops at the first hit
+int						RaycastVsDiscBatch2DAll(Ray2 const& ray, DiscBatch2D const& discs, std::vector<DiscBatchRaycastHit2D>& out_hitsNearestFirst);
+
+//lidar-style sweeps: nearest hit for every ray, spread across the thread pool when one is given
+void					RaycastVsDiscBatch2DNearest(int numRays, Ray2 const* rays, DiscBatch2D const& discs, DiscBatchRaycastHit2D* out_nearestHits, ThreadPool* threadPool = nullptr);
+
+//-----------------------------------------------------------------------------------------------
+// many rays through one tile map (visibility sweeps, AI perception); each result matches the single-ray RaycastVsTileHeatMap
+void	RaycastVsTileHeatMap(int numRays, Ray2 const* rays, TileHeatMap const& solidMap, float tileSolidValue, RaycastResult2D* out_results, TileGrid2D const& grid = TileGrid2D(), ThreadPool* threadPool = nullptr);
+int		RaycastVsTileHeatMapFindFirstClear(int numRays, Ray2 const* rays, TileHeatMap const& solidMap, float tileSolidValue, TileGrid2D const& grid = TileGrid2D()); //index of the first ray that reaches its max length, -1 if all are blocked
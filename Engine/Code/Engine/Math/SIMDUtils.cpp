@@ -0,0 +1,161 @@
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Core/Time.hpp"
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------
+// scalar reference versions of the Mat44 hot paths, kept here only for the benchmark
+static void AppendScalar(Mat44& matrix, Mat44 const& appendThis)
+{
+	float const* m = appendThis.m_values;
+	float* out = matrix.m_values;
+	float old[16];
+	for (int i = 0; i < 16; ++i)
+	{
+		old[i] = out[i];
+	}
+
+	for (int column = 0; column < 4; ++column)
+	{
+		float const* c = &m[column * 4];
+		for (int row = 0; row < 4; ++row)
+		{
+			out[(column * 4) + row] = (old[row] * c[0]) + (old[4 + row] * c[1]) + (old[8 + row] * c[2]) + (old[12 + row] * c[3]);
+		}
+	}
+}
+
+static Vec3 const TransformPosition3DScalar(Mat44 const& matrix, Vec3 const& position)
+{
+	float const* m = matrix.m_values;
+	return Vec3((m[Mat44::Ix] * position.x) + (m[Mat44::Jx] * position.y) + (m[Mat44::Kx] * position.z) + m[Mat44::Tx],
+				(m[Mat44::Iy] * position.x) + (m[Mat44::Jy] * position.y) + (m[Mat44::Ky] * position.z) + m[Mat44::Ty],
+				(m[Mat44::Iz] * position.x) + (m[Mat44::Jz] * position.y) + (m[Mat44::Kz] * position.z) + m[Mat44::Tz]);
+}
+
+static Mat44 const GetOrthonormalInverseScalar(Mat44 const& matrix)
+{
+	float const* m = matrix.m_values;
+	Vec3 iBasis(m[Mat44::Ix], m[Mat44::Jx], m[Mat44::Kx]);
+	Vec3 jBasis(m[Mat44::Iy], m[Mat44::Jy], m[Mat44::Ky]);
+	Vec3 kBasis(m[Mat44::Iz], m[Mat44::Jz], m[Mat44::Kz]);
+
+	float tx = (-m[Mat44::Ix] * m[Mat44::Tx]) - (m[Mat44::Iy] * m[Mat44::Ty]) - (m[Mat44::Iz] * m[Mat44::Tz]);
+	float ty = (-m[Mat44::Jx] * m[Mat44::Tx]) - (m[Mat44::Jy] * m[Mat44::Ty]) - (m[Mat44::Jz] * m[Mat44::Tz]);
+	float tz = (-m[Mat44::Kx] * m[Mat44::Tx]) - (m[Mat44::Ky] * m[Mat44::Ty]) - (m[Mat44::Kz] * m[Mat44::Tz]);
+	return Mat44(iBasis, jBasis, kBasis, Vec3(tx, ty, tz));
+}
+
+static float GetMaxAbsDifference(float const* a, float const* b, int count)
+{
+	float maxDifference = 0.f;
+	for (int i = 0; i < count; ++i)
+	{
+		float difference = fabsf(a[i] - b[i]);
+		if (difference > maxDifference || difference != difference)
+		{
+			maxDifference = difference;
+		}
+	}
+	return maxDifference;
+}
+
+//-----------------------------------------------------------------------------------------------
+char const* GetSIMDPathName()
+{
+#if defined(ENGINE_SIMD_SSE)
+	return "SSE";
+#elif defined(ENGINE_SIMD_NEON)
+	return "NEON";
+#else
+	return "Scalar";
+#endif
+}
+
+//-----------------------------------------------------------------------------------------------
+SIMDBenchmarkResults RunMat44SIMDBenchmark(int numIterations)
+{
+	SIMDBenchmarkResults results;
+	if (numIterations <= 0)
+	{
+		return results;
+	}
+	results.m_numIterations = numIterations;
+
+	//fixed seed so every run measures the same data
+	RandomNumberGenerator rng(1234u);
+	constexpr int NUM_SAMPLES = 256;
+	std::vector<Mat44> matrices(NUM_SAMPLES);
+	std::vector<Vec3> positions(NUM_SAMPLES);
+	for (int i = 0; i < NUM_SAMPLES; ++i)
+	{
+		Mat44& matrix = matrices[i];
+		matrix.AppendZRotation(rng.RollRandomFloatInRange(0.f, 360.f));
+		matrix.AppendYRotation(rng.RollRandomFloatInRange(0.f, 360.f));
+		matrix.SetTranslation3D(Vec3(rng.RollRandomFloatInRange(-100.f, 100.f), rng.RollRandomFloatInRange(-100.f, 100.f), rng.RollRandomFloatInRange(-100.f, 100.f)));
+		positions[i] = Vec3(rng.RollRandomFloatInRange(-100.f, 100.f), rng.RollRandomFloatInRange(-100.f, 100.f), rng.RollRandomFloatInRange(-100.f, 100.f));
+	}
+
+	//append
+	Mat44 scalarAppend;
+	double startTime = GetCurrentTimeSeconds();
+	for (int i = 0; i < numIterations; ++i)
+	{
+		AppendScalar(scalarAppend, matrices[i % NUM_SAMPLES]);
+		scalarAppend.Orthonormalize_IFwd_JLeft_KUp();
+	}
+	results.m_scalarAppendSeconds = GetCurrentTimeSeconds() - startTime;
+
+	Mat44 simdAppend;
+	startTime = GetCurrentTimeSeconds();
+	for (int i = 0; i < numIterations; ++i)
+	{
+		simdAppend.Append(matrices[i % NUM_SAMPLES]);
+		simdAppend.Orthonormalize_IFwd_JLeft_KUp();
+	}
+	results.m_simdAppendSeconds = GetCurrentTimeSeconds() - startTime;
+	float maxDifference = GetMaxAbsDifference(scalarAppend.m_values, simdAppend.m_values, 16);
+
+	//transform position
+	Vec3 scalarSum;
+	startTime = GetCurrentTimeSeconds();
+	for (int i = 0; i < numIterations; ++i)
+	{
+		scalarSum += TransformPosition3DScalar(matrices[i % NUM_SAMPLES], positions[(i * 7) % NUM_SAMPLES]);
+	}
+	results.m_scalarTransformSeconds = GetCurrentTimeSeconds() - startTime;
+
+	Vec3 simdSum;
+	startTime = GetCurrentTimeSeconds();
+	for (int i = 0; i < numIterations; ++i)
+	{
+		simdSum += matrices[i % NUM_SAMPLES].TransformPosition3D(positions[(i * 7) % NUM_SAMPLES]);
+	}
+	results.m_simdTransformSeconds = GetCurrentTimeSeconds() - startTime;
+	float difference = GetMaxAbsDifference(&scalarSum.x, &simdSum.x, 3);
+	maxDifference = difference > maxDifference ? difference : maxDifference;
+
+	//orthonormal inverse
+	Mat44 scalarInverse;
+	startTime = GetCurrentTimeSeconds();
+	for (int i = 0; i < numIterations; ++i)
+	{
+		scalarInverse = GetOrthonormalInverseScalar(matrices[i % NUM_SAMPLES]);
+	}
+	results.m_scalarInverseSeconds = GetCurrentTimeSeconds() - startTime;
+
+	Mat44 simdInverse;
+	startTime = GetCurrentTimeSeconds();
+	for (int i = 0; i < numIterations; ++i)
+	{
+		simdInverse = matrices[i % NUM_SAMPLES].GetOrthonormalInverse();
+	}
+	results.m_simdInverseSeconds = GetCurrentTimeSeconds() - startTime;
+	difference = GetMaxAbsDifference(scalarInverse.m_values, simdInverse.m_values, 16);
+	maxDifference = difference > maxDifference ? difference : maxDifference;
+
+	results.m_maxAbsDifference = maxDifference;
+	return results;
+}
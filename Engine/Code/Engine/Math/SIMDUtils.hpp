@@ -0,0 +1,149 @@
+#pragma once
+#include "Game/EngineBuildPreferences.hpp"
+//-----------------------------------------------------------------------------------------------
+// SIMDUtils.hpp
+//
+// Thin 4-wide float wrapper used by the hot Mat44 / Vec3 / Vec4 paths.
+//	SSE on x86/x64, NEON on ARM64, plain scalar structs everywhere else.
+//	Only separate mul and add are exposed (no fused multiply-add) so that results stay
+//	bit-identical to the scalar code as long as the summation order is kept the same.
+//
+//	#define ENGINE_DISABLE_SIMD in your game's EngineBuildPreferences.hpp to force the scalar path.
+//
+#if !defined(ENGINE_DISABLE_SIMD) && (defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ENGINE_SIMD_SSE
+#include <xmmintrin.h>
+#elif !defined(ENGINE_DISABLE_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+#define ENGINE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#include <math.h>
+
+
+//-----------------------------------------------------------------------------------------------
+#if defined(ENGINE_SIMD_SSE)
+typedef __m128 SIMDFloat4;
+
+inline SIMDFloat4 SIMDLoad(float const* fourFloats)						{ return _mm_loadu_ps(fourFloats); }
+inline SIMDFloat4 SIMDSet(float x, float y, float z, float w)			{ return _mm_set_ps(w, z, y, x); }
+inline SIMDFloat4 SIMDSplat(float value)								{ return _mm_set1_ps(value); }
+inline void		  SIMDStore(float* out_fourFloats, SIMDFloat4 v)		{ _mm_storeu_ps(out_fourFloats, v); }
+inline SIMDFloat4 SIMDAdd(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_add_ps(a, b); }
+inline SIMDFloat4 SIMDSub(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_sub_ps(a, b); }
+inline SIMDFloat4 SIMDMul(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_mul_ps(a, b); }
+inline SIMDFloat4 SIMDDiv(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_div_ps(a, b); }
+inline SIMDFloat4 SIMDNegate(SIMDFloat4 v)								{ return _mm_xor_ps(v, _mm_set1_ps(-0.f)); }
+inline float	  SIMDGetX(SIMDFloat4 v)								{ return _mm_cvtss_f32(v); }
+inline SIMDFloat4 SIMDSqrt(SIMDFloat4 v)								{ return _mm_sqrt_ps(v); }
+inline SIMDFloat4 SIMDMin(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_min_ps(a, b); }
+inline SIMDFloat4 SIMDMax(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_max_ps(a, b); }
+
+typedef __m128 SIMDMask4;
+inline SIMDMask4  SIMDCmpLt(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_cmplt_ps(a, b); }
+inline SIMDMask4  SIMDCmpGt(SIMDFloat4 a, SIMDFloat4 b)					{ return _mm_cmpgt_ps(a, b); }
+inline SIMDMask4  SIMDMaskAnd(SIMDMask4 a, SIMDMask4 b)					{ return _mm_and_ps(a, b); }
+inline SIMDMask4  SIMDMaskOr(SIMDMask4 a, SIMDMask4 b)					{ return _mm_or_ps(a, b); }
+inline SIMDFloat4 SIMDSelect(SIMDMask4 mask, SIMDFloat4 a, SIMDFloat4 b)	{ return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+inline int		  SIMDGetMaskBits(SIMDMask4 mask)						{ return _mm_movemask_ps(mask); }
+
+//-----------------------------------------------------------------------------------------------
+#elif defined(ENGINE_SIMD_NEON)
+typedef float32x4_t SIMDFloat4;
+
+inline SIMDFloat4 SIMDLoad(float const* fourFloats)						{ return vld1q_f32(fourFloats); }
+inline SIMDFloat4 SIMDSet(float x, float y, float z, float w)			{ float const values[4] = { x, y, z, w }; return vld1q_f32(values); }
+inline SIMDFloat4 SIMDSplat(float value)								{ return vdupq_n_f32(value); }
+inline void		  SIMDStore(float* out_fourFloats, SIMDFloat4 v)		{ vst1q_f32(out_fourFloats, v); }
+inline SIMDFloat4 SIMDAdd(SIMDFloat4 a, SIMDFloat4 b)					{ return vaddq_f32(a, b); }
+inline SIMDFloat4 SIMDSub(SIMDFloat4 a, SIMDFloat4 b)					{ return vsubq_f32(a, b); }
+inline SIMDFloat4 SIMDMul(SIMDFloat4 a, SIMDFloat4 b)					{ return vmulq_f32(a, b); }
+inline SIMDFloat4 SIMDDiv(SIMDFloat4 a, SIMDFloat4 b)					{ return vdivq_f32(a, b); }
+inline SIMDFloat4 SIMDNegate(SIMDFloat4 v)								{ return vnegq_f32(v); }
+inline float	  SIMDGetX(SIMDFloat4 v)								{ return vgetq_lane_f32(v, 0); }
+inline SIMDFloat4 SIMDSqrt(SIMDFloat4 v)								{ return vsqrtq_f32(v); }
+inline SIMDFloat4 SIMDMin(SIMDFloat4 a, SIMDFloat4 b)					{ return vminq_f32(a, b); }
+inline SIMDFloat4 SIMDMax(SIMDFloat4 a, SIMDFloat4 b)					{ return vmaxq_f32(a, b); }
+
+typedef uint32x4_t SIMDMask4;
+inline SIMDMask4  SIMDCmpLt(SIMDFloat4 a, SIMDFloat4 b)					{ return vcltq_f32(a, b); }
+inline SIMDMask4  SIMDCmpGt(SIMDFloat4 a, SIMDFloat4 b)					{ return vcgtq_f32(a, b); }
+inline SIMDMask4  SIMDMaskAnd(SIMDMask4 a, SIMDMask4 b)					{ return vandq_u32(a, b); }
+inline SIMDMask4  SIMDMaskOr(SIMDMask4 a, SIMDMask4 b)					{ return vorrq_u32(a, b); }
+inline SIMDFloat4 SIMDSelect(SIMDMask4 mask, SIMDFloat4 a, SIMDFloat4 b)	{ return vbslq_f32(mask, a, b); }
+inline int		  SIMDGetMaskBits(SIMDMask4 mask)
+{
+	return (int)((vgetq_lane_u32(mask, 0) & 1u) | ((vgetq_lane_u32(mask, 1) & 1u) << 1) | ((vgetq_lane_u32(mask, 2) & 1u) << 2) | ((vgetq_lane_u32(mask, 3) & 1u) << 3));
+}
+
+//-----------------------------------------------------------------------------------------------
+#else
+struct SIMDFloat4
+{
+	float m_values[4];
+};
+
+inline SIMDFloat4 SIMDLoad(float const* fourFloats)						{ return SIMDFloat4{ { fourFloats[0], fourFloats[1], fourFloats[2], fourFloats[3] } }; }
+inline SIMDFloat4 SIMDSet(float x, float y, float z, float w)			{ return SIMDFloat4{ { x, y, z, w } }; }
+inline SIMDFloat4 SIMDSplat(float value)								{ return SIMDFloat4{ { value, value, value, value } }; }
+inline void		  SIMDStore(float* out_fourFloats, SIMDFloat4 v)		{ for (int i = 0; i < 4; ++i) out_fourFloats[i] = v.m_values[i]; }
+inline SIMDFloat4 SIMDAdd(SIMDFloat4 a, SIMDFloat4 b)					{ return SIMDFloat4{ { a.m_values[0] + b.m_values[0], a.m_values[1] + b.m_values[1], a.m_values[2] + b.m_values[2], a.m_values[3] + b.m_values[3] } }; }
+inline SIMDFloat4 SIMDSub(SIMDFloat4 a, SIMDFloat4 b)					{ return SIMDFloat4{ { a.m_values[0] - b.m_values[0], a.m_values[1] - b.m_values[1], a.m_values[2] - b.m_values[2], a.m_values[3] - b.m_values[3] } }; }
+inline SIMDFloat4 SIMDMul(SIMDFloat4 a, SIMDFloat4 b)					{ return SIMDFloat4{ { a.m_values[0] * b.m_values[0], a.m_values[1] * b.m_values[1], a.m_values[2] * b.m_values[2], a.m_values[3] * b.m_values[3] } }; }
+inline SIMDFloat4 SIMDDiv(SIMDFloat4 a, SIMDFloat4 b)					{ return SIMDFloat4{ { a.m_values[0] / b.m_values[0], a.m_values[1] / b.m_values[1], a.m_values[2] / b.m_values[2], a.m_values[3] / b.m_values[3] } }; }
+inline SIMDFloat4 SIMDNegate(SIMDFloat4 v)								{ return SIMDFloat4{ { -v.m_values[0], -v.m_values[1], -v.m_values[2], -v.m_values[3] } }; }
+inline float	  SIMDGetX(SIMDFloat4 v)								{ return v.m_values[0]; }
+inline SIMDFloat4 SIMDSqrt(SIMDFloat4 v)								{ return SIMDFloat4{ { sqrtf(v.m_values[0]), sqrtf(v.m_values[1]), sqrtf(v.m_values[2]), sqrtf(v.m_values[3]) } }; }
+inline SIMDFloat4 SIMDMin(SIMDFloat4 a, SIMDFloat4 b)					{ SIMDFloat4 r; for (int i = 0; i < 4; ++i) r.m_values[i] = a.m_values[i] < b.m_values[i] ? a.m_values[i] : b.m_values[i]; return r; }
+inline SIMDFloat4 SIMDMax(SIMDFloat4 a, SIMDFloat4 b)					{ SIMDFloat4 r; for (int i = 0; i < 4; ++i) r.m_values[i] = a.m_values[i] > b.m_values[i] ? a.m_values[i] : b.m_values[i]; return r; }
+
+struct SIMDMask4
+{
+	bool m_lanes[4];
+};
+inline SIMDMask4  SIMDCmpLt(SIMDFloat4 a, SIMDFloat4 b)					{ SIMDMask4 m; for (int i = 0; i < 4; ++i) m.m_lanes[i] = a.m_values[i] < b.m_values[i]; return m; }
+inline SIMDMask4  SIMDCmpGt(SIMDFloat4 a, SIMDFloat4 b)					{ SIMDMask4 m; for (int i = 0; i < 4; ++i) m.m_lanes[i] = a.m_values[i] > b.m_values[i]; return m; }
+inline SIMDMask4  SIMDMaskAnd(SIMDMask4 a, SIMDMask4 b)					{ SIMDMask4 m; for (int i = 0; i < 4; ++i) m.m_lanes[i] = a.m_lanes[i] && b.m_lanes[i]; return m; }
+inline SIMDMask4  SIMDMaskOr(SIMDMask4 a, SIMDMask4 b)					{ SIMDMask4 m; for (int i = 0; i < 4; ++i) m.m_lanes[i] = a.m_lanes[i] || b.m_lanes[i]; return m; }
+inline SIMDFloat4 SIMDSelect(SIMDMask4 mask, SIMDFloat4 a, SIMDFloat4 b)	{ SIMDFloat4 r; for (int i = 0; i < 4; ++i) r.m_values[i] = mask.m_lanes[i] ? a.m_values[i] : b.m_values[i]; return r; }
+inline int		  SIMDGetMaskBits(SIMDMask4 mask)						{ return (mask.m_lanes[0] ? 1 : 0) | (mask.m_lanes[1] ? 2 : 0) | (mask.m_lanes[2] ? 4 : 0) | (mask.m_lanes[3] ? 8 : 0); }
+#endif
+
+
+//-----------------------------------------------------------------------------------------------
+// column-major 4x4 helpers; columns are the I, J, K, T bases of a Mat44
+// result = (col0 * x) + (col1 * y) + (col2 * z) + (col3 * w), summed left to right like the scalar code
+inline SIMDFloat4 SIMDTransformColumns(SIMDFloat4 col0, SIMDFloat4 col1, SIMDFloat4 col2, SIMDFloat4 col3, float x, float y, float z, float w)
+{
+	SIMDFloat4 result = SIMDMul(col0, SIMDSplat(x));
+	result = SIMDAdd(result, SIMDMul(col1, SIMDSplat(y)));
+	result = SIMDAdd(result, SIMDMul(col2, SIMDSplat(z)));
+	result = SIMDAdd(result, SIMDMul(col3, SIMDSplat(w)));
+	return result;
+}
+
+// returns sqrtf((((x*x) + (y*y)) + (z*z)) + (w*w)), same order as Vec3/Vec4::GetLength; pass w = 0 for a Vec3
+inline float SIMDGetLength4(SIMDFloat4 v)
+{
+	float squared[4];
+	SIMDStore(squared, SIMDMul(v, v));
+	return sqrtf(((squared[0] + squared[1]) + squared[2]) + squared[3]);
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// scalar vs SIMD timing for the Mat44 hot paths; maxAbsDifference should be 0 on SSE/NEON
+struct SIMDBenchmarkResults
+{
+	int		m_numIterations = 0;
+	double	m_scalarAppendSeconds = 0.0;
+	double	m_simdAppendSeconds = 0.0;
+	double	m_scalarTransformSeconds = 0.0;
+	double	m_simdTransformSeconds = 0.0;
+	double	m_scalarInverseSeconds = 0.0;
+	double	m_simdInverseSeconds = 0.0;
+	float	m_maxAbsDifference = 0.f;
+};
+
+char const*				GetSIMDPathName();
+SIMDBenchmarkResults	RunMat44SIMDBenchmark(int numIterations);
@@ -0,0 +1,647 @@
+#include "Engine/Math/SmoothNoise.hpp"
+#include "Engine/Math/RawNoise.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include <math.h>
+
+//shifts each octave's lattice so they never all line up at the origin
+constexpr float OCTAVE_OFFSET = 0.636764989593174f;
+
+//single octave kernels peak below 1, these bring them out to [-1,1]
+constexpr float PERLIN_1D_NORMALIZER = 2.f;
+constexpr float PERLIN_2D_NORMALIZER = 1.41421356f;
+constexpr float SIMPLEX_2D_NORMALIZER = 70.f;
+
+constexpr float SIMPLEX_SKEW_2D = 0.366025403f;		//(sqrt(3) - 1) / 2
+constexpr float SIMPLEX_UNSKEW_2D = 0.211324865f;	//(3 - sqrt(3)) / 6
+
+static float const PERLIN_GRADIENTS_2D[8][2] =
+{
+	{ 1.f, 0.f }, { 0.70710678f, 0.70710678f }, { 0.f, 1.f }, { -0.70710678f, 0.70710678f },
+	{ -1.f, 0.f }, { -0.70710678f, -0.70710678f }, { 0.f, -1.f }, { 0.70710678f, -0.70710678f },
+};
+
+//cube edge midpoints, padded to 16 so the hash can be masked instead of taken modulo
+static float const PERLIN_GRADIENTS_3D[16][3] =
+{
+	{ 1.f, 1.f, 0.f }, { -1.f, 1.f, 0.f }, { 1.f, -1.f, 0.f }, { -1.f, -1.f, 0.f },
+	{ 1.f, 0.f, 1.f }, { -1.f, 0.f, 1.f }, { 1.f, 0.f, -1.f }, { -1.f, 0.f, -1.f },
+	{ 0.f, 1.f, 1.f }, { 0.f, -1.f, 1.f }, { 0.f, 1.f, -1.f }, { 0.f, -1.f, -1.f },
+	{ 1.f, 1.f, 0.f }, { 0.f, -1.f, 1.f }, { -1.f, 1.f, 0.f }, { 0.f, -1.f, -1.f },
+};
+
+static float const SIMPLEX_GRADIENTS_2D[8][2] =
+{
+	{ 1.f, 1.f }, { -1.f, 1.f }, { 1.f, -1.f }, { -1.f, -1.f },
+	{ 1.f, 0.f }, { -1.f, 0.f }, { 0.f, 1.f }, { 0.f, -1.f },
+};
+
+//-----------------------------------------------------------------------------------------------
+// single octave kernels, all in [-1,1]
+//
+static float ValueNoise1d(float posX, unsigned int seed)
+{
+	float cellX = floorf(posX);
+	int indexX = static_cast<int>(cellX);
+	float tX = SmoothStep3(posX - cellX);
+
+	float valueWest = Get1dNoiseNegOneToOne(indexX, seed);
+	float valueEast = Get1dNoiseNegOneToOne(indexX + 1, seed);
+	return Lerp(valueWest, valueEast, tX);
+}
+
+static float ValueNoise2d(float posX, float posY, unsigned int seed)
+{
+	float cellX = floorf(posX);
+	float cellY = floorf(posY);
+	int indexX = static_cast<int>(cellX);
+	int indexY = static_cast<int>(cellY);
+	float tX = SmoothStep3(posX - cellX);
+	float tY = SmoothStep3(posY - cellY);
+
+	float valueSW = Get2dNoiseNegOneToOne(indexX, indexY, seed);
+	float valueSE = Get2dNoiseNegOneToOne(indexX + 1, indexY, seed);
+	float valueNW = Get2dNoiseNegOneToOne(indexX, indexY + 1, seed);
+	float valueNE = Get2dNoiseNegOneToOne(indexX + 1, indexY + 1, seed);
+
+	float valueSouth = Lerp(valueSW, valueSE, tX);
+	float valueNorth = Lerp(valueNW, valueNE, tX);
+	return Lerp(valueSouth, valueNorth, tY);
+}
+
+static float ValueNoise3d(float posX, float posY, float posZ, unsigned int seed)
+{
+	float cellX = floorf(posX);
+	float cellY = floorf(posY);
+	float cellZ = floorf(posZ);
+	int indexX = static_cast<int>(cellX);
+	int indexY = static_cast<int>(cellY);
+	int indexZ = static_cast<int>(cellZ);
+	float tX = SmoothStep3(posX - cellX);
+	float tY = SmoothStep3(posY - cellY);
+	float tZ = SmoothStep3(posZ - cellZ);
+
+	float valueBelowSW = Get3dNoiseNegOneToOne(indexX, indexY, indexZ, seed);
+	float valueBelowSE = Get3dNoiseNegOneToOne(indexX + 1, indexY, indexZ, seed);
+	float valueBelowNW = Get3dNoiseNegOneToOne(indexX, indexY + 1, indexZ, seed);
+	float valueBelowNE = Get3dNoiseNegOneToOne(indexX + 1, indexY + 1, indexZ, seed);
+	float valueAboveSW = Get3dNoiseNegOneToOne(indexX, indexY, indexZ + 1, seed);
+	float valueAboveSE = Get3dNoiseNegOneToOne(indexX + 1, indexY, indexZ + 1, seed);
+	float valueAboveNW = Get3dNoiseNegOneToOne(indexX, indexY + 1, indexZ + 1, seed);
+	float valueAboveNE = Get3dNoiseNegOneToOne(indexX + 1, indexY + 1, indexZ + 1, seed);
+
+	float valueBelow = Lerp(Lerp(valueBelowSW, valueBelowSE, tX), Lerp(valueBelowNW, valueBelowNE, tX), tY);
+	float valueAbove = Lerp(Lerp(valueAboveSW, valueAboveSE, tX), Lerp(valueAboveNW, valueAboveNE, tX), tY);
+	return Lerp(valueBelow, valueAbove, tZ);
+}
+
+//-----------------------------------------------------------------------------------------------
+static float PerlinNoise1d(float posX, unsigned int seed)
+{
+	float cellX = floorf(posX);
+	int indexX = static_cast<int>(cellX);
+	float fracX = posX - cellX;
+	float tX = SmoothStep5(fracX);
+
+	//in 1D a gradient is just a slope
+	float dotWest = Get1dNoiseNegOneToOne(indexX, seed) * fracX;
+	float dotEast = Get1dNoiseNegOneToOne(indexX + 1, seed) * (fracX - 1.f);
+	return PERLIN_1D_NORMALIZER * Lerp(dotWest, dotEast, tX);
+}
+
+inline float DotPerlinGradient2d(int indexX, int indexY, float dispX, float dispY, unsigned int seed)
+{
+	float const* gradient = PERLIN_GRADIENTS_2D[Get2dNoiseUint(indexX, indexY, seed) & 7u];
+	return (gradient[0] * dispX) + (gradient[1] * dispY);
+}
+
+static float PerlinNoise2d(float posX, float posY, unsigned int seed)
+{
+	float cellX = floorf(posX);
+	float cellY = floorf(posY);
+	int indexX = static_cast<int>(cellX);
+	int indexY = static_cast<int>(cellY);
+	float fracX = posX - cellX;
+	float fracY = posY - cellY;
+	float tX = SmoothStep5(fracX);
+	float tY = SmoothStep5(fracY);
+
+	float dotSW = DotPerlinGradient2d(indexX, indexY, fracX, fracY, seed);
+	float dotSE = DotPerlinGradient2d(indexX + 1, indexY, fracX - 1.f, fracY, seed);
+	float dotNW = DotPerlinGradient2d(indexX, indexY + 1, fracX, fracY - 1.f, seed);
+	float dotNE = DotPerlinGradient2d(indexX + 1, indexY + 1, fracX - 1.f, fracY - 1.f, seed);
+
+	float dotSouth = Lerp(dotSW, dotSE, tX);
+	float dotNorth = Lerp(dotNW, dotNE, tX);
+	return PERLIN_2D_NORMALIZER * Lerp(dotSouth, dotNorth, tY);
+}
+
+inline float DotPerlinGradient3d(int indexX, int indexY, int indexZ, float dispX, float dispY, float dispZ, unsigned int seed)
+{
+	float const* gradient = PERLIN_GRADIENTS_3D[Get3dNoiseUint(indexX, indexY, indexZ, seed) & 15u];
+	return (gradient[0] * dispX) + (gradient[1] * dispY) + (gradient[2] * dispZ);
+}
+
+static float PerlinNoise3d(float posX, float posY, float posZ, unsigned int seed)
+{
+	float cellX = floorf(posX);
+	float cellY = floorf(posY);
+	float cellZ = floorf(posZ);
+	int indexX = static_cast<int>(cellX);
+	int indexY = static_cast<int>(cellY);
+	int indexZ = static_cast<int>(cellZ);
+	float fracX = posX - cellX;
+	float fracY = posY - cellY;
+	float fracZ = posZ - cellZ;
+	float tX = SmoothStep5(fracX);
+	float tY = SmoothStep5(fracY);
+	float tZ = SmoothStep5(fracZ);
+
+	float dotBelowSW = DotPerlinGradient3d(indexX, indexY, indexZ, fracX, fracY, fracZ, seed);
+	float dotBelowSE = DotPerlinGradient3d(indexX + 1, indexY, indexZ, fracX - 1.f, fracY, fracZ, seed);
+	float dotBelowNW = DotPerlinGradient3d(indexX, indexY + 1, indexZ, fracX, fracY - 1.f, fracZ, seed);
+	float dotBelowNE = DotPerlinGradient3d(indexX + 1, indexY + 1, indexZ, fracX - 1.f, fracY - 1.f, fracZ, seed);
+	float dotAboveSW = DotPerlinGradient3d(indexX, indexY, indexZ + 1, fracX, fracY, fracZ - 1.f, seed);
+	float dotAboveSE = DotPerlinGradient3d(indexX + 1, indexY, indexZ + 1, fracX - 1.f, fracY, fracZ - 1.f, seed);
+	float dotAboveNW = DotPerlinGradient3d(indexX, indexY + 1, indexZ + 1, fracX, fracY - 1.f, fracZ - 1.f, seed);
+	float dotAboveNE = DotPerlinGradient3d(indexX + 1, indexY + 1, indexZ + 1, fracX - 1.f, fracY - 1.f, fracZ - 1.f, seed);
+
+	float dotBelow = Lerp(Lerp(dotBelowSW, dotBelowSE, tX), Lerp(dotBelowNW, dotBelowNE, tX), tY);
+	float dotAbove = Lerp(Lerp(dotAboveSW, dotAboveSE, tX), Lerp(dotAboveNW, dotAboveNE, tX), tY);
+
+	//the edge gradients can overshoot 1 very slightly in the cell corners
+	return GetClamped(Lerp(dotBelow, dotAbove, tZ), -1.f, 1.f);
+}
+
+//-----------------------------------------------------------------------------------------------
+inline float SimplexCornerContribution2d(int indexX, int indexY, float dispX, float dispY, unsigned int seed)
+{
+	float falloff = 0.5f - (dispX * dispX) - (dispY * dispY);
+	if (falloff <= 0.f)
+	{
+		return 0.f;
+	}
+
+	float const* gradient = SIMPLEX_GRADIENTS_2D[Get2dNoiseUint(indexX, indexY, seed) & 7u];
+	falloff *= falloff;
+	return falloff * falloff * ((gradient[0] * dispX) + (gradient[1] * dispY));
+}
+
+//sums three corners of a skewed triangle grid instead of four square corners, and has no axis aligned artifacts
+static float SimplexNoise2d(float posX, float posY, unsigned int seed)
+{
+	float skew = (posX + posY) * SIMPLEX_SKEW_2D;
+	float cellX = floorf(posX + skew);
+	float cellY = floorf(posY + skew);
+	int indexX = static_cast<int>(cellX);
+	int indexY = static_cast<int>(cellY);
+
+	float unskew = (cellX + cellY) * SIMPLEX_UNSKEW_2D;
+	float disp0X = posX - (cellX - unskew);
+	float disp0Y = posY - (cellY - unskew);
+
+	//which of the two triangles in the cell we are in
+	int middleOffsetX = (disp0X > disp0Y) ? 1 : 0;
+	int middleOffsetY = 1 - middleOffsetX;
+
+	float disp1X = disp0X - static_cast<float>(middleOffsetX) + SIMPLEX_UNSKEW_2D;
+	float disp1Y = disp0Y - static_cast<float>(middleOffsetY) + SIMPLEX_UNSKEW_2D;
+	float disp2X = disp0X - 1.f + (2.f * SIMPLEX_UNSKEW_2D);
+	float disp2Y = disp0Y - 1.f + (2.f * SIMPLEX_UNSKEW_2D);
+
+	float total = SimplexCornerContribution2d(indexX, indexY, disp0X, disp0Y, seed);
+	total += SimplexCornerContribution2d(indexX + middleOffsetX, indexY + middleOffsetY, disp1X, disp1Y, seed);
+	total += SimplexCornerContribution2d(indexX + 1, indexY + 1, disp2X, disp2Y, seed);
+	return GetClamped(SIMPLEX_2D_NORMALIZER * total, -1.f, 1.f);
+}
+
+//-----------------------------------------------------------------------------------------------
+// four wide kernels for the batches: the lattice hashes are integer math, which SIMDUtils does not cover, so they are
+//	looked up one lane at a time; the fade curves, gradient dots and lerps then run on all four lanes in the same order
+//	as the single sample kernels above, so the results are bit identical
+//
+inline SIMDFloat4 SmoothStep3Lanes(SIMDFloat4 t)
+{
+	return SIMDMul(SIMDMul(t, t), SIMDSub(SIMDSplat(3.f), SIMDMul(SIMDSplat(2.f), t)));
+}
+
+inline SIMDFloat4 SmoothStep5Lanes(SIMDFloat4 t)
+{
+	SIMDFloat4 polynomial = SIMDAdd(SIMDMul(t, SIMDSub(SIMDMul(SIMDSplat(6.f), t), SIMDSplat(15.f))), SIMDSplat(10.f));
+	return SIMDMul(SIMDMul(SIMDMul(t, t), t), polynomial);
+}
+
+inline SIMDFloat4 LerpLanes(SIMDFloat4 start, SIMDFloat4 end, SIMDFloat4 t)
+{
+	return SIMDAdd(start, SIMDMul(t, SIMDSub(end, start)));
+}
+
+static SIMDFloat4 ValueNoise1dLanes(float const* posXs, unsigned int seed)
+{
+	float fracXs[4];
+	float valueWests[4];
+	float valueEasts[4];
+	for (int lane = 0; lane < 4; ++lane)
+	{
+		float cellX = floorf(posXs[lane]);
+		int indexX = static_cast<int>(cellX);
+		fracXs[lane] = posXs[lane] - cellX;
+		valueWests[lane] = Get1dNoiseNegOneToOne(indexX, seed);
+		valueEasts[lane] = Get1dNoiseNegOneToOne(indexX + 1, seed);
+	}
+
+	SIMDFloat4 tX = SmoothStep3Lanes(SIMDLoad(fracXs));
+	return LerpLanes(SIMDLoad(valueWests), SIMDLoad(valueEasts), tX);
+}
+
+static SIMDFloat4 ValueNoise2dLanes(float const* posXs, float const* posYs, unsigned int seed)
+{
+	float fracXs[4];
+	float fracYs[4];
+	float valueSWs[4];
+	float valueSEs[4];
+	float valueNWs[4];
+	float valueNEs[4];
+	for (int lane = 0; lane < 4; ++lane)
+	{
+		float cellX = floorf(posXs[lane]);
+		float cellY = floorf(posYs[lane]);
+		int indexX = static_cast<int>(cellX);
+		int indexY = static_cast<int>(cellY);
+		fracXs[lane] = posXs[lane] - cellX;
+		fracYs[lane] = posYs[lane] - cellY;
+		valueSWs[lane] = Get2dNoiseNegOneToOne(indexX, indexY, seed);
+		valueSEs[lane] = Get2dNoiseNegOneToOne(indexX + 1, indexY, seed);
+		valueNWs[lane] = Get2dNoiseNegOneToOne(indexX, indexY + 1, seed);
+		valueNEs[lane] = Get2dNoiseNegOneToOne(indexX + 1, indexY + 1, seed);
+	}
+
+	SIMDFloat4 tX = SmoothStep3Lanes(SIMDLoad(fracXs));
+	SIMDFloat4 tY = SmoothStep3Lanes(SIMDLoad(fracYs));
+	SIMDFloat4 valueSouth = LerpLanes(SIMDLoad(valueSWs), SIMDLoad(valueSEs), tX);
+	SIMDFloat4 valueNorth = LerpLanes(SIMDLoad(valueNWs), SIMDLoad(valueNEs), tX);
+	return LerpLanes(valueSouth, valueNorth, tY);
+}
+
+static SIMDFloat4 PerlinNoise1dLanes(float const* posXs, unsigned int seed)
+{
+	float fracXs[4];
+	float slopeWests[4];
+	float slopeEasts[4];
+	for (int lane = 0; lane < 4; ++lane)
+	{
+		float cellX = floorf(posXs[lane]);
+		int indexX = static_cast<int>(cellX);
+		fracXs[lane] = posXs[lane] - cellX;
+		slopeWests[lane] = Get1dNoiseNegOneToOne(indexX, seed);
+		slopeEasts[lane] = Get1dNoiseNegOneToOne(indexX + 1, seed);
+	}
+
+	SIMDFloat4 fracX = SIMDLoad(fracXs);
+	SIMDFloat4 tX = SmoothStep5Lanes(fracX);
+	SIMDFloat4 dotWest = SIMDMul(SIMDLoad(slopeWests), fracX);
+	SIMDFloat4 dotEast = SIMDMul(SIMDLoad(slopeEasts), SIMDSub(fracX, SIMDSplat(1.f)));
+	return SIMDMul(SIMDSplat(PERLIN_1D_NORMALIZER), LerpLanes(dotWest, dotEast, tX));
+}
+
+static SIMDFloat4 PerlinNoise2dLanes(float const* posXs, float const* posYs, unsigned int seed)
+{
+	//[corner][lane], corners in SW, SE, NW, NE order
+	float fracXs[4];
+	float fracYs[4];
+	float gradientXs[4][4];
+	float gradientYs[4][4];
+	for (int lane = 0; lane < 4; ++lane)
+	{
+		float cellX = floorf(posXs[lane]);
+		float cellY = floorf(posYs[lane]);
+		int indexX = static_cast<int>(cellX);
+		int indexY = static_cast<int>(cellY);
+		fracXs[lane] = posXs[lane] - cellX;
+		fracYs[lane] = posYs[lane] - cellY;
+		for (int corner = 0; corner < 4; ++corner)
+		{
+			float const* gradient = PERLIN_GRADIENTS_2D[Get2dNoiseUint(indexX + (corner & 1), indexY + (corner >> 1), seed) & 7u];
+			gradientXs[corner][lane] = gradient[0];
+			gradientYs[corner][lane] = gradient[1];
+		}
+	}
+
+	SIMDFloat4 fracX = SIMDLoad(fracXs);
+	SIMDFloat4 fracY = SIMDLoad(fracYs);
+	SIMDFloat4 fracXMinusOne = SIMDSub(fracX, SIMDSplat(1.f));
+	SIMDFloat4 fracYMinusOne = SIMDSub(fracY, SIMDSplat(1.f));
+	SIMDFloat4 tX = SmoothStep5Lanes(fracX);
+	SIMDFloat4 tY = SmoothStep5Lanes(fracY);
+
+	SIMDFloat4 dotSW = SIMDAdd(SIMDMul(SIMDLoad(gradientXs[0]), fracX), SIMDMul(SIMDLoad(gradientYs[0]), fracY));
+	SIMDFloat4 dotSE = SIMDAdd(SIMDMul(SIMDLoad(gradientXs[1]), fracXMinusOne), SIMDMul(SIMDLoad(gradientYs[1]), fracY));
+	SIMDFloat4 dotNW = SIMDAdd(SIMDMul(SIMDLoad(gradientXs[2]), fracX), SIMDMul(SIMDLoad(gradientYs[2]), fracYMinusOne));
+	SIMDFloat4 dotNE = SIMDAdd(SIMDMul(SIMDLoad(gradientXs[3]), fracXMinusOne), SIMDMul(SIMDLoad(gradientYs[3]), fracYMinusOne));
+
+	SIMDFloat4 dotSouth = LerpLanes(dotSW, dotSE, tX);
+	SIMDFloat4 dotNorth = LerpLanes(dotNW, dotNE, tX);
+	return SIMDMul(SIMDSplat(PERLIN_2D_NORMALIZER), LerpLanes(dotSouth, dotNorth, tY));
+}
+
+//-----------------------------------------------------------------------------------------------
+// octave summing, the batch versions walk octaves in the outer loop but accumulate in the same order as the single
+//	versions, so both give bit identical results
+//
+template <float (*NoiseFunc)(float, unsigned int)>
+static float ComputeFractalNoise1d(float posX, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	float total = 0.f;
+	float totalAmplitude = 0.f;
+	float amplitude = 1.f;
+	float frequency = 1.f / scale;
+	for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+	{
+		float offset = OCTAVE_OFFSET * static_cast<float>(octaveNum);
+		total += amplitude * NoiseFunc((posX * frequency) + offset, seed + octaveNum);
+		totalAmplitude += amplitude;
+		amplitude *= octavePersistence;
+		frequency *= octaveScale;
+	}
+
+	if (renormalize && totalAmplitude > 0.f)
+	{
+		total /= totalAmplitude;
+	}
+	return total;
+}
+
+template <float (*NoiseFunc)(float, float, unsigned int)>
+static float ComputeFractalNoise2d(float posX, float posY, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	float total = 0.f;
+	float totalAmplitude = 0.f;
+	float amplitude = 1.f;
+	float frequency = 1.f / scale;
+	for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+	{
+		float offset = OCTAVE_OFFSET * static_cast<float>(octaveNum);
+		total += amplitude * NoiseFunc((posX * frequency) + offset, (posY * frequency) + offset, seed + octaveNum);
+		totalAmplitude += amplitude;
+		amplitude *= octavePersistence;
+		frequency *= octaveScale;
+	}
+
+	if (renormalize && totalAmplitude > 0.f)
+	{
+		total /= totalAmplitude;
+	}
+	return total;
+}
+
+template <float (*NoiseFunc)(float, float, float, unsigned int)>
+static float ComputeFractalNoise3d(float posX, float posY, float posZ, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	float total = 0.f;
+	float totalAmplitude = 0.f;
+	float amplitude = 1.f;
+	float frequency = 1.f / scale;
+	for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+	{
+		float offset = OCTAVE_OFFSET * static_cast<float>(octaveNum);
+		total += amplitude * NoiseFunc((posX * frequency) + offset, (posY * frequency) + offset, (posZ * frequency) + offset, seed + octaveNum);
+		totalAmplitude += amplitude;
+		amplitude *= octavePersistence;
+		frequency *= octaveScale;
+	}
+
+	if (renormalize && totalAmplitude > 0.f)
+	{
+		total /= totalAmplitude;
+	}
+	return total;
+}
+
+//-----------------------------------------------------------------------------------------------
+static void RenormalizeFractalBatch(int count, float* out_values, float totalAmplitude, bool renormalize)
+{
+	if (!renormalize || totalAmplitude <= 0.f)
+	{
+		return;
+	}
+
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] /= totalAmplitude;
+	}
+}
+
+template <float (*NoiseFunc)(float, float, unsigned int)>
+static void ComputeFractalNoise2dBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = 0.f;
+	}
+
+	float totalAmplitude = 0.f;
+	float amplitude = 1.f;
+	float frequency = 1.f / scale;
+	for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+	{
+		float offset = OCTAVE_OFFSET * static_cast<float>(octaveNum);
+		unsigned int octaveSeed = seed + octaveNum;
+		for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+		{
+			out_values[sampleNum] += amplitude * NoiseFunc((posXs[sampleNum] * frequency) + offset, (posYs[sampleNum] * frequency) + offset, octaveSeed);
+		}
+		totalAmplitude += amplitude;
+		amplitude *= octavePersistence;
+		frequency *= octaveScale;
+	}
+
+	RenormalizeFractalBatch(count, out_values, totalAmplitude, renormalize);
+}
+
+template <float (*NoiseFunc)(float, float, float, unsigned int)>
+static void ComputeFractalNoise3dBatch(int count, float const* posXs, float const* posYs, float const* posZs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = 0.f;
+	}
+
+	float totalAmplitude = 0.f;
+	float amplitude = 1.f;
+	float frequency = 1.f / scale;
+	for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+	{
+		float offset = OCTAVE_OFFSET * static_cast<float>(octaveNum);
+		unsigned int octaveSeed = seed + octaveNum;
+		for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+		{
+			out_values[sampleNum] += amplitude * NoiseFunc((posXs[sampleNum] * frequency) + offset, (posYs[sampleNum] * frequency) + offset, (posZs[sampleNum] * frequency) + offset, octaveSeed);
+		}
+		totalAmplitude += amplitude;
+		amplitude *= octavePersistence;
+		frequency *= octaveScale;
+	}
+
+	RenormalizeFractalBatch(count, out_values, totalAmplitude, renormalize);
+}
+
+//the last group of a batch repeats its final sample in the unused lanes and only writes back the real ones
+template <SIMDFloat4 (*NoiseLanesFunc)(float const*, unsigned int)>
+static void ComputeFractalNoise1dLanesBatch(int count, float const* posXs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = 0.f;
+	}
+
+	float totalAmplitude = 0.f;
+	float amplitude = 1.f;
+	float frequency = 1.f / scale;
+	for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+	{
+		float offset = OCTAVE_OFFSET * static_cast<float>(octaveNum);
+		unsigned int octaveSeed = seed + octaveNum;
+		SIMDFloat4 amplitudeLanes = SIMDSplat(amplitude);
+		for (int firstSampleNum = 0; firstSampleNum < count; firstSampleNum += 4)
+		{
+			int numLanes = (count - firstSampleNum < 4) ? count - firstSampleNum : 4;
+			float lanePosXs[4];
+			float laneTotals[4];
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				int sampleNum = firstSampleNum + ((lane < numLanes) ? lane : numLanes - 1);
+				lanePosXs[lane] = (posXs[sampleNum] * frequency) + offset;
+				laneTotals[lane] = out_values[sampleNum];
+			}
+
+			SIMDFloat4 total = SIMDAdd(SIMDLoad(laneTotals), SIMDMul(amplitudeLanes, NoiseLanesFunc(lanePosXs, octaveSeed)));
+			SIMDStore(laneTotals, total);
+			for (int lane = 0; lane < numLanes; ++lane)
+			{
+				out_values[firstSampleNum + lane] = laneTotals[lane];
+			}
+		}
+		totalAmplitude += amplitude;
+		amplitude *= octavePersistence;
+		frequency *= octaveScale;
+	}
+
+	RenormalizeFractalBatch(count, out_values, totalAmplitude, renormalize);
+}
+
+template <SIMDFloat4 (*NoiseLanesFunc)(float const*, float const*, unsigned int)>
+static void ComputeFractalNoise2dLanesBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	for (int sampleNum = 0; sampleNum < count; ++sampleNum)
+	{
+		out_values[sampleNum] = 0.f;
+	}
+
+	float totalAmplitude = 0.f;
+	float amplitude = 1.f;
+	float frequency = 1.f / scale;
+	for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+	{
+		float offset = OCTAVE_OFFSET * static_cast<float>(octaveNum);
+		unsigned int octaveSeed = seed + octaveNum;
+		SIMDFloat4 amplitudeLanes = SIMDSplat(amplitude);
+		for (int firstSampleNum = 0; firstSampleNum < count; firstSampleNum += 4)
+		{
+			int numLanes = (count - firstSampleNum < 4) ? count - firstSampleNum : 4;
+			float lanePosXs[4];
+			float lanePosYs[4];
+			float laneTotals[4];
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				int sampleNum = firstSampleNum + ((lane < numLanes) ? lane : numLanes - 1);
+				lanePosXs[lane] = (posXs[sampleNum] * frequency) + offset;
+				lanePosYs[lane] = (posYs[sampleNum] * frequency) + offset;
+				laneTotals[lane] = out_values[sampleNum];
+			}
+
+			SIMDFloat4 total = SIMDAdd(SIMDLoad(laneTotals), SIMDMul(amplitudeLanes, NoiseLanesFunc(lanePosXs, lanePosYs, octaveSeed)));
+			SIMDStore(laneTotals, total);
+			for (int lane = 0; lane < numLanes; ++lane)
+			{
+				out_values[firstSampleNum + lane] = laneTotals[lane];
+			}
+		}
+		totalAmplitude += amplitude;
+		amplitude *= octavePersistence;
+		frequency *= octaveScale;
+	}
+
+	RenormalizeFractalBatch(count, out_values, totalAmplitude, renormalize);
+}
+
+//-----------------------------------------------------------------------------------------------
+float Compute1dValueNoise(float posX, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	return ComputeFractalNoise1d<ValueNoise1d>(posX, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+float Compute2dValueNoise(float posX, float posY, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	return ComputeFractalNoise2d<ValueNoise2d>(posX, posY, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+float Compute3dValueNoise(float posX, float posY, float posZ, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	return ComputeFractalNoise3d<ValueNoise3d>(posX, posY, posZ, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+float Compute1dPerlinNoise(float posX, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	return ComputeFractalNoise1d<PerlinNoise1d>(posX, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+float Compute2dPerlinNoise(float posX, float posY, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	return ComputeFractalNoise2d<PerlinNoise2d>(posX, posY, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+float Compute3dPerlinNoise(float posX, float posY, float posZ, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	return ComputeFractalNoise3d<PerlinNoise3d>(posX, posY, posZ, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+float Compute2dSimplexNoise(float posX, float posY, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	return ComputeFractalNoise2d<SimplexNoise2d>(posX, posY, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+//-----------------------------------------------------------------------------------------------
+void Compute1dValueNoiseBatch(int count, float const* posXs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	ComputeFractalNoise1dLanesBatch<ValueNoise1dLanes>(count, posXs, out_values, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+void Compute2dValueNoiseBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	ComputeFractalNoise2dLanesBatch<ValueNoise2dLanes>(count, posXs, posYs, out_values, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+void Compute3dValueNoiseBatch(int count, float const* posXs, float const* posYs, float const* posZs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	ComputeFractalNoise3dBatch<ValueNoise3d>(count, posXs, posYs, posZs, out_values, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+void Compute1dPerlinNoiseBatch(int count, float const* posXs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	ComputeFractalNoise1dLanesBatch<PerlinNoise1dLanes>(count, posXs, out_values, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+void Compute2dPerlinNoiseBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	ComputeFractalNoise2dLanesBatch<PerlinNoise2dLanes>(count, posXs, posYs, out_values, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+void Compute3dPerlinNoiseBatch(int count, float const* posXs, float const* posYs, float const* posZs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	ComputeFractalNoise3dBatch<PerlinNoise3d>(count, posXs, posYs, posZs, out_values, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+void Compute2dSimplexNoiseBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+	ComputeFractalNoise2dBatch<SimplexNoise2d>(count, posXs, posYs, out_values, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
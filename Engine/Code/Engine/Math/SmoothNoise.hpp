@@ -0,0 +1,33 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// SmoothNoise.hpp
+//
+// Fractal (multi-octave) value, Perlin and simplex noise built on RawNoise.hpp, so it is stateless and
+//	deterministic: the same position, parameters and seed give the same value on any thread.
+//	Results are in [-1,1]. scale is the world size of one noise cell at the first octave; each further octave
+//	has octaveScale times the frequency and octavePersistence times the amplitude of the one before it.
+//	renormalize divides by the total amplitude of all octaves so adding octaves does not widen the range.
+//
+
+float Compute1dValueNoise(float posX, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+float Compute2dValueNoise(float posX, float posY, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+float Compute3dValueNoise(float posX, float posY, float posZ, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+
+float Compute1dPerlinNoise(float posX, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+float Compute2dPerlinNoise(float posX, float posY, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+float Compute3dPerlinNoise(float posX, float posY, float posZ, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+
+float Compute2dSimplexNoise(float posX, float posY, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+
+//-----------------------------------------------------------------------------------------------
+//batch versions for filling grids and point sets, same values as calling the single versions in a loop
+//	octave setup is done once for the whole batch; samples are independent so callers may also split a batch across threads
+//	out_values is cleared first and built up one octave at a time, so it must not alias any of the position arrays
+//	1D and 2D value and Perlin noise run four samples per SIMD op; 3D and simplex noise loop over the single sample kernels
+void Compute1dValueNoiseBatch(int count, float const* posXs, float* out_values, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute2dValueNoiseBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute3dValueNoiseBatch(int count, float const* posXs, float const* posYs, float const* posZs, float* out_values, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute1dPerlinNoiseBatch(int count, float const* posXs, float* out_values, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute2dPerlinNoiseBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute3dPerlinNoiseBatch(int count, float const* posXs, float const* posYs, float const* posZs, float* out_values, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute2dSimplexNoiseBatch(int count, float const* posXs, float const* posYs, float* out_values, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
@@ -1,5 +1,117 @@
 #include "Engine/Math/Splines.hpp"
 #include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <math.h>
+
+//Arc Length Table 2D
+//-------------------------------------------------------------------------------------------------------------------
+void ArcLengthTable2D::Clear()
+{
+	m_samplePositions.clear();
+	m_cumulativeLengths.clear();
+}
+
+void ArcLengthTable2D::Reserve(int numSamples)
+{
+	m_samplePositions.reserve(numSamples);
+	m_cumulativeLengths.reserve(numSamples);
+}
+
+void ArcLengthTable2D::AddSample(Vec2 const& position)
+{
+	float length = 0.f;
+	if (!m_samplePositions.empty())
+	{
+		length = m_cumulativeLengths.back() + (position - m_samplePositions.back()).GetLength();
+	}
+	m_samplePositions.push_back(position);
+	m_cumulativeLengths.push_back(length);
+}
+
+float ArcLengthTable2D::GetTotalLength() const
+{
+	return m_cumulativeLengths.empty() ? 0.f : m_cumulativeLengths.back();
+}
+
+int ArcLengthTable2D::GetSegmentIndexAtDistance(float distanceAlongCurve, int firstSegmentToSearch) const
+{
+	//first segment whose end reaches the distance, same pick as walking the curve
+	std::vector<float>::const_iterator searchStart = m_cumulativeLengths.begin() + firstSegmentToSearch + 1;
+	int segmentIndex = (int)(std::lower_bound(searchStart, m_cumulativeLengths.end(), distanceAlongCurve) - m_cumulativeLengths.begin()) - 1;
+	return std::min(segmentIndex, GetNumSamples() - 2);
+}
+
+float ArcLengthTable2D::GetFractionAlongSegment(int segmentIndex, float distanceAlongCurve) const
+{
+	float segmentStart = m_cumulativeLengths[segmentIndex];
+	float segmentEnd = m_cumulativeLengths[segmentIndex + 1];
+	if (segmentEnd <= segmentStart)
+	{
+		return 0.f;
+	}
+	return GetClampedFractionWithinRange(distanceAlongCurve, segmentStart, segmentEnd);
+}
+
+float ArcLengthTable2D::GetParametricAtDistance(float distanceAlongCurve) const
+{
+	float parametric = 0.f;
+	GetParametricsAtDistances(1, &distanceAlongCurve, &parametric);
+	return parametric;
+}
+
+Vec2 ArcLengthTable2D::EvaluateAtDistance(float distanceAlongCurve) const
+{
+	Vec2 position;
+	EvaluateAtDistances(1, &distanceAlongCurve, &position);
+	return position;
+}
+
+void ArcLengthTable2D::EvaluateAtDistances(int numDistances, float const* distancesAlongCurve, Vec2* out_positions) const
+{
+	int numSamples = GetNumSamples();
+	if (numSamples < 2)
+	{
+		Vec2 onlyPosition = (numSamples == 1) ? m_samplePositions[0] : Vec2::ZERO;
+		std::fill(out_positions, out_positions + numDistances, onlyPosition);
+		return;
+	}
+
+	//ascending runs only search past the previous answer
+	int prevSegmentIndex = 0;
+	float prevDistance = 0.f;
+	for (int distanceNum = 0; distanceNum < numDistances; ++distanceNum)
+	{
+		float distance = distancesAlongCurve[distanceNum];
+		int firstSegmentToSearch = (distanceNum > 0 && distance >= prevDistance) ? prevSegmentIndex : 0;
+		int segmentIndex = GetSegmentIndexAtDistance(distance, firstSegmentToSearch);
+		out_positions[distanceNum] = Lerp(m_samplePositions[segmentIndex], m_samplePositions[segmentIndex + 1], GetFractionAlongSegment(segmentIndex, distance));
+		prevSegmentIndex = segmentIndex;
+		prevDistance = distance;
+	}
+}
+
+void ArcLengthTable2D::GetParametricsAtDistances(int numDistances, float const* distancesAlongCurve, float* out_parametrics) const
+{
+	int numSamples = GetNumSamples();
+	if (numSamples < 2)
+	{
+		std::fill(out_parametrics, out_parametrics + numDistances, 0.f);
+		return;
+	}
+
+	float parametricPerSegment = 1.f / (float)(numSamples - 1);
+	int prevSegmentIndex = 0;
+	float prevDistance = 0.f;
+	for (int distanceNum = 0; distanceNum < numDistances; ++distanceNum)
+	{
+		float distance = distancesAlongCurve[distanceNum];
+		int firstSegmentToSearch = (distanceNum > 0 && distance >= prevDistance) ? prevSegmentIndex : 0;
+		int segmentIndex = GetSegmentIndexAtDistance(distance, firstSegmentToSearch);
+		out_parametrics[distanceNum] = ((float)segmentIndex + GetFractionAlongSegment(segmentIndex, distance)) * parametricPerSegment;
+		prevSegmentIndex = segmentIndex;
+		prevDistance = distance;
+	}
+}
 
 
 //Cubic Bezier Curve 2D
@@ -29,46 +141,89 @@ Vec2 CubicBezierCurve2D::EvaluateAtParametric(float parametricZeroToOne) const
 
 float CubicBezierCurve2D::GetApproximateLength(int numSubdivisions) const
 {
+	return GetArcLengthTable(numSubdivisions).GetTotalLength();
+}
+
+Vec2 CubicBezierCurve2D::EvaluateAtApproximateDistance(float distanceAlongCurve, int numSubdivisions) const
+{
+	ArcLengthTable2D const& arcLengthTable = GetArcLengthTable(numSubdivisions);
 
-	float length = 0;
-	float tStep = 1.f / numSubdivisions;
-	for (int subDivNum = 0; subDivNum < numSubdivisions; ++subDivNum)
+	//If distanceAlongCurve is greater than approximate length of curve
+	if (distanceAlongCurve > arcLengthTable.GetTotalLength())
 	{
-		float t = GetClamped(subDivNum * tStep, 0.f, 1.f);
-		float nextT = GetClamped((subDivNum + 1.f) * tStep, 0.f, 1.f);
-		Vec2 start = EvaluateAtParametric(t);
-		Vec2 end = EvaluateAtParametric(nextT);
-		length += (end - start).GetLength();
+		return m_end;
 	}
-	return length;
+	return arcLengthTable.EvaluateAtDistance(distanceAlongCurve);
 }
 
-Vec2 CubicBezierCurve2D::EvaluateAtApproximateDistance(float distanceAlongCurve, int numSubdivisions) const
+ArcLengthTable2D const& CubicBezierCurve2D::GetArcLengthTable(int numSubdivisions) const
 {
-	float length = 0;
+	bool isTableCurrent = m_arcLengthTable.GetNumSamples() == numSubdivisions + 1
+		&& m_arcLengthTableControlPoints[0] == m_start && m_arcLengthTableControlPoints[1] == m_guidePos1
+		&& m_arcLengthTableControlPoints[2] == m_guidePos2 && m_arcLengthTableControlPoints[3] == m_end;
+	if (isTableCurrent)
+	{
+		return m_arcLengthTable;
+	}
+
+	m_arcLengthTableControlPoints[0] = m_start;
+	m_arcLengthTableControlPoints[1] = m_guidePos1;
+	m_arcLengthTableControlPoints[2] = m_guidePos2;
+	m_arcLengthTableControlPoints[3] = m_end;
+
+	m_arcLengthTable.Clear();
+	m_arcLengthTable.Reserve(numSubdivisions + 1);
 	float tStep = 1.f / numSubdivisions;
-	for (int subDivNum = 0; subDivNum < numSubdivisions; ++subDivNum)
+	for (int sampleNum = 0; sampleNum <= numSubdivisions; ++sampleNum)
 	{
-		float t = GetClamped(subDivNum * tStep, 0.f, 1.f);
-		float nextT = GetClamped((subDivNum + 1.f) * tStep, 0.f, 1.f);
+		m_arcLengthTable.AddSample(EvaluateAtParametric(GetClamped(sampleNum * tStep, 0.f, 1.f)));
+	}
+	return m_arcLengthTable;
+}
 
-		Vec2 start = EvaluateAtParametric(t);
-		Vec2 end = EvaluateAtParametric(nextT);
-		Vec2 displacement = end - start;
-		float subDivLength = displacement.GetLength();
-		float prevLength = length;
-		length += subDivLength;
+void CubicBezierCurve2D::AddFlattenedPoints(std::vector<Vec2>& out_points, float flatnessTolerance) const
+{
+	constexpr int MAX_SUBDIVISION_DEPTH = 16;
+	if (out_points.empty())
+	{
+		out_points.push_back(m_start);
+	}
 
-		if (distanceAlongCurve <= length)
+	//depth-first de Casteljau halving, the second half waits on the stack while the first half is refined
+	struct PendingCurve
+	{
+		Vec2 m_points[4];
+		int m_depth;
+	};
+	PendingCurve stack[MAX_SUBDIVISION_DEPTH + 1];
+	int stackSize = 1;
+	stack[0] = { { m_start, m_guidePos1, m_guidePos2, m_end }, 0 };
+	float toleranceSquaredTimes16 = 16.f * flatnessTolerance * flatnessTolerance;
+
+	while (stackSize > 0)
+	{
+		PendingCurve curve = stack[--stackSize];
+		Vec2 const* p = curve.m_points;
+
+		//bound on how far the curve strays from its chord (control points vs. the chord's 1/3 and 2/3 points)
+		Vec2 u = (3.f * p[1]) - (2.f * p[0]) - p[3];
+		Vec2 v = (3.f * p[2]) - p[0] - (2.f * p[3]);
+		float maxDeviationSquaredTimes16 = fmaxf(u.x * u.x, v.x * v.x) + fmaxf(u.y * u.y, v.y * v.y);
+		if (maxDeviationSquaredTimes16 <= toleranceSquaredTimes16 || curve.m_depth >= MAX_SUBDIVISION_DEPTH)
 		{
-			float fractionAlongSubDiv = GetFractionWithinRange(distanceAlongCurve, prevLength, length);
-			return Lerp(start, end, fractionAlongSubDiv);
+			out_points.push_back(p[3]);
+			continue;
 		}
 
+		Vec2 ab = 0.5f * (p[0] + p[1]);
+		Vec2 bc = 0.5f * (p[1] + p[2]);
+		Vec2 cd = 0.5f * (p[2] + p[3]);
+		Vec2 abc = 0.5f * (ab + bc);
+		Vec2 bcd = 0.5f * (bc + cd);
+		Vec2 mid = 0.5f * (abc + bcd);
+		stack[stackSize++] = { { mid, bcd, cd, p[3] }, curve.m_depth + 1 };
+		stack[stackSize++] = { { p[0], ab, abc, mid }, curve.m_depth + 1 };
 	}
-
-	//If distanceAlongCurve is greater than approximate length of curve
-	return m_end;
 }
 
 //Cubic Hermite Curve 2D
@@ -99,14 +254,25 @@ Vec2 CubicHermiteCurve2D::EvaluateAtParametric(float parametricZeroToOne) const
 
 float CubicHermiteCurve2D::GetApproximateLength(int numSubdivisions) const
 {
-	CubicBezierCurve2D bezierCurve(*this);
-	return bezierCurve.GetApproximateLength(numSubdivisions);
+	return GetArcLengthTable(numSubdivisions).GetTotalLength();
 }
 
 Vec2 CubicHermiteCurve2D::EvaluateAtApproximateDistance(float distanceAlongCurve, int numSubdivisions) const
+{
+	GetArcLengthTable(numSubdivisions);
+	return m_bezierCache.EvaluateAtApproximateDistance(distanceAlongCurve, numSubdivisions);
+}
+
+ArcLengthTable2D const& CubicHermiteCurve2D::GetArcLengthTable(int numSubdivisions) const
 {
 	CubicBezierCurve2D bezierCurve(*this);
-	return bezierCurve.EvaluateAtApproximateDistance(distanceAlongCurve, numSubdivisions);
+	bool isCacheCurrent = m_bezierCache.m_start == bezierCurve.m_start && m_bezierCache.m_guidePos1 == bezierCurve.m_guidePos1
+		&& m_bezierCache.m_guidePos2 == bezierCurve.m_guidePos2 && m_bezierCache.m_end == bezierCurve.m_end;
+	if (!isCacheCurrent)
+	{
+		m_bezierCache = bezierCurve;
+	}
+	return m_bezierCache.GetArcLengthTable(numSubdivisions);
 }
 
 void CubicHermiteCurve2D::SetStartVelocity(Vec2 const& velocity)
@@ -211,42 +377,64 @@ Vec2 CubicHermiteSpline2D::EvaluateAtParametric(float parametricZeroToOne) const
 
 float CubicHermiteSpline2D::GetApproximateLength(int numSubdivisionsPerCurve) const
 {
-	std::vector<CubicHermiteCurve2D> curves = GetAllCurves();
-	float length = 0;
-	for (int curveNum = 0; curveNum < (int)curves.size(); ++curveNum)
+	return GetArcLengthTable(numSubdivisionsPerCurve).GetTotalLength();
+}
+
+Vec2 CubicHermiteSpline2D::EvaluateAtApproximateDistance(float distanceAlongSpline, int numSubdivisionsPerCurve) const
+{
+	ArcLengthTable2D const& arcLengthTable = GetArcLengthTable(numSubdivisionsPerCurve);
+	if (!m_points.empty() && distanceAlongSpline > arcLengthTable.GetTotalLength())
 	{
-		length += curves[curveNum].GetApproximateLength(numSubdivisionsPerCurve);
+		return m_points[(int)m_points.size() - 1].m_position;
 	}
-
-	return length;
+	return arcLengthTable.EvaluateAtDistance(distanceAlongSpline);
 }
 
-Vec2 CubicHermiteSpline2D::EvaluateAtApproximateDistance(float distanceAlongSpline, int numSubdivisionsPerCurve) const
+ArcLengthTable2D const& CubicHermiteSpline2D::GetArcLengthTable(int numSubdivisionsPerCurve) const
 {
-	float length = 0;
-	std::vector<CubicHermiteCurve2D> curves = GetAllCurves();
-	for (int curveNum = 0; curveNum < (int)curves.size(); ++curveNum)
+	const int NUM_CURVES = GetNumberOfCurves();
+	//a single point spline gets a one sample table, so every distance lands on that point
+	int numSamples = (NUM_CURVES > 0) ? (NUM_CURVES * numSubdivisionsPerCurve) + 1 : (int)m_points.size();
+	bool isTableCurrent = m_arcLengthTable.GetNumSamples() == numSamples && m_arcLengthTablePoints.size() == m_points.size()
+		&& std::equal(m_points.begin(), m_points.end(), m_arcLengthTablePoints.begin(), [](HermitePoint2D const& a, HermitePoint2D const& b)
+			{
+				return a.m_position == b.m_position && a.m_velocity == b.m_velocity;
+			});
+	if (isTableCurrent)
 	{
-		CubicHermiteCurve2D curve = curves[curveNum];
-		float tStep = 1.f / numSubdivisionsPerCurve;
-		for (int subDivNum = 0; subDivNum < numSubdivisionsPerCurve; ++subDivNum)
+		return m_arcLengthTable;
+	}
+
+	m_arcLengthTablePoints = m_points;
+	m_arcLengthTable.Clear();
+	m_arcLengthTable.Reserve(numSamples);
+	if (NUM_CURVES == 0 && !m_points.empty())
+	{
+		m_arcLengthTable.AddSample(m_points[0].m_position);
+	}
+	float tStep = 1.f / numSubdivisionsPerCurve;
+	for (int curveNum = 0; curveNum < NUM_CURVES; ++curveNum)
+	{
+		CubicBezierCurve2D curve(CubicHermiteCurve2D(m_points[curveNum], m_points[curveNum + 1]));
+		if (curveNum == 0)
 		{
-			float t = GetClamped(subDivNum * tStep, 0.f, 1.f);
-			float nextT = GetClamped((subDivNum + 1.f) * tStep, 0.f, 1.f);
-
-			Vec2 start = curve.EvaluateAtParametric(t);
-			Vec2 end = curve.EvaluateAtParametric(nextT);
-			Vec2 displacement = end - start;
-			float subDivLength = displacement.GetLength();
-			float prevLength = length;
-			length += subDivLength;
-			if (distanceAlongSpline <= length)
-			{
-				float fractionAlongSubDiv = GetClampedFractionWithinRange(distanceAlongSpline, prevLength, length);
-				return Lerp(start, end, fractionAlongSubDiv);
-			}
+			m_arcLengthTable.AddSample(curve.EvaluateAtParametric(0.f));
+		}
+
+		//each curve's start is the previous curve's end, so it is only sampled once
+		for (int subDivNum = 1; subDivNum <= numSubdivisionsPerCurve; ++subDivNum)
+		{
+			m_arcLengthTable.AddSample(curve.EvaluateAtParametric(GetClamped(subDivNum * tStep, 0.f, 1.f)));
 		}
 	}
-	return m_points[(int)m_points.size() - 1].m_position;
+	return m_arcLengthTable;
 }
 
+void CubicHermiteSpline2D::AddFlattenedPoints(std::vector<Vec2>& out_points, float flatnessTolerance) const
+{
+	for (int curveNum = 0; curveNum < GetNumberOfCurves(); ++curveNum)
+	{
+		CubicBezierCurve2D curve(CubicHermiteCurve2D(m_points[curveNum], m_points[curveNum + 1]));
+		curve.AddFlattenedPoints(out_points, flatnessTolerance);
+	}
+}
@@ -3,6 +3,36 @@
 #include "Engine/Math/Vec2.hpp"
 #include <vector>
 
+//-------------------------------------------------------------------------------------------------------------------
+// polyline samples of a curve, evenly spaced in the parametric, with the running length at each sample
+//	distance lookups are a binary search instead of re-walking the curve
+//	curves and splines keep one of these cached and rebuild it when their control points or subdivisions change
+//	the cache is rebuilt lazily inside const calls, so when sharing a curve across threads grab the table first and query that
+class ArcLengthTable2D
+{
+public:
+	void	Clear();
+	void	Reserve(int numSamples);
+	void	AddSample(Vec2 const& position);
+
+	int		GetNumSamples() const { return (int)m_samplePositions.size(); }
+	float	GetTotalLength() const;
+	float	GetParametricAtDistance(float distanceAlongCurve) const;	//0 to 1 across all samples
+	Vec2	EvaluateAtDistance(float distanceAlongCurve) const;		//along the sample polyline, clamped to the ends
+
+	//cheapest when distances are sorted ascending (e.g. many followers on one path), any order works
+	void	EvaluateAtDistances(int numDistances, float const* distancesAlongCurve, Vec2* out_positions) const;
+	void	GetParametricsAtDistances(int numDistances, float const* distancesAlongCurve, float* out_parametrics) const;
+
+private:
+	int		GetSegmentIndexAtDistance(float distanceAlongCurve, int firstSegmentToSearch) const;
+	float	GetFractionAlongSegment(int segmentIndex, float distanceAlongCurve) const;
+
+private:
+	std::vector<Vec2>	m_samplePositions;
+	std::vector<float>	m_cumulativeLengths;	//length of the polyline from the first sample to each sample
+};
+
 class CubicHermiteCurve2D;
 class CubicBezierCurve2D
 {
@@ -21,6 +51,15 @@ public:
 	Vec2 EvaluateAtParametric(float parametricZeroToOne) const;
 	float GetApproximateLength(int numSubdivisions = 64) const;
 	Vec2 EvaluateAtApproximateDistance(float distanceAlongCurve, int numSubdivisions = 64) const;
+	ArcLengthTable2D const& GetArcLengthTable(int numSubdivisions = 64) const;
+
+	//adaptive subdivision: every piece stays within flatnessTolerance of the true curve, so straight parts get few points and bends get many
+	//appends the points after the start (the start too when out_points is empty)
+	void AddFlattenedPoints(std::vector<Vec2>& out_points, float flatnessTolerance) const;
+
+private:
+	mutable ArcLengthTable2D m_arcLengthTable;
+	mutable Vec2 m_arcLengthTableControlPoints[4];	//control points the table was built from
 };
 
 struct HermitePoint2D
@@ -43,11 +82,14 @@ public:
 	Vec2 EvaluateAtParametric(float parametricZeroToOne) const;
 	float GetApproximateLength(int numSubdivisions = 64) const;
 	Vec2 EvaluateAtApproximateDistance(float distanceAlongCurve, int numSubdivisions = 64) const;
+	ArcLengthTable2D const& GetArcLengthTable(int numSubdivisions = 64) const;
 	void SetStartVelocity(Vec2 const& velocity);
 	void SetEndVelocity(Vec2 const& velocity);
 	Vec2 GetStartVelocity() const;
 	Vec2 GetEndVelocity() const;
 
+private:
+	mutable CubicBezierCurve2D m_bezierCache;	//keeps the arc length table, rebuilt when the hermite points change
 };
 
 typedef std::vector<HermitePoint2D>(HermitePoints2D);
@@ -69,5 +111,11 @@ public:
 	Vec2 EvaluateAtParametric(float parametricZeroToOne) const;
 	float GetApproximateLength(int numSubdivisionsPerCurve = 64) const;
 	Vec2 EvaluateAtApproximateDistance(float distanceAlongSpline, int numSubdivisionsPerCurve = 64) const;
+	ArcLengthTable2D const& GetArcLengthTable(int numSubdivisionsPerCurve = 64) const;
+	void AddFlattenedPoints(std::vector<Vec2>& out_points, float flatnessTolerance) const; //every curve in order, see CubicBezierCurve2D::AddFlattenedPoints
+
+private:
+	mutable ArcLengthTable2D m_arcLengthTable;
+	mutable HermitePoints2D m_arcLengthTablePoints;	//points the table was built from
 };
 
@@ -0,0 +1,232 @@
+#include "Engine/Math/TileFieldOfView2D.hpp"
+#include "Engine/Core/TileHeatMap.hpp"
+#include "Engine/Core/ThreadPool.hpp"
+#include <algorithm>
+#include <math.h>
+
+//-----------------------------------------------------------------------------------------------
+// one quadrant scan; rows are at distance depth from the viewer and columns run across them
+//	slopes are kept as exact fractions (numerator / denominator, denominator > 0) so tiles exactly on a boundary
+//	round the same way every time, which is what keeps the result symmetric
+struct ShadowcastQuadrant
+{
+	float const*	m_solidValues = nullptr;
+	IntVec2			m_dimensions;
+	float			m_tileSolidValue = 0.f;
+	IntVec2			m_origin;
+	int				m_quadrant = 0;
+	int				m_maxDepth = 0;
+	float			m_radiusSquared = 0.f;
+	unsigned int*	m_visibleBits = nullptr;
+};
+
+static int FloorDivide(int numerator, int denominator)
+{
+	int quotient = numerator / denominator;
+	return (numerator % denominator != 0 && numerator < 0) ? quotient - 1 : quotient;
+}
+
+//depth * slope rounded to the nearest column, halves rounding up / down
+static int GetColumnRoundedTiesUp(int depth, int slopeNumerator, int slopeDenominator)
+{
+	return FloorDivide(2 * depth * slopeNumerator + slopeDenominator, 2 * slopeDenominator);
+}
+
+static int GetColumnRoundedTiesDown(int depth, int slopeNumerator, int slopeDenominator)
+{
+	return -FloorDivide(slopeDenominator - 2 * depth * slopeNumerator, 2 * slopeDenominator);
+}
+
+static IntVec2 const GetQuadrantTileCoords(ShadowcastQuadrant const& scan, int depth, int column)
+{
+	switch (scan.m_quadrant)
+	{
+	case 0:		return IntVec2(scan.m_origin.x + column, scan.m_origin.y + depth);
+	case 1:		return IntVec2(scan.m_origin.x + depth, scan.m_origin.y - column);
+	case 2:		return IntVec2(scan.m_origin.x - column, scan.m_origin.y - depth);
+	default:	return IntVec2(scan.m_origin.x - depth, scan.m_origin.y + column);
+	}
+}
+
+static bool IsTileCoordsOnMap(IntVec2 const& dimensions, IntVec2 const& tileCoords)
+{
+	return tileCoords.x >= 0 && tileCoords.y >= 0 && tileCoords.x < dimensions.x && tileCoords.y < dimensions.y;
+}
+
+static void SetTileVisible(unsigned int* visibleBits, int tileIndex)
+{
+	visibleBits[tileIndex >> 5] |= 1u << (tileIndex & 31);
+}
+
+//the last open run of each row carries on as a loop, every earlier run that a solid tile closes off recurses
+static void ScanShadowcastRows(ShadowcastQuadrant const& scan, int depth, int startNumerator, int startDenominator, int endNumerator, int endDenominator)
+{
+	for (; depth <= scan.m_maxDepth; ++depth)
+	{
+		int minColumn = GetColumnRoundedTiesUp(depth, startNumerator, startDenominator);
+		int maxColumn = GetColumnRoundedTiesDown(depth, endNumerator, endDenominator);
+		bool hasPrevTile = false;
+		bool wasPrevTileSolid = false;
+		for (int column = minColumn; column <= maxColumn; ++column)
+		{
+			IntVec2 tileCoords = GetQuadrantTileCoords(scan, depth, column);
+			bool isOnMap = IsTileCoordsOnMap(scan.m_dimensions, tileCoords);
+			int tileIndex = tileCoords.y * scan.m_dimensions.x + tileCoords.x;
+			bool isSolid = !isOnMap || scan.m_solidValues[tileIndex] == scan.m_tileSolidValue;
+
+			//open tiles need their center inside the visible wedge, solid tiles only need to be touched by it
+			bool isCenterInWedge = column * startDenominator >= depth * startNumerator && column * endDenominator <= depth * endNumerator;
+			bool isInRadius = (float)(column * column + depth * depth) <= scan.m_radiusSquared;
+			if (isOnMap && isInRadius && (isSolid || isCenterInWedge))
+			{
+				SetTileVisible(scan.m_visibleBits, tileIndex);
+			}
+
+			if (hasPrevTile && wasPrevTileSolid && !isSolid)
+			{
+				startNumerator = 2 * column - 1;
+				startDenominator = 2 * depth;
+			}
+			if (hasPrevTile && !wasPrevTileSolid && isSolid)
+			{
+				ScanShadowcastRows(scan, depth + 1, startNumerator, startDenominator, 2 * column - 1, 2 * depth);
+			}
+			hasPrevTile = true;
+			wasPrevTileSolid = isSolid;
+		}
+
+		if (!hasPrevTile || wasPrevTileSolid)
+		{
+			return;
+		}
+	}
+}
+
+static void AddVisibleTilesForViewer(TileHeatMap const& solidMap, float tileSolidValue, TileViewer2D const& viewer, unsigned int* visibleBits)
+{
+	IntVec2 dimensions = solidMap.m_dimensions;
+	if (!IsTileCoordsOnMap(dimensions, viewer.m_tileCoords))
+	{
+		return;
+	}
+	SetTileVisible(visibleBits, viewer.m_tileCoords.y * dimensions.x + viewer.m_tileCoords.x);
+
+	ShadowcastQuadrant scan;
+	scan.m_solidValues = solidMap.m_values;
+	scan.m_dimensions = dimensions;
+	scan.m_tileSolidValue = tileSolidValue;
+	scan.m_origin = viewer.m_tileCoords;
+	scan.m_maxDepth = (viewer.m_radiusInTiles > 0.f) ? (int)floorf(viewer.m_radiusInTiles) : 0;
+	scan.m_radiusSquared = viewer.m_radiusInTiles * viewer.m_radiusInTiles;
+	scan.m_visibleBits = visibleBits;
+	for (int quadrant = 0; quadrant < 4; ++quadrant)
+	{
+		scan.m_quadrant = quadrant;
+		ScanShadowcastRows(scan, 1, -1, 1, 1, 1);
+	}
+}
+
+//-----------------------------------------------------------------------------------------------
+int GetNumTileVisibilityWords(IntVec2 const& mapDimensions)
+{
+	return (mapDimensions.x * mapDimensions.y + 31) / 32;
+}
+
+void ComputeTileFieldOfView2D(TileHeatMap const& solidMap, float tileSolidValue, TileViewer2D const& viewer, std::vector<unsigned int>& out_visibleBits)
+{
+	out_visibleBits.assign(GetNumTileVisibilityWords(solidMap.m_dimensions), 0u);
+	AddVisibleTilesForViewer(solidMap, tileSolidValue, viewer, out_visibleBits.data());
+}
+
+void ComputeTileFieldOfView2D(TileHeatMap const& solidMap, float tileSolidValue, int numViewers, TileViewer2D const* viewers, std::vector<unsigned int>& out_visibleBits, ThreadPool* threadPool)
+{
+	int numWords = GetNumTileVisibilityWords(solidMap.m_dimensions);
+	out_visibleBits.assign(numWords, 0u);
+
+	//squads standing together share tiles, only the widest view from each tile matters
+	IntVec2 dimensions = solidMap.m_dimensions;
+	std::vector<TileViewer2D> uniqueViewers;
+	uniqueViewers.reserve(numViewers);
+	for (int viewerIndex = 0; viewerIndex < numViewers; ++viewerIndex)
+	{
+		if (IsTileCoordsOnMap(dimensions, viewers[viewerIndex].m_tileCoords))
+		{
+			uniqueViewers.push_back(viewers[viewerIndex]);
+		}
+	}
+	std::sort(uniqueViewers.begin(), uniqueViewers.end(), [dimensions](TileViewer2D const& a, TileViewer2D const& b)
+		{
+			int tileIndexA = a.m_tileCoords.y * dimensions.x + a.m_tileCoords.x;
+			int tileIndexB = b.m_tileCoords.y * dimensions.x + b.m_tileCoords.x;
+			return (tileIndexA != tileIndexB) ? tileIndexA < tileIndexB : a.m_radiusInTiles > b.m_radiusInTiles;
+		});
+	uniqueViewers.erase(std::unique(uniqueViewers.begin(), uniqueViewers.end(), [](TileViewer2D const& a, TileViewer2D const& b)
+		{
+			return a.m_tileCoords == b.m_tileCoords;
+		}), uniqueViewers.end());
+
+	int numUniqueViewers = (int)uniqueViewers.size();
+	if (!threadPool || numUniqueViewers < 2)
+	{
+		for (TileViewer2D const& viewer : uniqueViewers)
+		{
+			AddVisibleTilesForViewer(solidMap, tileSolidValue, viewer, out_visibleBits.data());
+		}
+		return;
+	}
+
+	//one bitset per chunk so workers never write the same words; chunk 0 writes straight into the output
+	int numChunks = threadPool->GetNumWorkerThreads() + 1;
+	if (numChunks > numUniqueViewers)
+	{
+		numChunks = numUniqueViewers;
+	}
+	std::vector<std::vector<unsigned int>> chunkVisibleBits(numChunks - 1);
+	threadPool->ParallelFor(numChunks, [&](int beginIndex, int endIndex)
+		{
+			for (int chunkIndex = beginIndex; chunkIndex < endIndex; ++chunkIndex)
+			{
+				unsigned int* visibleBits = out_visibleBits.data();
+				if (chunkIndex > 0)
+				{
+					chunkVisibleBits[chunkIndex - 1].assign(numWords, 0u);
+					visibleBits = chunkVisibleBits[chunkIndex - 1].data();
+				}
+
+				int firstViewer = (numUniqueViewers * chunkIndex) / numChunks;
+				int endViewer = (numUniqueViewers * (chunkIndex + 1)) / numChunks;
+				for (int viewerIndex = firstViewer; viewerIndex < endViewer; ++viewerIndex)
+				{
+					AddVisibleTilesForViewer(solidMap, tileSolidValue, uniqueViewers[viewerIndex], visibleBits);
+				}
+			}
+		});
+
+	for (std::vector<unsigned int> const& visibleBits : chunkVisibleBits)
+	{
+		for (int wordIndex = 0; wordIndex < numWords; ++wordIndex)
+		{
+			out_visibleBits[wordIndex] |= visibleBits[wordIndex];
+		}
+	}
+}
+
+void ComputeTileFieldOfView2D(TileHeatMap const& solidMap, float tileSolidValue, int numViewers, TileViewer2D const* viewers, TileHeatMap& out_visibleMap, float visibleValue, ThreadPool* threadPool)
+{
+	std::vector<unsigned int> visibleBits;
+	ComputeTileFieldOfView2D(solidMap, tileSolidValue, numViewers, viewers, visibleBits, threadPool);
+
+	int numTiles = solidMap.m_dimensions.x * solidMap.m_dimensions.y;
+	for (int wordIndex = 0; wordIndex < (int)visibleBits.size(); ++wordIndex)
+	{
+		unsigned int word = visibleBits[wordIndex];
+		for (int bitIndex = 0; word != 0u && bitIndex < 32; ++bitIndex, word >>= 1)
+		{
+			int tileIndex = wordIndex * 32 + bitIndex;
+			if ((word & 1u) && tileIndex < numTiles)
+			{
+				out_visibleMap.m_values[tileIndex] = visibleValue;
+			}
+		}
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "Engine/Math/IntVec2.hpp"
+#include <vector>
+class TileHeatMap;
+class ThreadPool;
+
+//-----------------------------------------------------------------------------------------------
+// field of view on a tile map with symmetric shadowcasting (Albert Ford's variant of recursive shadowcasting)
+//	each quadrant is scanned row by row, and every run of open tiles recurses into the next row through the gap it leaves
+//	unlike casting rays there are no gaps, and it is symmetric: if an open tile A sees open tile B, then B sees A
+//	solid tiles are tiles whose value == tileSolidValue, they are visible but block sight; tiles off the map block too
+//	radius is in tiles, measured between tile centers
+//	result bits: tile index (y * width + x) is bit (index % 32) of visibleBits[index / 32], the same layout as the batch shape queries
+//
+struct TileViewer2D
+{
+	IntVec2	m_tileCoords;
+	float	m_radiusInTiles = 0.f;
+};
+
+int		GetNumTileVisibilityWords(IntVec2 const& mapDimensions);
+inline bool IsTileVisible(unsigned int const* visibleBits, int tileIndex) { return (visibleBits[tileIndex >> 5] >> (tileIndex & 31)) & 1u; }
+
+//out_visibleBits is resized and cleared; viewers off the map see nothing
+void	ComputeTileFieldOfView2D(TileHeatMap const& solidMap, float tileSolidValue, TileViewer2D const& viewer, std::vector<unsigned int>& out_visibleBits);
+
+//fog of war: union of everything the viewers see; viewers sharing a tile are only scanned once (with the largest radius)
+//	with a thread pool each worker fills its own bitset and they are OR'd together at the end
+void	ComputeTileFieldOfView2D(TileHeatMap const& solidMap, float tileSolidValue, int numViewers, TileViewer2D const* viewers, std::vector<unsigned int>& out_visibleBits, ThreadPool* threadPool = nullptr);
+
+//writes visibleValue into the visible tiles of out_visibleMap (same dimensions as solidMap) and leaves the rest untouched,
+//	so calling it every frame without clearing builds up an explored map
+void	ComputeTileFieldOfView2D(TileHeatMap const& solidMap, float tileSolidValue, int numViewers, TileViewer2D const* viewers, TileHeatMap& out_visibleMap, float visibleValue = 1.f, ThreadPool* threadPool = nullptr);
@@ -0,0 +1,391 @@
+#include "Engine/Math/TransformHierarchy.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/ThreadPool.hpp"
+
+//-----------------------------------------------------------------------------------------------
+TransformHierarchy::TransformHierarchy(TransformHierarchyConfig const& config)
+	:m_config(config)
+{
+	m_parentIds.reserve(m_config.m_initialCapacity);
+	m_idToIndex.reserve(m_config.m_initialCapacity);
+	m_indexToId.reserve(m_config.m_initialCapacity);
+	m_parentIndexes.reserve(m_config.m_initialCapacity);
+	m_rootGroupOfIndex.reserve(m_config.m_initialCapacity);
+	m_localPositions.reserve(m_config.m_initialCapacity);
+	m_localOrientations.reserve(m_config.m_initialCapacity);
+	m_localScales.reserve(m_config.m_initialCapacity);
+	m_worldTransforms.reserve(m_config.m_initialCapacity);
+	m_isDirty.reserve(m_config.m_initialCapacity);
+}
+
+int TransformHierarchy::CreateNode(int parentId, Vec3 const& localPosition, Quat const& localOrientation, Vec3 const& localScale)
+{
+	GUARANTEE_OR_DIE(parentId == -1 || IsValidNode(parentId), "TransformHierarchy::CreateNode called with an invalid parent id");
+
+	int nodeId = (int)m_parentIds.size();
+	if (!m_freeIds.empty())
+	{
+		nodeId = m_freeIds.back();
+		m_freeIds.pop_back();
+	}
+	else
+	{
+		m_parentIds.push_back(-1);
+		m_idToIndex.push_back(-1);
+	}
+
+	//appended for now, RebuildOrder moves it next to its root group on the next update
+	m_parentIds[nodeId] = parentId;
+	m_idToIndex[nodeId] = (int)m_indexToId.size();
+	m_indexToId.push_back(nodeId);
+	m_parentIndexes.push_back(-1);
+	m_rootGroupOfIndex.push_back(0);
+	m_localPositions.push_back(localPosition);
+	m_localOrientations.push_back(localOrientation);
+	m_localScales.push_back(localScale);
+	m_worldTransforms.push_back(Mat44());
+	m_isDirty.push_back(1);
+
+	++m_numNodes;
+	m_isOrderDirty = true;
+	return nodeId;
+}
+
+void TransformHierarchy::DestroyNode(int nodeId)
+{
+	GUARANTEE_OR_DIE(IsValidNode(nodeId), "TransformHierarchy::DestroyNode called with an invalid node id");
+
+	//a node is in the subtree if walking up its parents reaches nodeId; remember each answer so every chain is walked once
+	enum SubtreeState : unsigned char { UNKNOWN, INSIDE, OUTSIDE };
+	std::vector<SubtreeState> states(m_parentIds.size(), UNKNOWN);
+	states[nodeId] = INSIDE;
+	std::vector<int> chain;
+	for (int id = 0; id < (int)m_parentIds.size(); ++id)
+	{
+		if (m_idToIndex[id] < 0)
+		{
+			continue;
+		}
+
+		chain.clear();
+		int walkId = id;
+		while (walkId != -1 && states[walkId] == UNKNOWN)
+		{
+			chain.push_back(walkId);
+			walkId = m_parentIds[walkId];
+		}
+		SubtreeState state = (walkId == -1) ? OUTSIDE : states[walkId];
+		for (int chainId : chain)
+		{
+			states[chainId] = state;
+		}
+	}
+
+	for (int id = 0; id < (int)m_parentIds.size(); ++id)
+	{
+		if (states[id] == INSIDE && m_idToIndex[id] >= 0)
+		{
+			m_indexToId[m_idToIndex[id]] = -1;
+			m_idToIndex[id] = -1;
+			m_parentIds[id] = -1;
+			m_freeIds.push_back(id);
+			--m_numNodes;
+		}
+	}
+	m_isOrderDirty = true;
+}
+
+void TransformHierarchy::SetParent(int nodeId, int newParentId)
+{
+	GUARANTEE_OR_DIE(IsValidNode(nodeId), "TransformHierarchy::SetParent called with an invalid node id");
+	GUARANTEE_OR_DIE(newParentId == -1 || IsValidNode(newParentId), "TransformHierarchy::SetParent called with an invalid parent id");
+	for (int ancestorId = newParentId; ancestorId != -1; ancestorId = m_parentIds[ancestorId])
+	{
+		GUARANTEE_OR_DIE(ancestorId != nodeId, "TransformHierarchy::SetParent would make a node its own ancestor");
+	}
+
+	if (m_parentIds[nodeId] != newParentId)
+	{
+		m_parentIds[nodeId] = newParentId;
+		m_isDirty[m_idToIndex[nodeId]] = 1;
+		m_isOrderDirty = true;
+	}
+}
+
+void TransformHierarchy::Clear()
+{
+	m_parentIds.clear();
+	m_idToIndex.clear();
+	m_freeIds.clear();
+	m_numNodes = 0;
+	m_indexToId.clear();
+	m_parentIndexes.clear();
+	m_rootGroupOfIndex.clear();
+	m_localPositions.clear();
+	m_localOrientations.clear();
+	m_localScales.clear();
+	m_worldTransforms.clear();
+	m_isDirty.clear();
+	m_rootGroupStarts.clear();
+	m_isRootGroupDirty.clear();
+	m_isOrderDirty = false;
+}
+
+//-----------------------------------------------------------------------------------------------
+void TransformHierarchy::SetLocalPosition(int nodeId, Vec3 const& localPosition)
+{
+	m_localPositions[GetIndex(nodeId)] = localPosition;
+	MarkDirty(nodeId);
+}
+
+void TransformHierarchy::SetLocalOrientation(int nodeId, Quat const& localOrientation)
+{
+	m_localOrientations[GetIndex(nodeId)] = localOrientation;
+	MarkDirty(nodeId);
+}
+
+void TransformHierarchy::SetLocalScale(int nodeId, Vec3 const& localScale)
+{
+	m_localScales[GetIndex(nodeId)] = localScale;
+	MarkDirty(nodeId);
+}
+
+void TransformHierarchy::SetLocalTransform(int nodeId, Vec3 const& localPosition, Quat const& localOrientation, Vec3 const& localScale)
+{
+	int index = GetIndex(nodeId);
+	m_localPositions[index] = localPosition;
+	m_localOrientations[index] = localOrientation;
+	m_localScales[index] = localScale;
+	MarkDirty(nodeId);
+}
+
+int TransformHierarchy::GetParent(int nodeId) const
+{
+	GUARANTEE_OR_DIE(IsValidNode(nodeId), "TransformHierarchy::GetParent called with an invalid node id");
+	return m_parentIds[nodeId];
+}
+
+Vec3 const& TransformHierarchy::GetLocalPosition(int nodeId) const
+{
+	return m_localPositions[GetIndex(nodeId)];
+}
+
+Quat const& TransformHierarchy::GetLocalOrientation(int nodeId) const
+{
+	return m_localOrientations[GetIndex(nodeId)];
+}
+
+Vec3 const& TransformHierarchy::GetLocalScale(int nodeId) const
+{
+	return m_localScales[GetIndex(nodeId)];
+}
+
+Mat44 const& TransformHierarchy::GetWorldTransform(int nodeId) const
+{
+	return m_worldTransforms[GetIndex(nodeId)];
+}
+
+bool TransformHierarchy::IsValidNode(int nodeId) const
+{
+	return nodeId >= 0 && nodeId < (int)m_idToIndex.size() && m_idToIndex[nodeId] >= 0;
+}
+
+//-----------------------------------------------------------------------------------------------
+void TransformHierarchy::UpdateWorldTransforms(ThreadPool* threadPool)
+{
+	if (m_isOrderDirty)
+	{
+		RebuildOrder();
+	}
+
+	int numRootGroups = (int)m_rootGroupStarts.size() - 1;
+	if (threadPool && numRootGroups > 1)
+	{
+		threadPool->ParallelFor(numRootGroups, [this](int beginIndex, int endIndex)
+			{
+				for (int rootGroupIndex = beginIndex; rootGroupIndex < endIndex; ++rootGroupIndex)
+				{
+					UpdateRootGroup(rootGroupIndex);
+				}
+			}, m_config.m_minRootsPerParallelBatch);
+	}
+	else
+	{
+		for (int rootGroupIndex = 0; rootGroupIndex < numRootGroups; ++rootGroupIndex)
+		{
+			UpdateRootGroup(rootGroupIndex);
+		}
+	}
+}
+
+//parents come before children, so a dirty flag is pushed down to the whole subtree in the same forward pass
+//	each world matrix is built straight from the local rotation, scale and translation columns:
+//	column c of parentWorld * local is parentWorld's columns weighted by local column c, four floats per SIMD op
+void TransformHierarchy::UpdateRootGroup(int rootGroupIndex)
+{
+	if (!m_isRootGroupDirty[rootGroupIndex])
+	{
+		return;
+	}
+
+	int startIndex = m_rootGroupStarts[rootGroupIndex];
+	int endIndex = m_rootGroupStarts[rootGroupIndex + 1];
+	for (int index = startIndex; index < endIndex; ++index)
+	{
+		int parentIndex = m_parentIndexes[index];
+		if (parentIndex >= 0 && m_isDirty[parentIndex])
+		{
+			m_isDirty[index] = 1;
+		}
+		if (!m_isDirty[index])
+		{
+			continue;
+		}
+
+		Vec3 iBasis;
+		Vec3 jBasis;
+		Vec3 kBasis;
+		m_localOrientations[index].GetAsVectors_IFwd_JLeft_KUp(iBasis, jBasis, kBasis);
+		Vec3 const& scale = m_localScales[index];
+		iBasis *= scale.x;
+		jBasis *= scale.y;
+		kBasis *= scale.z;
+		Vec3 const& translation = m_localPositions[index];
+
+		float* world = m_worldTransforms[index].m_values;
+		if (parentIndex < 0)
+		{
+			m_worldTransforms[index] = Mat44(iBasis, jBasis, kBasis, translation);
+			continue;
+		}
+
+		float const* parentWorld = m_worldTransforms[parentIndex].m_values;
+		SIMDFloat4 parentI = SIMDLoad(&parentWorld[Mat44::Ix]);
+		SIMDFloat4 parentJ = SIMDLoad(&parentWorld[Mat44::Jx]);
+		SIMDFloat4 parentK = SIMDLoad(&parentWorld[Mat44::Kx]);
+		SIMDFloat4 parentT = SIMDLoad(&parentWorld[Mat44::Tx]);
+		SIMDStore(&world[Mat44::Ix], SIMDTransformColumns(parentI, parentJ, parentK, parentT, iBasis.x, iBasis.y, iBasis.z, 0.f));
+		SIMDStore(&world[Mat44::Jx], SIMDTransformColumns(parentI, parentJ, parentK, parentT, jBasis.x, jBasis.y, jBasis.z, 0.f));
+		SIMDStore(&world[Mat44::Kx], SIMDTransformColumns(parentI, parentJ, parentK, parentT, kBasis.x, kBasis.y, kBasis.z, 0.f));
+		SIMDStore(&world[Mat44::Tx], SIMDTransformColumns(parentI, parentJ, parentK, parentT, translation.x, translation.y, translation.z, 1.f));
+	}
+
+	for (int index = startIndex; index < endIndex; ++index)
+	{
+		m_isDirty[index] = 0;
+	}
+	m_isRootGroupDirty[rootGroupIndex] = 0;
+}
+
+//-----------------------------------------------------------------------------------------------
+void TransformHierarchy::MarkDirty(int nodeId)
+{
+	int index = m_idToIndex[nodeId];
+	m_isDirty[index] = 1;
+	if (!m_isOrderDirty)
+	{
+		m_isRootGroupDirty[m_rootGroupOfIndex[index]] = 1;
+	}
+}
+
+//roots in id order, then each root's subtree breadth first, so depth only grows inside a group
+void TransformHierarchy::RebuildOrder()
+{
+	int numIds = (int)m_parentIds.size();
+	std::vector<int> firstChildSlot(numIds + 1, 0);
+	for (int id = 0; id < numIds; ++id)
+	{
+		if (m_idToIndex[id] >= 0 && m_parentIds[id] >= 0)
+		{
+			++firstChildSlot[m_parentIds[id] + 1];
+		}
+	}
+	for (int id = 0; id < numIds; ++id)
+	{
+		firstChildSlot[id + 1] += firstChildSlot[id];
+	}
+	std::vector<int> children(firstChildSlot[numIds]);
+	std::vector<int> nextChildSlot(firstChildSlot.begin(), firstChildSlot.end() - 1);
+	for (int id = 0; id < numIds; ++id)
+	{
+		if (m_idToIndex[id] >= 0 && m_parentIds[id] >= 0)
+		{
+			children[nextChildSlot[m_parentIds[id]]++] = id;
+		}
+	}
+
+	std::vector<int> newIndexToId;
+	newIndexToId.reserve(m_numNodes);
+	m_rootGroupStarts.clear();
+	for (int rootId = 0; rootId < numIds; ++rootId)
+	{
+		if (m_idToIndex[rootId] < 0 || m_parentIds[rootId] != -1)
+		{
+			continue;
+		}
+
+		m_rootGroupStarts.push_back((int)newIndexToId.size());
+		newIndexToId.push_back(rootId);
+		for (int queueIndex = m_rootGroupStarts.back(); queueIndex < (int)newIndexToId.size(); ++queueIndex)
+		{
+			int parentId = newIndexToId[queueIndex];
+			for (int slot = firstChildSlot[parentId]; slot < firstChildSlot[parentId + 1]; ++slot)
+			{
+				newIndexToId.push_back(children[slot]);
+			}
+		}
+	}
+	m_rootGroupStarts.push_back((int)newIndexToId.size());
+
+	int numNodes = (int)newIndexToId.size();
+	std::vector<Vec3> newLocalPositions(numNodes);
+	std::vector<Quat> newLocalOrientations(numNodes);
+	std::vector<Vec3> newLocalScales(numNodes);
+	std::vector<Mat44> newWorldTransforms(numNodes);
+	std::vector<unsigned char> newIsDirty(numNodes);
+	for (int newIndex = 0; newIndex < numNodes; ++newIndex)
+	{
+		int oldIndex = m_idToIndex[newIndexToId[newIndex]];
+		newLocalPositions[newIndex] = m_localPositions[oldIndex];
+		newLocalOrientations[newIndex] = m_localOrientations[oldIndex];
+		newLocalScales[newIndex] = m_localScales[oldIndex];
+		newWorldTransforms[newIndex] = m_worldTransforms[oldIndex];
+		newIsDirty[newIndex] = m_isDirty[oldIndex];
+	}
+	m_localPositions.swap(newLocalPositions);
+	m_localOrientations.swap(newLocalOrientations);
+	m_localScales.swap(newLocalScales);
+	m_worldTransforms.swap(newWorldTransforms);
+	m_isDirty.swap(newIsDirty);
+	m_indexToId.swap(newIndexToId);
+
+	for (int index = 0; index < numNodes; ++index)
+	{
+		m_idToIndex[m_indexToId[index]] = index;
+	}
+
+	//new and reparented nodes are already dirty and the update pushes that down to their subtrees,
+	//	so only groups holding one of them are recomputed
+	int numRootGroups = (int)m_rootGroupStarts.size() - 1;
+	m_parentIndexes.resize(numNodes);
+	m_rootGroupOfIndex.resize(numNodes);
+	m_isRootGroupDirty.assign(numRootGroups, 0);
+	for (int rootGroupIndex = 0; rootGroupIndex < numRootGroups; ++rootGroupIndex)
+	{
+		for (int index = m_rootGroupStarts[rootGroupIndex]; index < m_rootGroupStarts[rootGroupIndex + 1]; ++index)
+		{
+			int parentId = m_parentIds[m_indexToId[index]];
+			m_parentIndexes[index] = (parentId >= 0) ? m_idToIndex[parentId] : -1;
+			m_rootGroupOfIndex[index] = rootGroupIndex;
+			m_isRootGroupDirty[rootGroupIndex] |= m_isDirty[index];
+		}
+	}
+	m_isOrderDirty = false;
+}
+
+int TransformHierarchy::GetIndex(int nodeId) const
+{
+	GUARANTEE_OR_DIE(IsValidNode(nodeId), "TransformHierarchy called with an invalid node id");
+	return m_idToIndex[nodeId];
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Quat.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include <vector>
+class ThreadPool;
+
+//-----------------------------------------------------------------------------------------------
+// parent / child transforms kept in one flat array, grouped by root and sorted by depth inside each group,
+//	so every parent is updated before its children in a single forward pass
+//	changing a local transform only marks that node dirty; UpdateWorldTransforms recomputes the dirty nodes and
+//	their descendants and skips root groups with nothing dirty
+//	creating or reparenting a node dirties only that node's subtree, and destroying a subtree dirties nothing else
+//	world = parentWorld * (translate * rotate * scale), the same order as building the Mat44 by hand with Append
+//	world transforms read between a change and the next UpdateWorldTransforms are last update's values
+//
+struct TransformHierarchyConfig
+{
+	int m_initialCapacity = 64;
+	int m_minRootsPerParallelBatch = 8;
+};
+
+class TransformHierarchy
+{
+public:
+	explicit TransformHierarchy(TransformHierarchyConfig const& config = TransformHierarchyConfig());
+
+	//ids stay valid until the node is destroyed, parentId -1 makes a root
+	int		CreateNode(int parentId = -1, Vec3 const& localPosition = Vec3(), Quat const& localOrientation = Quat(), Vec3 const& localScale = Vec3(1.f, 1.f, 1.f));
+	void	DestroyNode(int nodeId); //destroys the whole subtree
+	void	SetParent(int nodeId, int newParentId); //keeps the local transform, so the node moves with its new parent
+	void	Clear();
+
+	void	SetLocalPosition(int nodeId, Vec3 const& localPosition);
+	void	SetLocalOrientation(int nodeId, Quat const& localOrientation);
+	void	SetLocalScale(int nodeId, Vec3 const& localScale);
+	void	SetLocalTransform(int nodeId, Vec3 const& localPosition, Quat const& localOrientation, Vec3 const& localScale);
+
+	int				GetParent(int nodeId) const;
+	Vec3 const&		GetLocalPosition(int nodeId) const;
+	Quat const&		GetLocalOrientation(int nodeId) const;
+	Vec3 const&		GetLocalScale(int nodeId) const;
+	Mat44 const&	GetWorldTransform(int nodeId) const;
+	int				GetNumNodes() const { return m_numNodes; }
+	bool			IsValidNode(int nodeId) const;
+
+	//independent root groups are updated in parallel when a thread pool is given; results do not depend on the number of threads
+	void	UpdateWorldTransforms(ThreadPool* threadPool = nullptr);
+
+private:
+	void	MarkDirty(int nodeId);
+	void	RebuildOrder();
+	void	UpdateRootGroup(int rootGroupIndex);
+	int		GetIndex(int nodeId) const;
+
+private:
+	TransformHierarchyConfig	m_config;
+
+	//by id
+	std::vector<int>			m_parentIds;
+	std::vector<int>			m_idToIndex;		//-1 for free ids
+	std::vector<int>			m_freeIds;
+	int							m_numNodes = 0;
+
+	//by index, in update order once the order is rebuilt; new nodes are appended until then
+	std::vector<int>			m_indexToId;
+	std::vector<int>			m_parentIndexes;
+	std::vector<int>			m_rootGroupOfIndex;
+	std::vector<Vec3>			m_localPositions;
+	std::vector<Quat>			m_localOrientations;
+	std::vector<Vec3>			m_localScales;
+	std::vector<Mat44>			m_worldTransforms;
+	std::vector<unsigned char>	m_isDirty;
+
+	//root group g owns indexes [m_rootGroupStarts[g], m_rootGroupStarts[g + 1])
+	std::vector<int>			m_rootGroupStarts;
+	std::vector<unsigned char>	m_isRootGroupDirty;
+	bool						m_isOrderDirty = false;
+};
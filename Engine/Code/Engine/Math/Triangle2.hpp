@@ -7,7 +7,6 @@ public:
 
 public:
 	Triangle2() {}
-	~Triangle2() {}
 	explicit Triangle2(Vec2 const& pointACounterClockwise, Vec2 const& pointBCounterClockwise, Vec2 const& pointCCounterClockwise);
 
 	//Accessors
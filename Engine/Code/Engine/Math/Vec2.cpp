@@ -2,7 +2,10 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/FastTrig.hpp"
+#include "Game/EngineBuildPreferences.hpp"
 #include "math.h"
+#include <type_traits>
 //#include "Engine/Core/EngineCommon.hpp"
 
 Vec2 const Vec2::ZERO = Vec2();
@@ -14,12 +17,7 @@ Vec2 const Vec2::EAST = Vec2(1.f, 0.f);
 Vec2 const Vec2::SOUTH = Vec2(0.f, -1.f);
 Vec2 const Vec2::WEST = Vec2(-1.f, 0.f);
 
-//-----------------------------------------------------------------------------------------------
-Vec2::Vec2( const Vec2& copy )
-	: x( copy.x )
-	, y( copy.y )
-{
-}
+static_assert(std::is_trivially_copyable<Vec2>::value, "Vec2 must stay trivially copyable");
 
 Vec2::Vec2(IntVec2 const& copyFromIntVec2)
 	:x((float)copyFromIntVec2.x)
@@ -27,27 +25,26 @@ Vec2::Vec2(IntVec2 const& copyFromIntVec2)
 {
 }
 
-//-----------------------------------------------------------------------------------------------
-Vec2::Vec2( float initialX, float initialY )
-	: x( initialX )
-	, y( initialY)
-{
-}
-
 //Static Methods
 //-----------------------------------------------------------------------------------------------
 Vec2 const Vec2::MakeFromPolarRadians(float orientationRadians, float length)
 {
-	float newX = length * cosf(orientationRadians);
-	float newY = length * sinf(orientationRadians);
+	float sinRadians;
+	float cosRadians;
+	SinCosRadians(orientationRadians, sinRadians, cosRadians);
+	float newX = length * cosRadians;
+	float newY = length * sinRadians;
 
 	return Vec2(newX, newY);
 }
 
 Vec2 const Vec2::MakeFromPolarDegrees(float orientationDegrees, float length)
 {
-	float newX = length * CosDegrees(orientationDegrees);
-	float newY = length * SinDegrees(orientationDegrees);
+	float sinDegrees;
+	float cosDegrees;
+	SinCosDegrees(orientationDegrees, sinDegrees, cosDegrees);
+	float newX = length * cosDegrees;
+	float newY = length * sinDegrees;
 
 	return Vec2(newX, newY);
 }
@@ -59,7 +56,11 @@ float const Vec2::GetOrientationRadians(float inputX, float inputY)
 
 float const Vec2::GetOrientationDegrees(float inputX, float inputY)
 {
+#if defined(ENGINE_FAST_TRIG)
+	return FastAtan2Degrees(inputY, inputX);
+#else
 	return Atan2Degrees(inputY, inputX);
+#endif
 }
 
 
@@ -83,7 +84,7 @@ float const Vec2::GetOrientationRadians() const
 
 float const Vec2::GetOrientationDegrees() const
 {
-	return Atan2Degrees(y,x);
+	return GetOrientationDegrees(x, y);
 }
 
 Vec2 const Vec2::GetRotated90Degrees() const
@@ -162,28 +163,40 @@ void Vec2::SetFromText(char const* text)
 void Vec2::SetOrientationRadians(float newOrientationRadians)
 {
 	float length = GetLength();
-	x = length * cosf(newOrientationRadians);
-	y = length * sinf(newOrientationRadians);
+	float sinRadians;
+	float cosRadians;
+	SinCosRadians(newOrientationRadians, sinRadians, cosRadians);
+	x = length * cosRadians;
+	y = length * sinRadians;
 }
 
 void Vec2::SetOrientationDegrees(float newOrientationDegrees)
 {
 	float length = GetLength();
-	x = length * CosDegrees(newOrientationDegrees);
-	y = length * SinDegrees(newOrientationDegrees);
+	float sinDegrees;
+	float cosDegrees;
+	SinCosDegrees(newOrientationDegrees, sinDegrees, cosDegrees);
+	x = length * cosDegrees;
+	y = length * sinDegrees;
 
 }
 
 void Vec2::SetPolarRadians(float newOrientationRadians, float newLength)
 {
-	x = newLength * cosf(newOrientationRadians);
-	y = newLength * sinf(newOrientationRadians);
+	float sinRadians;
+	float cosRadians;
+	SinCosRadians(newOrientationRadians, sinRadians, cosRadians);
+	x = newLength * cosRadians;
+	y = newLength * sinRadians;
 }
 
 void Vec2::SetPolarDegrees(float newOrientationDegrees, float newLength)
 {
-	x = newLength * CosDegrees(newOrientationDegrees);
-	y = newLength * SinDegrees(newOrientationDegrees);
+	float sinDegrees;
+	float cosDegrees;
+	SinCosDegrees(newOrientationDegrees, sinDegrees, cosDegrees);
+	x = newLength * cosDegrees;
+	y = newLength * sinDegrees;
 }
 
 void Vec2::Rotate90Degrees()
@@ -202,7 +215,8 @@ void Vec2::RotateMinus90Degrees()
 
 void Vec2::RotateRadians(float deltaRadians)
 {
-	Vec2 iBasis(cosf(deltaRadians), sinf(deltaRadians));
+	Vec2 iBasis;
+	SinCosRadians(deltaRadians, iBasis.y, iBasis.x);
 	Vec2 jBasis(-iBasis.y, iBasis.x);
 	Vec2 rotatedVec((x * iBasis) + (y * jBasis));
 	x = rotatedVec.x;
@@ -211,7 +225,8 @@ void Vec2::RotateRadians(float deltaRadians)
 
 void Vec2::RotateDegrees(float deltaDegrees)
 {
-	Vec2 iBasis(CosDegrees(deltaDegrees), SinDegrees(deltaDegrees));
+	Vec2 iBasis;
+	SinCosDegrees(deltaDegrees, iBasis.y, iBasis.x);
 	Vec2 jBasis(-iBasis.y, iBasis.x);
 	Vec2 rotatedVec((x * iBasis) + (y * jBasis));
 	x = rotatedVec.x;
@@ -284,112 +299,3 @@ void Vec2::Reflect(Vec2 const& normalOfSurfaceToReflectOffOf)
 	x = reflectedVector.x;
 	y = reflectedVector.y;
 }
-
-
-
-//Operators
-//-----------------------------------------------------------------------------------------------
-const Vec2 Vec2::operator + ( const Vec2& vecToAdd ) const
-{
-	return Vec2(x + vecToAdd.x, y + vecToAdd.y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-const Vec2 Vec2::operator-( const Vec2& vecToSubtract ) const
-{
-	return Vec2(x - vecToSubtract.x, y - vecToSubtract.y);
-}
-
-
-//------------------------------------------------------------------------------------------------
-const Vec2 Vec2::operator-() const
-{
-	return Vec2(-x, -y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-const Vec2 Vec2::operator*( float uniformScale ) const
-{
-	return Vec2(x * uniformScale, y * uniformScale);
-}
-
-
-//------------------------------------------------------------------------------------------------
-const Vec2 Vec2::operator*( const Vec2& vecToMultiply ) const
-{
-	return Vec2( x * vecToMultiply.x, y * vecToMultiply.y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-const Vec2 Vec2::operator/( float inverseScale ) const
-{
-	return Vec2( x / inverseScale, y / inverseScale );
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void Vec2::operator+=( const Vec2& vecToAdd )
-{
-	x += vecToAdd.x;
-	y += vecToAdd.y;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void Vec2::operator-=( const Vec2& vecToSubtract )
-{
-	x -= vecToSubtract.x;
-	y -= vecToSubtract.y;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void Vec2::operator*=( const float uniformScale )
-{
-	x *= uniformScale;
-	y *= uniformScale;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void Vec2::operator/=( const float uniformDivisor )
-{
-	x /= uniformDivisor;
-	y /= uniformDivisor;
-}
-
-
-//-----------------------------------------------------------------------------------------------
-void Vec2::operator=( const Vec2& copyFrom )
-{
-	x = copyFrom.x;
-	y = copyFrom.y;
-}
-
-
-
-//-----------------------------------------------------------------------------------------------
-const Vec2 operator*( float uniformScale, const Vec2& vecToScale )
-{
-	return Vec2(vecToScale.x * uniformScale, vecToScale.y * uniformScale);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-bool Vec2::operator==( const Vec2& compare ) const
-{
-	return (x == compare.x && y == compare.y);
-}
-
-
-//-----------------------------------------------------------------------------------------------
-bool Vec2::operator!=( const Vec2& compare ) const
-{
-	return (x != compare.x || y != compare.y);
-}
-
-
-
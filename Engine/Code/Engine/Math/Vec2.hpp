@@ -19,11 +19,10 @@ public: // NOTE: this is one of the few cases where we break both the "m_" namin
 
 public:
 	// Construction/Destruction
-	~Vec2() {}												// destructor (do nothing)
-	Vec2() {}												// default constructor (do nothing)
-	Vec2( const Vec2& copyFrom );							// copy constructor (from another vec2)
+	// copy, assignment and destruction are left to the compiler so Vec2 stays trivially copyable
+	Vec2() = default;										// default constructor (zero)
 	explicit Vec2(IntVec2 const& copyFromIntVec2);
-	explicit Vec2( float initialX, float initialY );		// explicit constructor (from x, y)
+	constexpr explicit Vec2( float initialX, float initialY ) : x( initialX ), y( initialY ) {}	// explicit constructor (from x, y)
 	
 	//Static methods (e.g creation functions)
 	//-----------------------------------------------------------------------------------------------
@@ -80,28 +79,30 @@ public:
 	// Operators (const)
 	//-----------------------------------------------------------------------------------------------
 
-	bool		operator==( const Vec2& compare ) const;		// vec2 == vec2
-	bool		operator!=( const Vec2& compare ) const;		// vec2 != vec2
-	const Vec2	operator+( const Vec2& vecToAdd ) const;		// vec2 + vec2
-	const Vec2	operator-( const Vec2& vecToSubtract ) const;	// vec2 - vec2
-	const Vec2	operator-() const;								// -vec2, i.e. "unary negation"
-	const Vec2	operator*( float uniformScale ) const;			// vec2 * float
-	const Vec2	operator*( const Vec2& vecToMultiply ) const;	// vec2 * vec2
-	const Vec2	operator/( float inverseScale ) const;			// vec2 / float
+	constexpr bool			operator==( const Vec2& compare ) const			{ return x == compare.x && y == compare.y; }
+	constexpr bool			operator!=( const Vec2& compare ) const			{ return x != compare.x || y != compare.y; }
+	constexpr const Vec2	operator+( const Vec2& vecToAdd ) const			{ return Vec2( x + vecToAdd.x, y + vecToAdd.y ); }
+	constexpr const Vec2	operator-( const Vec2& vecToSubtract ) const	{ return Vec2( x - vecToSubtract.x, y - vecToSubtract.y ); }
+	constexpr const Vec2	operator-() const								{ return Vec2( -x, -y ); }
+	constexpr const Vec2	operator*( float uniformScale ) const			{ return Vec2( x * uniformScale, y * uniformScale ); }
+	constexpr const Vec2	operator*( const Vec2& vecToMultiply ) const	{ return Vec2( x * vecToMultiply.x, y * vecToMultiply.y ); }
+	constexpr const Vec2	operator/( float inverseScale ) const			{ return Vec2( x / inverseScale, y / inverseScale ); }
 
 	// Operators (self-mutating / non-const)
 	//-----------------------------------------------------------------------------------------------
 
-	void		operator+=( const Vec2& vecToAdd );				// vec2 += vec2
-	void		operator-=( const Vec2& vecToSubtract );		// vec2 -= vec2
-	void		operator*=( const float uniformScale );			// vec2 *= float
-	void		operator/=( const float uniformDivisor );		// vec2 /= float
-	void		operator=( const Vec2& copyFrom );				// vec2 = vec2
+	constexpr void	operator+=( const Vec2& vecToAdd )				{ x += vecToAdd.x; y += vecToAdd.y; }
+	constexpr void	operator-=( const Vec2& vecToSubtract )			{ x -= vecToSubtract.x; y -= vecToSubtract.y; }
+	constexpr void	operator*=( const float uniformScale )			{ x *= uniformScale; y *= uniformScale; }
+	constexpr void	operator/=( const float uniformDivisor )		{ x /= uniformDivisor; y /= uniformDivisor; }
 
 	// Standalone "friend" functions that are conceptually, but not actually, part of Vec2::
 	//-----------------------------------------------------------------------------------------------
 
-	friend const Vec2 operator*( float uniformScale, const Vec2& vecToScale );	// float * vec2
+	friend constexpr const Vec2 operator*( float uniformScale, const Vec2& vecToScale )	// float * vec2
+	{
+		return Vec2( vecToScale.x * uniformScale, vecToScale.y * uniformScale );
+	}
 
 	
 
@@ -1,9 +1,11 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Math/EulerAngles.hpp"
 #include "math.h"
+#include <type_traits>
 
 Vec3 const Vec3::ZERO = Vec3(0.f, 0.f, 0.f);
 Vec3 const Vec3::ONE = Vec3(1.f, 1.f, 1.f);
@@ -18,20 +20,7 @@ Vec3 const Vec3::FORWARD = Vec3(1.f, 0.f, 0.f);
 Vec3 const Vec3::RIGHT = Vec3(0.f, -1.f, 0.f);
 Vec3 const Vec3::BACKWARD = Vec3(-1.f, 0.f, 0.f);
 
-Vec3::Vec3(const Vec3& copy)
-	: x( copy.x )
-	, y( copy.y )
-	, z (copy.z )
-{
-}
-
-//-----------------------------------------------------------------------------------------------
-Vec3::Vec3( float initialX, float initialY, float initialZ )
-	: x(initialX)
-	, y(initialY)
-	, z(initialZ)
-{
-}
+static_assert(std::is_trivially_copyable<Vec3>::value, "Vec3 must stay trivially copyable");
 
 Vec3::Vec3(Vec2 const& initialXY, float initialZ)
 	:x(initialXY.x)
@@ -197,107 +186,14 @@ void Vec3::ClampLength(float minLength, float maxLength)
 
 void Vec3::Normalize()
 {
-	float length = GetLength();
+	SIMDFloat4 vec = SIMDSet(x, y, z, 0.f);
+	float length = SIMDGetLength4(vec);
 	if (length == 0.f || length == 1.f) return;
 	float scale = 1.f / length;
 
-	x *= scale;
-	y *= scale;
-	z *= scale;
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec3 Vec3::operator+(const Vec3& vecToAdd) const
-{
-	return Vec3(x + vecToAdd.x, y + vecToAdd.y, z + vecToAdd.z);
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec3 Vec3::operator-(const Vec3& vecToSubtract) const
-{
-	return Vec3(x - vecToSubtract.x, y - vecToSubtract.y, z - vecToSubtract.z);
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec3 Vec3::operator-() const
-{
-	return Vec3(-x, -y, -z);
+	float values[4];
+	SIMDStore(values, SIMDMul(vec, SIMDSplat(scale)));
+	x = values[0];
+	y = values[1];
+	z = values[2];
 }
-
-//-----------------------------------------------------------------------------------------------
-const Vec3 Vec3::operator*(float uniformScale) const
-{
-	return Vec3(x * uniformScale, y * uniformScale, z * uniformScale);
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec3 Vec3::operator*(const Vec3& vecToMultiply) const
-{
-	return Vec3(x * vecToMultiply.x, y * vecToMultiply.y, z * vecToMultiply.z);
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec3 Vec3::operator/(float inverseScale) const
-{
-	return Vec3(x / inverseScale, y / inverseScale, z / inverseScale);
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec3::operator+=(const Vec3& vecToAdd)
-{
-	x += vecToAdd.x;
-	y += vecToAdd.y;
-	z += vecToAdd.z;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec3::operator-=(const Vec3& vecToSubtract)
-{
-	x -= vecToSubtract.x;
-	y -= vecToSubtract.y;
-	z -= vecToSubtract.z;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec3::operator*=(const float uniformScale)
-{
-	x *= uniformScale;
-	y *= uniformScale;
-	z *= uniformScale;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec3::operator/=(const float uniformDivisor)
-{
-	x /= uniformDivisor;
-	y /= uniformDivisor;
-	z /= uniformDivisor;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec3::operator=(const Vec3& copyFrom)
-{
-	x = copyFrom.x;
-	y = copyFrom.y;
-	z = copyFrom.z;
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec3 operator*(float uniformScale, const Vec3& vecToScale)
-{
-	return Vec3(vecToScale.x * uniformScale, vecToScale.y * uniformScale, vecToScale.z * uniformScale);
-}
-
-//-----------------------------------------------------------------------------------------------
-bool Vec3::operator==(const Vec3& compare) const
-{
-	return(x == compare.x && y == compare.y && z == compare.z);
-}
-
-//-----------------------------------------------------------------------------------------------
-bool Vec3::operator!=(const Vec3& compare) const
-{
-	return (x != compare.x || y != compare.y || z != compare.z);
-}
-
-
@@ -54,32 +54,33 @@ public: // NOTE: this is one of the few cases where we break both the "m_" namin
 public:
 	// Construction/Destruction
 	//-----------------------------------------------------------------------------------------------
-	~Vec3() {}												// destructor (do nothing)
-	Vec3() {}												// default constructor (do nothing)
-	Vec3(const Vec3& copyFrom);							// copy constructor (from another vec3)
-	explicit Vec3(float initialX, float initialY, float initialZ);		// explicit constructor (from x, y, z)
+	// copy, assignment and destruction are left to the compiler so Vec3 stays trivially copyable
+	Vec3() = default;										// default constructor (zero)
+	constexpr explicit Vec3(float initialX, float initialY, float initialZ) : x(initialX), y(initialY), z(initialZ) {}	// explicit constructor (from x, y, z)
 	explicit Vec3(Vec2 const& initialXY, float initialZ);
 
 	// Operators (const)
 	//-----------------------------------------------------------------------------------------------
-	bool		operator==(const Vec3& compare) const;		// vec3 == vec3
-	bool		operator!=(const Vec3& compare) const;		// vec3 != vec3
-	const Vec3	operator+(const Vec3& vecToAdd) const;		// vec3 + vec3
-	const Vec3	operator-(const Vec3& vecToSubtract) const;	// vec3 - vec3
-	const Vec3	operator-() const;								// -vec3, i.e. "unary negation"
-	const Vec3	operator*(float uniformScale) const;			// vec3 * float
-	const Vec3	operator/(float inverseScale) const;			// vec3 / float
-	const Vec3	operator*(const Vec3& vecToMultiply) const;	// vec3 * vec3
+	constexpr bool			operator==(const Vec3& compare) const		{ return x == compare.x && y == compare.y && z == compare.z; }
+	constexpr bool			operator!=(const Vec3& compare) const		{ return x != compare.x || y != compare.y || z != compare.z; }
+	constexpr const Vec3	operator+(const Vec3& vecToAdd) const		{ return Vec3(x + vecToAdd.x, y + vecToAdd.y, z + vecToAdd.z); }
+	constexpr const Vec3	operator-(const Vec3& vecToSubtract) const	{ return Vec3(x - vecToSubtract.x, y - vecToSubtract.y, z - vecToSubtract.z); }
+	constexpr const Vec3	operator-() const							{ return Vec3(-x, -y, -z); }
+	constexpr const Vec3	operator*(float uniformScale) const			{ return Vec3(x * uniformScale, y * uniformScale, z * uniformScale); }
+	constexpr const Vec3	operator/(float inverseScale) const			{ return Vec3(x / inverseScale, y / inverseScale, z / inverseScale); }
+	constexpr const Vec3	operator*(const Vec3& vecToMultiply) const	{ return Vec3(x * vecToMultiply.x, y * vecToMultiply.y, z * vecToMultiply.z); }
 
 	// Operators (self-mutating / non-const)
 	//-----------------------------------------------------------------------------------------------
-	void		operator+=(const Vec3& vecToAdd);				// vec3 += vec3
-	void		operator-=(const Vec3& vecToSubtract);		// vec3 -= vec3
-	void		operator*=(const float uniformScale);			// vec3 *= float
-	void		operator/=(const float uniformDivisor);		// vec3 /= float
-	void		operator=(const Vec3& copyFrom);				// vec3 = vec3
+	constexpr void	operator+=(const Vec3& vecToAdd)			{ x += vecToAdd.x; y += vecToAdd.y; z += vecToAdd.z; }
+	constexpr void	operator-=(const Vec3& vecToSubtract)		{ x -= vecToSubtract.x; y -= vecToSubtract.y; z -= vecToSubtract.z; }
+	constexpr void	operator*=(const float uniformScale)		{ x *= uniformScale; y *= uniformScale; z *= uniformScale; }
+	constexpr void	operator/=(const float uniformDivisor)		{ x /= uniformDivisor; y /= uniformDivisor; z /= uniformDivisor; }
 
 	// Standalone "friend" functions that are conceptually, but not actually, part of Vec3::
-	friend const Vec3 operator*(float uniformScale, const Vec3& vecToScale);	// float * vec3
+	friend constexpr const Vec3 operator*(float uniformScale, const Vec3& vecToScale)	// float * vec3
+	{
+		return Vec3(vecToScale.x * uniformScale, vecToScale.y * uniformScale, vecToScale.z * uniformScale);
+	}
 };
 
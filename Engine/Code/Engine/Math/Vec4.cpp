@@ -1,22 +1,10 @@
 #include "Engine/Math/Vec4.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include <type_traits>
 
-Vec4::Vec4(const Vec4& copyFrom)
-	:x(copyFrom.x)
-	,y(copyFrom.y)
-	,z(copyFrom.z)
-	,w(copyFrom.w)
-{
-}
-
-Vec4::Vec4(float initialX, float initialY, float initialZ, float initialW)
-	:x(initialX)
-	,y(initialY)
-	,z(initialZ)
-	,w(initialW)
-{
-}
+static_assert(std::is_trivially_copyable<Vec4>::value, "Vec4 must stay trivially copyable");
 
 Vec4::Vec4(Rgba8 const& color)
 	:x(
@@ -37,101 +25,23 @@ void Vec4::SetFromText(char const* text)
 	w = (float)(atof(numsFromText[4].c_str()));
 }
 
-//-----------------------------------------------------------------------------------------------
-const Vec4 Vec4::operator+(const Vec4& vecToAdd) const
+float Vec4::GetLength() const
 {
-	return Vec4(x + vecToAdd.x, y + vecToAdd.y, z + vecToAdd.z, w + vecToAdd.w);
+	return SIMDGetLength4(SIMDSet(x, y, z, w));
 }
 
-//-----------------------------------------------------------------------------------------------
-const Vec4 Vec4::operator-(const Vec4& vecToSubtract) const
+Vec4 const Vec4::GetNormalized() const
 {
-	return Vec4(x - vecToSubtract.x, y - vecToSubtract.y, z - vecToSubtract.z, w - vecToSubtract.w);
+	Vec4 normalizedVec(x, y, z, w);
+	normalizedVec.Normalize();
+	return normalizedVec;
 }
 
-//-----------------------------------------------------------------------------------------------
-const Vec4 Vec4::operator-() const
+void Vec4::Normalize()
 {
-	return Vec4( -x, -y, -z, -w);
+	SIMDFloat4 vec = SIMDSet(x, y, z, w);
+	float length = SIMDGetLength4(vec);
+	if (length == 0.f || length == 1.f) return;
+	float scale = 1.f / length;
+	SIMDStore(&x, SIMDMul(vec, SIMDSplat(scale)));
 }
-
-//-----------------------------------------------------------------------------------------------
-const Vec4 Vec4::operator*(float uniformScale) const
-{
-	return Vec4(x * uniformScale, y * uniformScale, z * uniformScale, w * uniformScale);
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec4 Vec4::operator*(const Vec4& vecToMultiply) const
-{
-	return Vec4(x * vecToMultiply.x, y * vecToMultiply.y, z * vecToMultiply.z, w * vecToMultiply.w);
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec4 Vec4::operator/(float inverseScale) const
-{
-	return Vec4(x / inverseScale, y / inverseScale, z / inverseScale, w / inverseScale);
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec4::operator+=(const Vec4& vecToAdd)
-{
-	x += vecToAdd.x;
-	y += vecToAdd.y;
-	z += vecToAdd.z;
-	w += vecToAdd.w;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec4::operator-=(const Vec4& vecToSubtract)
-{
-	x -= vecToSubtract.x;
-	y -= vecToSubtract.y;
-	z -= vecToSubtract.z;
-	w -= vecToSubtract.w;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec4::operator*=(const float uniformScale)
-{
-	x *= uniformScale;
-	y *= uniformScale;
-	z *= uniformScale;
-	w *= uniformScale;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec4::operator/=(const float uniformDivisor)
-{
-	x /= uniformDivisor;
-	y /= uniformDivisor;
-	z /= uniformDivisor;
-	w *= uniformDivisor;
-}
-
-//-----------------------------------------------------------------------------------------------
-void Vec4::operator=(const Vec4& copyFrom)
-{
-	x = copyFrom.x;
-	y = copyFrom.y;
-	z = copyFrom.z;
-	w = copyFrom.w;
-}
-
-//-----------------------------------------------------------------------------------------------
-const Vec4 operator*(float uniformScale, const Vec4& vecToScale)
-{
-	return Vec4(vecToScale.x * uniformScale, vecToScale.y * uniformScale, vecToScale.z * uniformScale, vecToScale.w * uniformScale);
-}
-
-//-----------------------------------------------------------------------------------------------
-bool Vec4::operator==(const Vec4& compare) const
-{
-	return(x == compare.x && y == compare.y && z == compare.z && w == compare.w);
-}
-
-//-----------------------------------------------------------------------------------------------
-bool Vec4::operator!=(const Vec4& compare) const
-{
-	return (x != compare.x || y != compare.y || z != compare.z || w != compare.w);
-}
\ No newline at end of file
@@ -9,35 +9,41 @@ public:
 	float w = 0.f;
 
 public:
-	~Vec4() {}
-	Vec4() {}
-	Vec4(const Vec4& copyFrom);
-	explicit Vec4(float initialX, float initialY, float initialZ, float initialW);
+	Vec4() = default;
+	constexpr explicit Vec4(float initialX, float initialY, float initialZ, float initialW) : x(initialX), y(initialY), z(initialZ), w(initialW) {}
 	explicit Vec4(Rgba8 const& color);
 
+	//Accessors
+	//-----------------------------------------------------------------------------------------------
+	float		GetLength() const;
+	Vec4 const	GetNormalized() const;
+
 	//Mutators
 	//-----------------------------------------------------------------------------------------------
 	void SetFromText(char const* text);
+	void Normalize();
 
 	// Operators (const)
 	//-----------------------------------------------------------------------------------------------
-	bool		operator==(const Vec4& compare) const;		
-	bool		operator!=(const Vec4& compare) const;		
-	const Vec4	operator+(const Vec4& vecToAdd) const;		
-	const Vec4	operator-(const Vec4& vecToSubtract) const;	
-	const Vec4	operator-() const;							
-	const Vec4	operator*(float uniformScale) const;
-	const Vec4	operator/(float inverseScale) const;
-	const Vec4	operator*(const Vec4& vecToMultiply) const;
+	constexpr bool			operator==(const Vec4& compare) const		{ return x == compare.x && y == compare.y && z == compare.z && w == compare.w; }
+	constexpr bool			operator!=(const Vec4& compare) const		{ return x != compare.x || y != compare.y || z != compare.z || w != compare.w; }
+	constexpr const Vec4	operator+(const Vec4& vecToAdd) const		{ return Vec4(x + vecToAdd.x, y + vecToAdd.y, z + vecToAdd.z, w + vecToAdd.w); }
+	constexpr const Vec4	operator-(const Vec4& vecToSubtract) const	{ return Vec4(x - vecToSubtract.x, y - vecToSubtract.y, z - vecToSubtract.z, w - vecToSubtract.w); }
+	constexpr const Vec4	operator-() const							{ return Vec4(-x, -y, -z, -w); }
+	constexpr const Vec4	operator*(float uniformScale) const			{ return Vec4(x * uniformScale, y * uniformScale, z * uniformScale, w * uniformScale); }
+	constexpr const Vec4	operator/(float inverseScale) const			{ return Vec4(x / inverseScale, y / inverseScale, z / inverseScale, w / inverseScale); }
+	constexpr const Vec4	operator*(const Vec4& vecToMultiply) const	{ return Vec4(x * vecToMultiply.x, y * vecToMultiply.y, z * vecToMultiply.z, w * vecToMultiply.w); }
 
 	// Operators (self-mutating / non-const)
 	//-----------------------------------------------------------------------------------------------
-	void		operator+=(const Vec4& vecToAdd);			
-	void		operator-=(const Vec4 & vecToSubtract);
-	void		operator*=(const float uniformScale);		
-	void		operator/=(const float uniformDivisor);
-	void		operator=(const Vec4& copyFrom);
+	constexpr void	operator+=(const Vec4& vecToAdd)			{ x += vecToAdd.x; y += vecToAdd.y; z += vecToAdd.z; w += vecToAdd.w; }
+	constexpr void	operator-=(const Vec4& vecToSubtract)		{ x -= vecToSubtract.x; y -= vecToSubtract.y; z -= vecToSubtract.z; w -= vecToSubtract.w; }
+	constexpr void	operator*=(const float uniformScale)		{ x *= uniformScale; y *= uniformScale; z *= uniformScale; w *= uniformScale; }
+	constexpr void	operator/=(const float uniformDivisor)		{ x /= uniformDivisor; y /= uniformDivisor; z /= uniformDivisor; w /= uniformDivisor; }
 
-	friend const Vec4 operator*(float uniformScale, const Vec4& vecToScale);	
+	friend constexpr const Vec4 operator*(float uniformScale, const Vec4& vecToScale)
+	{
+		return Vec4(vecToScale.x * uniformScale, vecToScale.y * uniformScale, vecToScale.z * uniformScale, vecToScale.w * uniformScale);
+	}
 };
 
@@ -12,7 +12,6 @@ public:
 	ZCylinder3D() {}
 	explicit ZCylinder3D(Vec2 const& centerXY, FloatRange const& zRange, float radius);
 	explicit ZCylinder3D(Vec3 const& bottom, float height, float radius);
-	~ZCylinder3D() {}
 
 	Vec3 GetCenter() const;
 	void SetCenter(Vec3 const& newCenter);
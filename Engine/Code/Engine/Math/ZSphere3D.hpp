@@ -8,7 +8,6 @@ public:
 
 	ZSphere3D() {}
 	explicit ZSphere3D(Vec3 const& center, float radius);
-	~ZSphere3D() {}
 
 	void Translate(Vec3 const& translation);
 };
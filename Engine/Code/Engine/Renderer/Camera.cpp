@@ -1,5 +1,6 @@
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Frustum.hpp"
 
 void Camera::SetOrthoView(Vec2 const& bottomLeft, Vec2 const& topRight, float nearZ, float farZ)
 {
@@ -130,3 +131,16 @@ Mat44 Camera::GetRenderToClipTransform() const
 {
 	return GetProjectionMatrix();
 }
+
+Mat44 Camera::GetWorldToClipTransform() const
+{
+	Mat44 worldToClip = GetRenderToClipTransform();
+	worldToClip.Append(GetCameraToRenderTransform());
+	worldToClip.Append(GetWorldToCameraTransform());
+	return worldToClip;
+}
+
+Frustum Camera::GetWorldFrustum() const
+{
+	return Frustum::MakeFromWorldToClipTransform(GetWorldToClipTransform());
+}
@@ -5,6 +5,7 @@
 #include "Engine/Math/AABB2.hpp"
 #pragma once
 struct AABB3;
+struct Frustum;
 class Camera
 {
 public:
@@ -35,6 +36,8 @@ public:
 	Mat44 GetCameraToRenderTransform() const;
 
 	Mat44 GetRenderToClipTransform() const;
+	Mat44 GetWorldToClipTransform() const;
+	Frustum GetWorldFrustum() const; //for culling in world space
 
 	Vec2 GetOrthoBottomLeft() const;
 	Vec2 GetOrthoTopRight() const;
@@ -6,15 +6,21 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Math/FastTrig.hpp"
 #include "Engine/Core/Time.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Audio/AudioSystem.hpp"
 #include "Engine//Window/Window.hpp"
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/MeshOptimizer.hpp"
 
 
 #include "Game/Game.hpp"
+#include "Game/MatchBatch.hpp"
 
 App* g_app = nullptr;
 RendererDX11* g_renderer = nullptr;
@@ -60,10 +66,37 @@ void App::Startup()
 	g_inputSystem->Startup();
 	g_audioSystem->Startup();
 
-	m_game = new Game();
+	m_game = CreateGame();
 	m_game->Startup();
 
 	SubscribeEventCallbackFunction("Quit", QuitEvent);
+	Strings simulateArguments;
+	simulateArguments.push_back("Matches=");
+	simulateArguments.push_back("Seconds=");
+	simulateArguments.push_back("Bots=");
+	simulateArguments.push_back("Matches=64 Seconds=120 Bots=2");
+	SubscribeEventCallbackFunction("SimulateBotMatches", simulateArguments, Event_SimulateBotMatches);
+
+	Strings benchmarkArguments;
+	benchmarkArguments.push_back("Iterations=");
+	benchmarkArguments.push_back("Iterations=1000000");
+	SubscribeEventCallbackFunction("BenchmarkMathSIMD", benchmarkArguments, Event_BenchmarkMathSIMD);
+
+	Strings trigBenchmarkArguments;
+	trigBenchmarkArguments.push_back("Samples=");
+	trigBenchmarkArguments.push_back("Samples=1000000");
+	SubscribeEventCallbackFunction("BenchmarkFastTrig", trigBenchmarkArguments, Event_BenchmarkFastTrig);
+
+	Strings vertexBenchmarkArguments;
+	vertexBenchmarkArguments.push_back("Quads=");
+	vertexBenchmarkArguments.push_back("Quads=250000");
+	SubscribeEventCallbackFunction("BenchmarkVertexBuilding", vertexBenchmarkArguments, Event_BenchmarkVertexBuilding);
+
+	Strings meshOptimizerBenchmarkArguments;
+	meshOptimizerBenchmarkArguments.push_back("Slices=");
+	meshOptimizerBenchmarkArguments.push_back("Stacks=");
+	meshOptimizerBenchmarkArguments.push_back("Slices=256 Stacks=128");
+	SubscribeEventCallbackFunction("BenchmarkMeshOptimizer", meshOptimizerBenchmarkArguments, Event_BenchmarkMeshOptimizer);
 }
 
 void App::Shutdown()
@@ -167,6 +200,130 @@ void App::RestartGame()
 	delete m_game;
 	m_game = nullptr;
 
-	m_game = new Game();
+	m_game = CreateGame();
 	m_game->Startup();
 }
+
+Game* App::CreateGame() const
+{
+	GameConfig gameConfig;
+	gameConfig.m_app = g_app;
+	gameConfig.m_renderer = g_renderer;
+	gameConfig.m_audioSystem = g_audioSystem;
+	gameConfig.m_inputSystem = g_inputSystem;
+	gameConfig.m_eventSystem = g_eventSystem;
+	gameConfig.m_devConsole = g_devConsole;
+	gameConfig.m_parentClock = &Clock::GetSystemClock();
+	gameConfig.m_seed = static_cast<unsigned int>(GetCurrentTimeSeconds() * 1000.0);
+	return new Game(gameConfig);
+}
+
+//Runs seeded headless bot matches across every core and reports how far they got, for balance checks
+bool App::Event_SimulateBotMatches(EventArgs& args)
+{
+	constexpr float SIMULATION_STEP_SECONDS = 1.f / 60.f;
+	int numMatches = args.GetValue("Matches", 64);
+	float numSeconds = args.GetValue("Seconds", 120.f);
+	int numBots = args.GetValue("Bots", 2);
+	if (numMatches <= 0 || numSeconds <= 0.f)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "SimulateBotMatches needs Matches > 0 and Seconds > 0");
+		return false;
+	}
+
+	MatchBatch batch;
+	for (int matchNum = 0; matchNum < numMatches; ++matchNum)
+	{
+		batch.AddHeadlessMatch(static_cast<unsigned int>(matchNum), numBots);
+	}
+
+	double startTime = GetCurrentTimeSeconds();
+	int numSteps = static_cast<int>(numSeconds / SIMULATION_STEP_SECONDS);
+	for (int stepNum = 0; stepNum < numSteps && batch.GetNumFinishedMatches() < numMatches; ++stepNum)
+	{
+		batch.StepAllMatches(SIMULATION_STEP_SECONDS);
+	}
+	double elapsedTime = GetCurrentTimeSeconds() - startTime;
+
+	int totalWaves = 0;
+	for (int matchNum = 0; matchNum < batch.GetNumMatches(); ++matchNum)
+	{
+		totalWaves += batch.GetMatch(matchNum)->GetCurrentWave();
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Simulated %d matches in %.2fs, %d finished, average wave reached %.2f",
+		numMatches, elapsedTime, batch.GetNumFinishedMatches(), static_cast<float>(totalWaves) / static_cast<float>(numMatches)));
+	return true;
+}
+
+bool App::Event_BenchmarkMathSIMD(EventArgs& args)
+{
+	int numIterations = args.GetValue("Iterations", 1000000);
+	if (numIterations <= 0)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "BenchmarkMathSIMD needs Iterations > 0");
+		return false;
+	}
+
+	SIMDBenchmarkResults results = RunMat44SIMDBenchmark(numIterations);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Mat44 benchmark (%s), %d iterations, max difference %g", GetSIMDPathName(), numIterations, results.m_maxAbsDifference));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  Append:          scalar %.2fms, simd %.2fms", results.m_scalarAppendSeconds * 1000.0, results.m_simdAppendSeconds * 1000.0));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  TransformPos3D:  scalar %.2fms, simd %.2fms", results.m_scalarTransformSeconds * 1000.0, results.m_simdTransformSeconds * 1000.0));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  OrthoInverse:    scalar %.2fms, simd %.2fms", results.m_scalarInverseSeconds * 1000.0, results.m_simdInverseSeconds * 1000.0));
+	return true;
+}
+
+bool App::Event_BenchmarkFastTrig(EventArgs& args)
+{
+	int numSamples = args.GetValue("Samples", 1000000);
+	if (numSamples <= 0)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "BenchmarkFastTrig needs Samples > 0");
+		return false;
+	}
+
+	FastTrigBenchmarkResults results = RunFastTrigBenchmark(numSamples);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Fast trig benchmark, %d samples", numSamples));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  SinCos: libm %.2fms, fast %.2fms, fast batch %.2fms, max error %g",
+		results.m_libmSinCosSeconds * 1000.0, results.m_fastSinCosSeconds * 1000.0, results.m_fastSinCosBatchSeconds * 1000.0, results.m_maxSinCosError));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  Atan2:  libm %.2fms, fast %.2fms, max error %g degrees",
+		results.m_libmAtan2Seconds * 1000.0, results.m_fastAtan2Seconds * 1000.0, results.m_maxAtan2ErrorDegrees));
+	return true;
+}
+
+bool App::Event_BenchmarkVertexBuilding(EventArgs& args)
+{
+	int numQuads = args.GetValue("Quads", 250000);
+	if (numQuads <= 0)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "BenchmarkVertexBuilding needs Quads > 0");
+		return false;
+	}
+
+	VertexBuildingBenchmarkResults results = RunVertexBuildingBenchmark(numQuads);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Vertex building benchmark, %d quads (%d verts)", numQuads, numQuads * 6));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  AddVertsForAABB2D:        %.2fms (baseline %.2fms)", results.m_buildAABB2Seconds * 1000.0, results.m_baselineBuildAABB2Seconds * 1000.0));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  TransformVertexArrayXY3D: %.2fms", results.m_transformXYSeconds * 1000.0));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  TransformVertexArray3D:   %.2fms", results.m_transform3DSeconds * 1000.0));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  Copy: per vertex %.2fms (baseline %.2fms), bulk %.2fms (baseline %.2fms)", results.m_copyLoopSeconds * 1000.0, results.m_baselineCopyLoopSeconds * 1000.0,
+		results.m_copyBulkSeconds * 1000.0, results.m_baselineCopyBulkSeconds * 1000.0));
+	return true;
+}
+
+bool App::Event_BenchmarkMeshOptimizer(EventArgs& args)
+{
+	int numSlices = args.GetValue("Slices", 256);
+	int numStacks = args.GetValue("Stacks", 128);
+	if (numSlices < 3 || numStacks < 2)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "BenchmarkMeshOptimizer needs Slices >= 3 and Stacks >= 2");
+		return false;
+	}
+
+	MeshOptimizerBenchmarkResults results = RunMeshOptimizerBenchmark(numSlices, numStacks);
+	MeshOptimizationStats const& stats = results.m_stats;
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Mesh optimizer benchmark, %dx%d UV sphere (%d triangles) in %.2fms", numSlices, numStacks, stats.m_numTriangles, results.m_optimizeSeconds * 1000.0));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  Verts: %d -> %d", stats.m_numVertsBefore, stats.m_numVertsAfter));
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("  ACMR:  %.3f -> %.3f", stats.m_acmrBefore, stats.m_acmrAfter));
+	return true;
+}
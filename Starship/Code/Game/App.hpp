@@ -16,6 +16,11 @@ public:
 
 	//Mutators
 	static bool QuitEvent(EventArgs& args);
+	static bool Event_SimulateBotMatches(EventArgs& args);
+	static bool Event_BenchmarkMathSIMD(EventArgs& args);
+	static bool Event_BenchmarkFastTrig(EventArgs& args);
+	static bool Event_BenchmarkVertexBuilding(EventArgs& args);
+	static bool Event_BenchmarkMeshOptimizer(EventArgs& args);
 	void HandleQuitRequested();
 	void RestartGame();
 
@@ -29,7 +34,9 @@ private:
 	void Render() const;
 	void EndFrame();
 
-	
+	//Game Management
+	Game* CreateGame() const;
+
 private:
 	bool m_isQuitting = false;
 	//float m_timeLastFrameStart = 0.f;
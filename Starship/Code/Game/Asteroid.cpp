@@ -19,8 +19,8 @@ Asteroid::Asteroid(Game* owner, Vec2 const& startPos, float orientationDeg)
 	m_cosmeticRadius = ASTEROID_COSMETIC_RADIUS;
 	m_health = ASTEROID_STARTING_HEALTH;
 
-	m_angularVelocity = g_rng->RollRandomFloatInRange(-200, 200);
-	m_velocity = GetForwardNormal() * g_rng->RollRandomFloatInRange(ASTEROID_MIN_SPEED, ASTEROID_MAX_SPEED);
+	m_angularVelocity = m_game->m_rng.RollRandomFloatInRange(-200, 200);
+	m_velocity = GetForwardNormal() * m_game->m_rng.RollRandomFloatInRange(ASTEROID_MIN_SPEED, ASTEROID_MAX_SPEED);
 
 	InitializeLocalVerts();
 }
@@ -52,7 +52,7 @@ void Asteroid::Render() const
 	Vec2 fwrdNormal = GetForwardNormal();
 	TransformVertexArrayXY3D(NUM_ASTEROID_VERTS, worldSpaceVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
 
-	g_renderer->DrawVertexArray(NUM_ASTEROID_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->DrawVertexArray(NUM_ASTEROID_VERTS, &worldSpaceVerts[0]);
 
 	if (m_game->m_shouldDrawDebug)
 	{
@@ -67,7 +67,7 @@ void Asteroid::Die()
 	m_isDead = true;
 	m_isGarbage = true;
 
-	int debrisAmount = g_rng->RollRandomIntInRange(3, 12);
+	int debrisAmount = m_game->m_rng.RollRandomIntInRange(3, 12);
 	m_game->SpawnNewDebrisCluster(m_position, debrisAmount, m_velocity, DEBRIS_MAX_SCATTER_SPEED, m_physicsRadius * 0.85f, m_color);
 
 	TryToDropPowerUp(25);
@@ -92,7 +92,7 @@ void Asteroid::InitializeLocalVerts()
 	float asteroidRadii[NUM_ASTEROID_SIDES] = {};
 	for (int sideNum = 0; sideNum < NUM_ASTEROID_SIDES; ++sideNum)
 	{
-		asteroidRadii[sideNum] = g_rng->RollRandomFloatInRange(m_physicsRadius, m_cosmeticRadius);
+		asteroidRadii[sideNum] = m_game->m_rng.RollRandomFloatInRange(m_physicsRadius, m_cosmeticRadius);
 	}
 
 	//compute 2d vertex offsets
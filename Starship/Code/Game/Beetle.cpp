@@ -48,10 +48,10 @@ void Beetle::Render() const
 	Vec2 fwrdNormal = GetForwardNormal();
 	TransformVertexArrayXY3D(NUM_BEETLE_VERTS, worldSpaceVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
 
-	g_renderer->BindTexture(nullptr);
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_NONE);
-	g_renderer->DrawVertexArray(NUM_BEETLE_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->BindTexture(nullptr);
+	m_game->m_renderer->SetBlendMode(BlendMode::ALPHA);
+	m_game->m_renderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_NONE);
+	m_game->m_renderer->DrawVertexArray(NUM_BEETLE_VERTS, &worldSpaceVerts[0]);
 
 	if (m_game->m_shouldDrawDebug)
 	{
@@ -67,7 +67,7 @@ void Beetle::Die()
 	m_isGarbage = true;
 	m_game->m_numEnemies--;
 
-	int debrisAmount = g_rng->RollRandomIntInRange(3, 12);
+	int debrisAmount = m_game->m_rng.RollRandomIntInRange(3, 12);
 	m_game->SpawnNewDebrisCluster(m_position, debrisAmount, m_velocity, DEBRIS_MAX_SCATTER_SPEED, m_physicsRadius * 0.85f, m_color);
 
 	TryToDropPowerUp(10);
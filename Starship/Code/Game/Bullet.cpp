@@ -41,6 +41,7 @@ Bullet::Bullet(Game* owner, Vec2 const& startingPosition, float orientationDeg,
 
 void Bullet::Update(float deltaSeconds)
 {
+	m_age += deltaSeconds;
 	m_velocity = GetForwardNormal() * m_speed;
 	m_position += m_velocity * deltaSeconds;
 	
@@ -56,6 +57,17 @@ void Bullet::Update(float deltaSeconds)
 	}
 }
 
+//a sleeping bullet stays put but keeps its flight clock running, so it can't wake up later with its range left
+void Bullet::UpdateDormant(float deltaSeconds)
+{
+	m_age += deltaSeconds;
+	if (m_age * m_speed >= m_maxBulletRange)
+	{
+		m_isDead = true;
+		m_isGarbage = true;
+	}
+}
+
 void Bullet::Render() const
 {
 	Vertex_PCU worldSpaceVerts[NUM_BULLET_VERTS];
@@ -67,7 +79,7 @@ void Bullet::Render() const
 	Vec2 fwrdNormal = GetForwardNormal();
 	TransformVertexArrayXY3D(NUM_BULLET_VERTS, worldSpaceVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
 
-	g_renderer->DrawVertexArray(NUM_BULLET_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->DrawVertexArray(NUM_BULLET_VERTS, &worldSpaceVerts[0]);
 
 	if (m_game->m_shouldDrawDebug)
 		DebugRender(m_game->m_firstPlayerShip->m_position);
@@ -13,6 +13,7 @@ public:
 	~Bullet() {};
 
 	virtual void Update(float deltaSeconds) override;
+	void UpdateDormant(float deltaSeconds);
 	virtual void Render() const override;
 	virtual void Die() override;
 
@@ -0,0 +1,73 @@
+#include "Game/CollisionGrid.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include "Game/Entity.hpp"
+
+void CollisionGrid::Initialize(AABB2 const& worldBounds, float cellSize, float maxEntityRadius)
+{
+	m_worldBounds = worldBounds;
+	m_cellSize = cellSize;
+	m_maxEntityRadius = maxEntityRadius;
+
+	Vec2 worldDimensions = worldBounds.GetDimensions();
+	m_dimensions.x = RoundDownToInt(worldDimensions.x / cellSize) + 1;
+	m_dimensions.y = RoundDownToInt(worldDimensions.y / cellSize) + 1;
+
+	int numCells = m_dimensions.x * m_dimensions.y * static_cast<int>(CollisionLayer::NUM_LAYERS);
+	m_entitiesByCell.clear();
+	m_entitiesByCell.resize(numCells);
+	m_filledCellIndexes.clear();
+}
+
+void CollisionGrid::Clear()
+{
+	for (int filledNum = 0; filledNum < static_cast<int>(m_filledCellIndexes.size()); ++filledNum)
+	{
+		m_entitiesByCell[m_filledCellIndexes[filledNum]].clear();
+	}
+	m_filledCellIndexes.clear();
+}
+
+void CollisionGrid::AddEntity(Entity* entity, CollisionLayer layer)
+{
+	IntVec2 cellCoords = GetCellCoordsForPosition(entity->m_position);
+	int cellIndex = GetCellIndex(cellCoords.x, cellCoords.y, layer);
+	std::vector<Entity*>& cellEntities = m_entitiesByCell[cellIndex];
+	if (cellEntities.empty())
+	{
+		m_filledCellIndexes.push_back(cellIndex);
+	}
+	cellEntities.push_back(entity);
+}
+
+void CollisionGrid::GetEntitiesNearDisc(Vec2 const& center, float radius, CollisionLayer layer, std::vector<Entity*>& out_entities) const
+{
+	//entities are bucketed by center, so pad the query by the largest radius any of them can have
+	float reach = radius + m_maxEntityRadius;
+	IntVec2 minCoords = GetCellCoordsForPosition(center - Vec2(reach, reach));
+	IntVec2 maxCoords = GetCellCoordsForPosition(center + Vec2(reach, reach));
+	for (int cellY = minCoords.y; cellY <= maxCoords.y; ++cellY)
+	{
+		for (int cellX = minCoords.x; cellX <= maxCoords.x; ++cellX)
+		{
+			std::vector<Entity*> const& cellEntities = m_entitiesByCell[GetCellIndex(cellX, cellY, layer)];
+			out_entities.insert(out_entities.end(), cellEntities.begin(), cellEntities.end());
+		}
+	}
+}
+
+IntVec2 const CollisionGrid::GetCellCoordsForPosition(Vec2 const& position) const
+{
+	//positions outside the world (spawning enemies) clamp into the edge cells
+	Vec2 localPosition = position - m_worldBounds.m_mins;
+	int cellX = GetClampedInt(RoundDownToInt(localPosition.x / m_cellSize), 0, m_dimensions.x - 1);
+	int cellY = GetClampedInt(RoundDownToInt(localPosition.y / m_cellSize), 0, m_dimensions.y - 1);
+	return IntVec2(cellX, cellY);
+}
+
+int CollisionGrid::GetCellIndex(int cellX, int cellY, CollisionLayer layer) const
+{
+	int cellsPerLayer = m_dimensions.x * m_dimensions.y;
+	return (static_cast<int>(layer) * cellsPerLayer) + cellX + (cellY * m_dimensions.x);
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include <vector>
+
+class Entity;
+
+enum class CollisionLayer
+{
+	PLAYER_SHIP,
+	BULLET,
+	ASTEROID,
+	BEETLE,
+	WASP,
+	POWERUP,
+	NUM_LAYERS,
+};
+
+//Broadphase for every collision check in the game
+//Entities are bucketed by center each frame, so a query only has to look at the cells its disc could reach
+class CollisionGrid
+{
+public:
+	CollisionGrid() {};
+	~CollisionGrid() {};
+
+	void Initialize(AABB2 const& worldBounds, float cellSize, float maxEntityRadius);
+
+	void Clear(); //only touches the cells filled since the last clear
+	void AddEntity(Entity* entity, CollisionLayer layer);
+
+	//Appends every entity on the layer whose cell could hold a disc overlapping the query disc, callers still do the exact test
+	void GetEntitiesNearDisc(Vec2 const& center, float radius, CollisionLayer layer, std::vector<Entity*>& out_entities) const;
+
+private:
+	IntVec2 const GetCellCoordsForPosition(Vec2 const& position) const;
+	int GetCellIndex(int cellX, int cellY, CollisionLayer layer) const;
+
+private:
+	AABB2 m_worldBounds;
+	float m_cellSize = 1.f;
+	float m_maxEntityRadius = 0.f;
+	IntVec2 m_dimensions;
+
+	std::vector<std::vector<Entity*>> m_entitiesByCell; //one block of cells per layer
+	std::vector<int> m_filledCellIndexes;
+};
@@ -16,7 +16,7 @@ Debris::Debris(Game* owner, Vec2 const& startPos, float orientationDeg, Vec2 con
 	m_cosmeticRadius = cosmeticRadius;
 
 	m_velocity = velocity;
-	m_angularVelocity = g_rng->RollRandomFloatInRange(-200, 200);
+	m_angularVelocity = m_game->m_rng.RollRandomFloatInRange(-200, 200);
 	m_age = 0.f;
 	InitializeLocalVerts();
 
@@ -47,7 +47,7 @@ void Debris::Render() const
 
 	TransformVertexArrayXY3D(NUM_DEBRIS_VERTS, worldSpaceVerts, 1.f, m_orientationDegrees, m_position);
 
-	g_renderer->DrawVertexArray(NUM_DEBRIS_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->DrawVertexArray(NUM_DEBRIS_VERTS, &worldSpaceVerts[0]);
 
 	if (m_game->m_shouldDrawDebug)
 		DebugRender(m_game->m_firstPlayerShip->m_position);
@@ -75,7 +75,7 @@ void Debris::InitializeLocalVerts()
 	float asteroidRadii[NUM_DEBRIS_SIDES] = {};
 	for (int sideNum = 0; sideNum < NUM_DEBRIS_SIDES; ++sideNum)
 	{
-		asteroidRadii[sideNum] = g_rng->RollRandomFloatInRange(m_physicsRadius, m_cosmeticRadius);
+		asteroidRadii[sideNum] = m_game->m_rng.RollRandomFloatInRange(m_physicsRadius, m_cosmeticRadius);
 	}
 
 	//compute 2d vertex offsets
@@ -9,6 +9,8 @@
 //
 
 //#define ENGINE_DISABLE_AUDIO	// (If uncommented) Disables AudioSystem code and fmod linkage.
+//#define ENGINE_DISABLE_SIMD		// (If uncommented) Forces the scalar path in Engine/Math/SIMDUtils.hpp.
+//#define ENGINE_FAST_TRIG		// (If uncommented) Routes SinCosDegrees and the Vec2 / Mat44 rotation helpers through Engine/Math/FastTrig.hpp.
 #if defined (_DEBUG)
 #define ENGINE_DEBUG_RENDERER
 #endif
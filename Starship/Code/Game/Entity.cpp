@@ -1,6 +1,8 @@
 #include "Game/Entity.hpp"
 
 #include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/AABB2.hpp"
 #include"Engine/Core/Vertex_PCU.hpp"
 
 #include "Game/Game.hpp"
@@ -26,23 +28,23 @@ void Entity::DebugRender(Vec2 const& shipPos) const
 {
 	//Forward Vector
 	Vec2 vecFwrd = GetForwardNormal() * m_cosmeticRadius;
-	DebugDrawLine2D(m_position, m_position + vecFwrd, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 0));
+	DebugDrawLine2D(m_game->m_renderer, m_position, m_position + vecFwrd, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 0));
 
 	//Draw Line To player Ship
-	DebugDrawLine2D(m_position, shipPos, DEBUG_LINE_THICKNESS, Rgba8(50, 50, 50));
+	DebugDrawLine2D(m_game->m_renderer, m_position, shipPos, DEBUG_LINE_THICKNESS, Rgba8(50, 50, 50));
 
 	//Left Vector
 	Vec2 vecLeft = vecFwrd.GetRotated90Degrees();
-	DebugDrawLine2D(m_position, m_position + vecLeft, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 0));
+	DebugDrawLine2D(m_game->m_renderer, m_position, m_position + vecLeft, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 0));
 
 	//Cosmetic Ring
-	DebugDrawRing(m_position, m_cosmeticRadius, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 255));
+	DebugDrawRing(m_game->m_renderer, m_position, m_cosmeticRadius, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 255));
 
 	//Physics Ring
-	DebugDrawRing(m_position, m_physicsRadius, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 255));
+	DebugDrawRing(m_game->m_renderer, m_position, m_physicsRadius, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 255));
 
 	//Velocity Line
-	DebugDrawLine2D(m_position, m_position + m_velocity, DEBUG_LINE_THICKNESS, Rgba8(255, 255, 0));
+	DebugDrawLine2D(m_game->m_renderer, m_position, m_position + m_velocity, DEBUG_LINE_THICKNESS, Rgba8(255, 255, 0));
 }
 
 //Version of DebugRender that does not include line to Player ship
@@ -50,20 +52,20 @@ void Entity::DebugRender() const
 {
 	//Forward Vector
 	Vec2 vecFwrd = GetForwardNormal() * m_cosmeticRadius;
-	DebugDrawLine2D(m_position, m_position + vecFwrd, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 0));
+	DebugDrawLine2D(m_game->m_renderer, m_position, m_position + vecFwrd, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 0));
 
 	//Left Vector
 	Vec2 vecLeft = vecFwrd.GetRotated90Degrees();
-	DebugDrawLine2D(m_position, m_position + vecLeft, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 0));
+	DebugDrawLine2D(m_game->m_renderer, m_position, m_position + vecLeft, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 0));
 
 	//Cosmetic Ring
-	DebugDrawRing(m_position, m_cosmeticRadius, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 255));
+	DebugDrawRing(m_game->m_renderer, m_position, m_cosmeticRadius, DEBUG_LINE_THICKNESS, Rgba8(255, 0, 255));
 
 	//Physics Ring
-	DebugDrawRing(m_position, m_physicsRadius, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 255));
+	DebugDrawRing(m_game->m_renderer, m_position, m_physicsRadius, DEBUG_LINE_THICKNESS, Rgba8(0, 255, 255));
 
 	//Velocity Line
-	DebugDrawLine2D(m_position, m_position + m_velocity, DEBUG_LINE_THICKNESS, Rgba8(255, 255, 0));
+	DebugDrawLine2D(m_game->m_renderer, m_position, m_position + m_velocity, DEBUG_LINE_THICKNESS, Rgba8(255, 255, 0));
 }
 
 //Health
@@ -84,7 +86,7 @@ void Entity::Die()
 	m_isDead = true;
 	m_isGarbage = true;
 
-	int debrisAmount = g_rng->RollRandomIntInRange(3, 12);
+	int debrisAmount = m_game->m_rng.RollRandomIntInRange(3, 12);
 	m_game->SpawnNewDebrisCluster(m_position, debrisAmount, m_velocity, DEBRIS_MAX_SCATTER_SPEED, m_physicsRadius * 0.85f, m_color);
 }
 
@@ -97,34 +99,36 @@ void Entity::ToggleDebugDraw()
 
 void Entity::WrapToOppositeSide()
 {
+	AABB2 const& worldBounds = m_game->GetWorldBounds();
+
 	//west wall
-	if (m_position.x < -m_cosmeticRadius)
+	if (m_position.x < worldBounds.m_mins.x - m_cosmeticRadius)
 	{
-		m_position.x = WORLD_SIZE_X + m_cosmeticRadius;
+		m_position.x = worldBounds.m_maxs.x + m_cosmeticRadius;
 	}
 
 	//east wall
-	else if (m_position.x > WORLD_SIZE_X + m_cosmeticRadius)
+	else if (m_position.x > worldBounds.m_maxs.x + m_cosmeticRadius)
 	{
-		m_position.x = 0.f - m_cosmeticRadius;
+		m_position.x = worldBounds.m_mins.x - m_cosmeticRadius;
 	}
 
 	//north wall
-	if (m_position.y > WORLD_SIZE_Y + m_cosmeticRadius)
+	if (m_position.y > worldBounds.m_maxs.y + m_cosmeticRadius)
 	{
-		m_position.y = 0.f - m_cosmeticRadius;
+		m_position.y = worldBounds.m_mins.y - m_cosmeticRadius;
 	}
 
 	//south wall
-	if (m_position.y < -m_cosmeticRadius)
+	if (m_position.y < worldBounds.m_mins.y - m_cosmeticRadius)
 	{
-		m_position.y = WORLD_SIZE_Y + m_cosmeticRadius;
+		m_position.y = worldBounds.m_maxs.y + m_cosmeticRadius;
 	}
 }
 
 void Entity::TryToDropPowerUp(int percentageSuccess) const
 {
-	int randNum = g_rng->RollRandomIntInRange(0, 100);
+	int randNum = m_game->m_rng.RollRandomIntInRange(0, 100);
 	if (randNum > percentageSuccess)
 		return;
 
@@ -156,11 +160,10 @@ float const Entity::GetPhysicsRadius() const
 
 bool const Entity::IsOffScreen() const
 {
-	Vec2 worldMax(WORLD_CENTER_X + (WORLD_SIZE_X * 0.5f), WORLD_CENTER_Y + (WORLD_SIZE_Y * 0.5f));
-	Vec2 worldMin(WORLD_CENTER_X - (WORLD_SIZE_X * 0.5f), WORLD_CENTER_Y - (WORLD_SIZE_Y * 0.5f));
+	AABB2 const& worldBounds = m_game->GetWorldBounds();
 
-	if (m_position.x > worldMax.x + m_cosmeticRadius || m_position.y > worldMax.y + m_cosmeticRadius
-		|| m_position.x < worldMin.x - m_cosmeticRadius || m_position.y < worldMin.y - m_cosmeticRadius)
+	if (m_position.x > worldBounds.m_maxs.x + m_cosmeticRadius || m_position.y > worldBounds.m_maxs.y + m_cosmeticRadius
+		|| m_position.x < worldBounds.m_mins.x - m_cosmeticRadius || m_position.y < worldBounds.m_mins.y - m_cosmeticRadius)
 	{
 		return true;
 	}
@@ -168,3 +171,7 @@ bool const Entity::IsOffScreen() const
 	return false;
 }
 
+bool const Entity::IsVisibleInBounds(AABB2 const& cameraBounds) const
+{
+	return DoDiscAndAABB2Overlap(m_position, m_cosmeticRadius, cameraBounds);
+}
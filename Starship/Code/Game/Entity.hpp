@@ -4,6 +4,15 @@
 
 class Game;
 struct Rgba8;
+struct AABB2;
+
+//How often an entity updates, picked each frame from its distance to the nearest player
+enum class UpdateLOD
+{
+	FULL,
+	HALF,
+	QUARTER,
+};
 
 class Entity
 {
@@ -33,6 +42,7 @@ public:
 	bool const IsOffScreen() const;
 	bool const IsAlive() const;
 	bool const IsGarbage() const { return m_isGarbage; };
+	bool const IsVisibleInBounds(AABB2 const& cameraBounds) const;
 	Vec2 const GetForwardNormal() const;
 	float const GetPhysicsRadius() const;
 
@@ -42,6 +52,9 @@ public:
 	Vec2 m_velocity;
 	Rgba8 m_color;
 	int m_health = 0;
+	bool m_isDormant = false; //true while outside every player's active chunks; skips update and collision
+	UpdateLOD m_updateLOD = UpdateLOD::FULL;
+	float m_unsimulatedSeconds = 0.f; //delta time banked on skipped frames, handed over on the next update
 
 protected:
 	Game* m_game = nullptr;
@@ -28,52 +28,78 @@
 #include "Game/Wasp.hpp"
 #include "Game/Star.hpp"
 #include "Game/PowerUp.hpp"
+#include "Game/ScreenWidget.hpp"
 
-RandomNumberGenerator* g_rng;
 extern Game* m_game;
 
-Game::Game()
+Game::Game(GameConfig const& config)
+	:m_config(config),
+	m_rng(config.m_seed),
+	m_renderer(config.m_renderer),
+	m_audioSystem(config.m_audioSystem),
+	m_inputSystem(config.m_inputSystem),
+	m_devConsole(config.m_devConsole),
+	m_app(config.m_app),
+	m_numPlayerSlots(config.m_maxNumPlayers > 0 ? config.m_maxNumPlayers : 1)
 {
  	m_worldCamera = new Camera();
 	m_screenCamera = new Camera();
-	g_rng = new RandomNumberGenerator();
 
 	m_worldCamBottomLeft = Vec2(0.f, 0.f);
 	m_worldCamTopRight = Vec2(WORLD_SIZE_X, WORLD_SIZE_Y);
 	m_standardBodyTextColor = Rgba8(164, 164, 164, 255);
 
+	//headless games own their root clock so each one can be stepped independently
+	m_parentClock = config.m_parentClock;
+	if (m_parentClock == nullptr)
+	{
+		m_ownedRootClock = new Clock(nullptr);
+		m_parentClock = m_ownedRootClock;
+	}
+	m_clock = new Clock(*m_parentClock);
+
 	LoadAllAudioAssets();
+	InitWorldBounds();
 	InitPlayerData();
 	InitEnemyWaveData();
 	InitStarLocations();
 	InitAttractScreen();
 	PlayGameMusic(StarShipMusic::ATTRACT_SCREEN_MUSIC, true);
-	m_clock = new Clock(Clock::GetSystemClock());
-
-	g_eventSystem->SubscribeEventCallbackFunction("Controls", Game::Event_ShowGameControls);
-	Strings timeScaleArguments;
-	timeScaleArguments.push_back("Scale=");
-	timeScaleArguments.push_back("Scale=1.0");
-	g_eventSystem->SubscribeEventCallbackFunction("TimeScale", timeScaleArguments, Game::Event_TimeScale);
-	g_eventSystem->SubscribeEventCallbackFunction("DebugDraw", Game::Event_DebugDraw);
-	g_eventSystem->SubscribeEventCallbackFunction("Restart", Game::Event_Restart);
+
+	if (config.m_eventSystem != nullptr)
+	{
+		config.m_eventSystem->SubscribeEventCallbackFunction("Controls", Game::Event_ShowGameControls);
+		Strings timeScaleArguments;
+		timeScaleArguments.push_back("Scale=");
+		timeScaleArguments.push_back("Scale=1.0");
+		config.m_eventSystem->SubscribeEventCallbackFunction("TimeScale", timeScaleArguments, Game::Event_TimeScale);
+		config.m_eventSystem->SubscribeEventCallbackFunction("DebugDraw", Game::Event_DebugDraw);
+		config.m_eventSystem->SubscribeEventCallbackFunction("Restart", Game::Event_Restart);
+		config.m_eventSystem->SubscribeEventCallbackFunction("LargeWorld", Game::Event_LargeWorld);
+	}
 	PrintControlsToDevConsole();
-	
+
+	if (config.m_numBotPlayers > 0)
+	{
+		StartBotMatch(config.m_numBotPlayers, config.m_coOpMode);
+	}
 }
 
 Game::~Game()
 {
-	g_audioSystem->StopSound(m_gameMusic);
-	g_audioSystem->StopSound(m_attractScreenMusic);
+	StopGameMusic(m_gameMusic);
+	StopGameMusic(m_attractScreenMusic);
 
+	delete m_gameOverTimer;
+	m_gameOverTimer = nullptr;
 	delete m_clock;
 	m_clock = nullptr;
+	delete m_ownedRootClock;
+	m_ownedRootClock = nullptr;
 	delete m_worldCamera;
 	m_worldCamera = nullptr;
 	delete m_screenCamera;
 	m_screenCamera = nullptr;
-	delete g_rng;
-	g_rng = nullptr;
 
 	
 	//delete all entities
@@ -113,7 +139,7 @@ Game::~Game()
 		m_wasps[waspNum] = nullptr;
 	}
 
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_playerShips[playerNum] == nullptr)
 			continue;
@@ -122,14 +148,12 @@ Game::~Game()
 		m_playerShips[playerNum] = nullptr;
 	}
 
-	for (int starNum = 0; starNum < MAX_STARS; ++starNum)
+	for (int starNum = 0; starNum < static_cast<int>(m_stars.size()); ++starNum)
 	{
-		if (m_stars[starNum] == nullptr)
-			continue;
-
 		delete(m_stars[starNum]);
 		m_stars[starNum] = nullptr;
 	}
+	m_stars.clear();
 
 	for (int powerUpNum = 0; powerUpNum < MAX_POWERUPS; ++powerUpNum)
 	{
@@ -170,18 +194,24 @@ void Game::Update()
 
 void Game::Render() const
 {
-	g_renderer->ClearScreen(Rgba8::BLACK);
+	if (m_renderer == nullptr)
+		return;
+
+	m_renderer->ClearScreen(Rgba8::BLACK);
 
 	//World Camera
-	g_renderer->BeginCamera(*m_worldCamera);
+	m_renderer->BeginCamera(*m_worldCamera);
 	ManageConditionalGameStateWorldRenders();
-	g_renderer->EndCamera(*m_worldCamera);
+	m_renderer->EndCamera(*m_worldCamera);
 
 	//Screen Camera
-	g_renderer->BeginCamera(*m_screenCamera);
+	m_renderer->BeginCamera(*m_screenCamera);
 	ManageConditionalGameStateScreenRenders();
-	g_devConsole->Render(m_screenCamera);
-	g_renderer->EndCamera(*m_screenCamera);
+	if (m_devConsole != nullptr)
+	{
+		m_devConsole->Render(m_screenCamera);
+	}
+	m_renderer->EndCamera(*m_screenCamera);
 }
 
 void Game::EndFrame()
@@ -189,15 +219,45 @@ void Game::EndFrame()
 	DeleteGarbageEntities();
 }
 
+void Game::StepFrame(float deltaSeconds)
+{
+	if (m_isMatchOver)
+		return;
+
+	if (m_ownedRootClock != nullptr)
+	{
+		m_ownedRootClock->TickFixed((double)deltaSeconds);
+	}
+
+	BeginFrame();
+	Update();
+	EndFrame();
+}
+
+//Match Results
+//--------------------------------------------------------------------
+bool Game::IsMatchOver() const
+{
+	return m_isMatchOver;
+}
+
+int Game::GetCurrentWave() const
+{
+	return m_currentWave;
+}
+
 //Input
 //--------------------------------------------------------------------
 void Game::CheckKeyboardInputs()
 {
+	if (m_inputSystem == nullptr)
+		return;
+
 	if (m_inGameOverSequence)
 		return;
 
 	//Spacebar
-	if (g_inputSystem->WasKeyJustPressed(' '))
+	if (m_inputSystem->WasKeyJustPressed(' '))
 	{
 		if (m_inAttractMode)
 		{
@@ -244,7 +304,7 @@ void Game::CheckKeyboardInputs()
 	}
 
 	//N button
-	if (g_inputSystem->WasKeyJustPressed('N'))
+	if (m_inputSystem->WasKeyJustPressed('N'))
 	{
 		if (m_inAttractMode)
 		{
@@ -283,7 +343,7 @@ void Game::CheckKeyboardInputs()
 	}
 
 	//Up arrow
-	if (g_inputSystem->WasKeyJustPressed(KEYCODE_UPARROW))
+	if (m_inputSystem->WasKeyJustPressed(KEYCODE_UPARROW))
 	{
 		if (m_inAttractMode)
 		{
@@ -292,7 +352,7 @@ void Game::CheckKeyboardInputs()
 	}
 
 	//down arrow
-	if (g_inputSystem->WasKeyJustPressed(KEYCODE_DOWNARROW))
+	if (m_inputSystem->WasKeyJustPressed(KEYCODE_DOWNARROW))
 	{
 		if (m_inAttractMode)
 		{
@@ -301,11 +361,11 @@ void Game::CheckKeyboardInputs()
 	}
 
 	//Escape
-	if (g_inputSystem->WasKeyJustPressed(KEYCODE_ESC))
+	if (m_inputSystem->WasKeyJustPressed(KEYCODE_ESC))
 	{
-		if (m_inAttractMode)
+		if (m_inAttractMode && m_app != nullptr)
 		{
-			g_app->HandleQuitRequested();
+			m_app->HandleQuitRequested();
 		}
 
 		//Return to attract screen
@@ -316,14 +376,14 @@ void Game::CheckKeyboardInputs()
 	}
 
 	//Pause
-	if (g_inputSystem->WasKeyJustPressed('P') )
+	if (m_inputSystem->WasKeyJustPressed('P') )
 	{
 		m_isPaused = !m_isPaused;
 		m_clock->TogglePause();
 	}
 
 	//SloMo
-	if (g_inputSystem->WasKeyJustPressed('T'))
+	if (m_inputSystem->WasKeyJustPressed('T'))
 	{
 		m_clock->SetTimeScale(1.f);
 		m_isSlowMo = !m_isSlowMo;
@@ -332,19 +392,19 @@ void Game::CheckKeyboardInputs()
 	}
 
 	//Move one Frame
-	if (g_inputSystem->WasKeyJustPressed('O') )
+	if (m_inputSystem->WasKeyJustPressed('O') )
 	{
 		m_clock->StepSingleFrame();
 	}
 
 	//Toggle Debug
-	if (g_inputSystem->WasKeyJustPressed(KEYCODE_F1) ) //F1 key
+	if (m_inputSystem->WasKeyJustPressed(KEYCODE_F1) ) //F1 key
 	{
 		ToggleEntityDebugDraw();
 	}
 
 	//Restart Game
-	if (g_inputSystem->WasKeyJustPressed(KEYCODE_F8)) //F8 key
+	if (m_inputSystem->WasKeyJustPressed(KEYCODE_F8)) //F8 key
 	{
 		m_shouldRestart = true;
 	}
@@ -354,25 +414,25 @@ void Game::CheckKeyboardInputs()
 		return;
 		 
 	//Spawn Asteroid
-	if (g_inputSystem->WasKeyJustPressed('I'))
+	if (m_inputSystem->WasKeyJustPressed('I'))
 	{
 		SpawnAsteroid();
 	}
 
 	//Spawn Beetle
-	if (g_inputSystem->WasKeyJustPressed('B'))
+	if (m_inputSystem->WasKeyJustPressed('B'))
 	{
 		SpawnBeetle();
 	}
 
 	//Spawn Wasp
-	if (g_inputSystem->WasKeyJustPressed('V'))
+	if (m_inputSystem->WasKeyJustPressed('V'))
 	{
 		SpawnWasp();
 	}
 
 	//Clear Wave
-	if (g_inputSystem->WasKeyJustPressed('C'))
+	if (m_inputSystem->WasKeyJustPressed('C'))
 	{
 		ClearEnemyWave();
 	}
@@ -381,15 +441,18 @@ void Game::CheckKeyboardInputs()
 
 void Game::CheckControllerInputs()
 {
+	if (m_inputSystem == nullptr)
+		return;
+
 	if (m_inGameOverSequence)
 		return;
 
 	if (!m_inAttractMode && !m_inPlayerConnectionLobby && !m_inInstructionsScreen)
 		return;
 
-	for (int controllerNum = 0; controllerNum < MAX_NUM_PLAYERS; ++controllerNum)
+	for (int controllerNum = 0; controllerNum < MAX_NUM_LOCAL_PLAYERS; ++controllerNum)
 	{
-		XboxController currentController = g_inputSystem->GetController(controllerNum);
+		XboxController currentController = m_inputSystem->GetController(controllerNum);
 
 		//A button
 		if (currentController.WasButtonJustPressed(XboxButtonID::BUTTON_A))
@@ -535,16 +598,19 @@ void Game::RotateThroughAttractScreenButtons(bool const& downDirection)
 
 void Game::PrintControlsToDevConsole()
 {
-	g_devConsole->AddLine(Rgba8::YELLOW, "--Star Ship Controls--", 1.f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Navigate Menu - Arrow Keys", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Select - SPACEBAR", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Move - W and A", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Rotate - S and D", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Fire - SPACEBAR", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Pause - P", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "SlowMo - T", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Step - O", 0.75f, true);
-	g_devConsole->AddLine(DevConsole::INFO_MINOR, "Quit - ESC", 0.75f, true);
+	if (m_devConsole == nullptr)
+		return;
+
+	m_devConsole->AddLine(Rgba8::YELLOW, "--Star Ship Controls--", 1.f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Navigate Menu - Arrow Keys", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Select - SPACEBAR", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Move - W and A", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Rotate - S and D", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Fire - SPACEBAR", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Pause - P", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "SlowMo - T", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Step - O", 0.75f, true);
+	m_devConsole->AddLine(DevConsole::INFO_MINOR, "Quit - ESC", 0.75f, true);
 }
 
 void Game::AdjustTimeScale(float scale)
@@ -604,6 +670,22 @@ bool Game::Event_Restart(EventArgs& args)
 	return false;
 }
 
+bool Game::Event_LargeWorld(EventArgs& args)
+{
+	UNUSED(args);
+	if (m_game == nullptr)
+		return false;
+
+	if (!m_game->SetLargeWorldMode(!m_game->m_inLargeWorldMode))
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "LargeWorld can only be toggled from the attract screen");
+		return false;
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, m_game->m_inLargeWorldMode ? "Large world enabled" : "Large world disabled");
+	return true;
+}
+
 //Debug
 //--------------------------------------------------------------------
 void Game::ToggleEntityDebugDraw()
@@ -618,13 +700,14 @@ void Game::GoToPlayerConnectionLobby()
 	m_inAttractMode = false;
 	m_inPlayerConnectionLobby = true;
 
-	m_worldCamBottomLeft = Vec2(60.f, 30.f);
-	m_worldCamTopRight = Vec2(140.f, 70.f);
+	Vec2 worldCenter = m_worldBounds.GetCenterPos();
+	m_worldCamBottomLeft = worldCenter - Vec2(40.f, 20.f);
+	m_worldCamTopRight = worldCenter + Vec2(40.f, 20.f);
 }
 
 void Game::ConnectNewPlayer(int playerID)
 {
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_playerShips[playerNum] == nullptr)
 			continue;
@@ -633,6 +716,9 @@ void Game::ConnectNewPlayer(int playerID)
 			return;
 	}
 
+	if (m_numConnectedPlayers >= m_numPlayerSlots)
+		return;
+
 	//Create new ship and correctly assign it to array
 	m_playerShips[m_numConnectedPlayers] = 
 		new PlayerShip(this, m_playerSpawnLocations[m_numConnectedPlayers], m_playerSpawnRotation[m_numConnectedPlayers],
@@ -655,7 +741,7 @@ void Game::CheckIfAllPlayersReady()
 
 	int numReadyPlayers = 0;
 
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_readyPlayers[playerNum])
 		{
@@ -675,8 +761,16 @@ void Game::StartGame()
 	m_inAttractMode = false;
 	m_inPlayerConnectionLobby = false;
 
-	m_worldCamBottomLeft = Vec2(0.f, 0.f);
-	m_worldCamTopRight = Vec2(WORLD_SIZE_X, WORLD_SIZE_Y);
+	if (m_inLargeWorldMode)
+	{
+		FollowPlayersWithWorldCamera();
+	}
+
+	else
+	{
+		m_worldCamBottomLeft = Vec2(0.f, 0.f);
+		m_worldCamTopRight = Vec2(WORLD_SIZE_X, WORLD_SIZE_Y);
+	}
 
 	PlayGameSFX(StarShipSFX::ENTER_GAME);
 	StopGameMusic(StarShipMusic::ATTRACT_SCREEN_MUSIC);
@@ -684,7 +778,7 @@ void Game::StartGame()
 
 	SpawnNextEnemyWave();
 
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_playerShips[playerNum] == nullptr)
 			continue;
@@ -693,6 +787,20 @@ void Game::StartGame()
 	}
 }
 
+void Game::StartBotMatch(int numBots, bool coOpMode)
+{
+	numBots = GetClampedInt(numBots, 1, m_numPlayerSlots);
+	m_inMultiplayerMode = numBots > 1;
+	m_inCoOpMode = coOpMode;
+
+	for (int botNum = 0; botNum < numBots; ++botNum)
+	{
+		ConnectNewPlayer(FIRST_BOT_PLAYER_ID + botNum);
+	}
+
+	StartGame();
+}
+
 void Game::UpdateAttractScreen(float deltaSeconds)
 {
 	m_attractScreenInfo.rightShipPos.y -= m_attractScreenInfo.rightShipSpeed * deltaSeconds;
@@ -701,15 +809,15 @@ void Game::UpdateAttractScreen(float deltaSeconds)
 	if (m_attractScreenInfo.rightShipPos.y < 0.f - m_attractScreenInfo.shipRadius)
 	{
 		m_attractScreenInfo.rightShipPos.y = SCREEN_SIZE_Y + m_attractScreenInfo.shipRadius;
-		m_attractScreenInfo.rightShipColor = m_playerColors[g_rng->RollRandomIntInRange(0, MAX_NUM_PLAYERS - 1)];
-		m_attractScreenInfo.rightShipSpeed = g_rng->RollRandomFloatInRange(100.f, 300.f);
+		m_attractScreenInfo.rightShipColor = m_playerColors[m_rng.RollRandomIntInRange(0, GetNumHUDPlayers() - 1)];
+		m_attractScreenInfo.rightShipSpeed = m_rng.RollRandomFloatInRange(100.f, 300.f);
 	}
 
 	if (m_attractScreenInfo.leftShipPos.y < 0.f - m_attractScreenInfo.shipRadius)
 	{
 		m_attractScreenInfo.leftShipPos.y = SCREEN_SIZE_Y + m_attractScreenInfo.shipRadius;
-		m_attractScreenInfo.leftShipColor = m_playerColors[g_rng->RollRandomIntInRange(0, MAX_NUM_PLAYERS - 1)];
-		m_attractScreenInfo.rightShipSpeed = g_rng->RollRandomFloatInRange(100.f, 300.f);
+		m_attractScreenInfo.leftShipColor = m_playerColors[m_rng.RollRandomIntInRange(0, GetNumHUDPlayers() - 1)];
+		m_attractScreenInfo.rightShipSpeed = m_rng.RollRandomFloatInRange(100.f, 300.f);
 	}
 }
 
@@ -719,7 +827,7 @@ void Game::GameOver(int const& playerNum, bool const& gameWon)
 	m_inGameOverSequence = true;
 
 	//#TODO: fix bug where time reverses
-	m_gameOverTimer = new Timer(GAME_OVER_SEQUENCE_DURATION, &Clock::GetSystemClock());
+	m_gameOverTimer = new Timer(GAME_OVER_SEQUENCE_DURATION, m_parentClock);
 	m_gameOverTimer->Start();
 
 	StopGameMusic(m_gameMusic);
@@ -730,6 +838,11 @@ void Game::GameOver(int const& playerNum, bool const& gameWon)
 //--------------------------------------------------------------------
 void Game::UpdateCameras(float deltaSeconds)
 {
+	if (m_inLargeWorldMode && m_inGameplay)
+	{
+		FollowPlayersWithWorldCamera();
+	}
+
 	if (!m_inScreenShake)
 	{
 		m_worldCamera->SetOrthoView(m_worldCamBottomLeft, m_worldCamTopRight);
@@ -738,7 +851,7 @@ void Game::UpdateCameras(float deltaSeconds)
 	
 	float currentTrauma = Lerp(m_screenShakeTrauma, 0.f, GetFractionWithinRange(m_screenShakeElapsedTime, 0.f, m_screenShakeDuration));
 	float screenShake = currentTrauma * currentTrauma;
-	float screenOffset = g_rng->RollRandomFloatInRange(-screenShake, screenShake);
+	float screenOffset = m_rng.RollRandomFloatInRange(-screenShake, screenShake);
 	
 	m_screenShakeElapsedTime += deltaSeconds;
 	if (m_screenShakeElapsedTime >= m_screenShakeDuration)
@@ -747,7 +860,35 @@ void Game::UpdateCameras(float deltaSeconds)
 		m_screenShakeElapsedTime = 0.f;
 	}
 
-	m_worldCamera->SetOrthoView(Vec2(0.f, 0.f), Vec2((WORLD_SIZE_X + screenOffset), (WORLD_SIZE_Y + screenOffset)));
+	m_worldCamera->SetOrthoView(m_worldCamBottomLeft, m_worldCamTopRight + Vec2(screenOffset, screenOffset));
+}
+
+void Game::FollowPlayersWithWorldCamera()
+{
+	//center on the average position of all connected players
+	Vec2 playersCenter;
+	int numPlayers = 0;
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
+	{
+		if (m_playerShips[playerNum] == nullptr)
+			continue;
+
+		playersCenter += m_playerShips[playerNum]->m_position;
+		numPlayers++;
+	}
+
+	if (numPlayers == 0)
+		return;
+
+	playersCenter /= static_cast<float>(numPlayers);
+
+	//keep the view inside the world
+	Vec2 halfViewSize(WORLD_SIZE_X * 0.5f, WORLD_SIZE_Y * 0.5f);
+	playersCenter.x = GetClamped(playersCenter.x, m_worldBounds.m_mins.x + halfViewSize.x, m_worldBounds.m_maxs.x - halfViewSize.x);
+	playersCenter.y = GetClamped(playersCenter.y, m_worldBounds.m_mins.y + halfViewSize.y, m_worldBounds.m_maxs.y - halfViewSize.y);
+
+	m_worldCamBottomLeft = playersCenter - halfViewSize;
+	m_worldCamTopRight = playersCenter + halfViewSize;
 }
 
 void Game::StartScreenShake(float duration, float shakeTrauma)
@@ -760,17 +901,54 @@ void Game::StartScreenShake(float duration, float shakeTrauma)
 
 //Initialization
 //--------------------------------------------------------------------
+void Game::InitWorldBounds()
+{
+	if (m_inLargeWorldMode)
+	{
+		m_worldBounds = AABB2(0.f, 0.f, LARGE_WORLD_SIZE_X, LARGE_WORLD_SIZE_Y);
+	}
+
+	else
+	{
+		m_worldBounds = AABB2(0.f, 0.f, WORLD_SIZE_X, WORLD_SIZE_Y);
+	}
+
+	m_worldChunks.Initialize(m_worldBounds, WORLD_CHUNK_SIZE);
+	m_collisionGrid.Initialize(m_worldBounds, COLLISION_GRID_CELL_SIZE, COLLISION_MAX_ENTITY_RADIUS);
+}
+
 void Game::InitPlayerData()
 {
-	m_playerSpawnLocations[0] = Vec2(80.f, 60.f);
-	m_playerSpawnLocations[1] = Vec2(120.f, 40.f);
-	m_playerSpawnLocations[2] = Vec2(80.f, 40.f);
-	m_playerSpawnLocations[3] = Vec2(120.f, 60.f);
+	m_playerShips.resize(m_numPlayerSlots, nullptr);
+	m_numExtraLives.resize(m_numPlayerSlots, 0);
+	m_readyPlayers.resize(m_numPlayerSlots, false);
+	m_playerSpawnLocations.resize(m_numPlayerSlots);
+	m_playerSpawnRotation.resize(m_numPlayerSlots);
+	m_playerColors.resize(m_numPlayerSlots);
 
-	m_playerColors[0] = Rgba8(102, 153, 204, 255);
-	m_playerColors[1] = Rgba8(255, 0, 0, 255);
-	m_playerColors[2] = Rgba8(128, 255, 0, 255);
-	m_playerColors[3] = Rgba8(204, 0, 204, 255);
+	//spawn around the middle of the world
+	Vec2 worldCenter = m_worldBounds.GetCenterPos();
+	Vec2 localSpawnOffsets[MAX_NUM_LOCAL_PLAYERS] = { Vec2(-20.f, 10.f), Vec2(20.f, -10.f), Vec2(-20.f, -10.f), Vec2(20.f, 10.f) };
+	float localSpawnRotations[MAX_NUM_LOCAL_PLAYERS] = { -45.f, 135.f, 45.f, 225.f };
+	Rgba8 localPlayerColors[MAX_NUM_LOCAL_PLAYERS] = { Rgba8(102, 153, 204, 255), Rgba8(255, 0, 0, 255), Rgba8(128, 255, 0, 255), Rgba8(204, 0, 204, 255) };
+
+	//extra players are spread on a ring around the local spawns, facing outward
+	int numExtraPlayers = m_numPlayerSlots - MAX_NUM_LOCAL_PLAYERS;
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
+	{
+		if (playerNum < MAX_NUM_LOCAL_PLAYERS)
+		{
+			m_playerSpawnLocations[playerNum] = worldCenter + localSpawnOffsets[playerNum];
+			m_playerSpawnRotation[playerNum] = localSpawnRotations[playerNum];
+			m_playerColors[playerNum] = localPlayerColors[playerNum];
+			continue;
+		}
+
+		float spawnDegrees = 360.f * static_cast<float>(playerNum - MAX_NUM_LOCAL_PLAYERS) / static_cast<float>(numExtraPlayers);
+		m_playerSpawnLocations[playerNum] = worldCenter + Vec2::MakeFromPolarDegrees(spawnDegrees, EXTRA_PLAYER_SPAWN_RING_RADIUS);
+		m_playerSpawnRotation[playerNum] = spawnDegrees;
+		m_playerColors[playerNum] = Rgba8::GetRandomColor(&m_rng);
+	}
 
 	m_playerLivesScreenLocation[0] = Vec2(50.f, SCREEN_SIZE_Y - 50.f); //top left
 	m_playerLivesScreenLocation[1] = Vec2(SCREEN_SIZE_X - 50.f, 50.f); //bottom right
@@ -808,14 +986,28 @@ void Game::InitEnemyWaveData()
 
 void Game::InitStarLocations()
 {
-	for (int starNum = 0; starNum < MAX_STARS; ++starNum)
+	for (int starNum = 0; starNum < static_cast<int>(m_stars.size()); ++starNum)
+	{
+		delete(m_stars[starNum]);
+	}
+	m_stars.clear();
+	m_worldChunks.ClearStaticEntities();
+
+	//keep the same star density however big the world is
+	float worldAreaScale = (m_worldBounds.GetWidth() * m_worldBounds.GetHeight()) / (WORLD_SIZE_X * WORLD_SIZE_Y);
+	int numStars = RoundDownToInt(static_cast<float>(MAX_STARS) * worldAreaScale);
+	m_stars.reserve(numStars);
+
+	for (int starNum = 0; starNum < numStars; ++starNum)
 	{
 		Vec2 randPos;
-		randPos.x = g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_X);
-		randPos.y = g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_Y);
+		randPos.x = m_rng.RollRandomFloatInRange(m_worldBounds.m_mins.x, m_worldBounds.m_maxs.x);
+		randPos.y = m_rng.RollRandomFloatInRange(m_worldBounds.m_mins.y, m_worldBounds.m_maxs.y);
 
-		float randScale = g_rng->RollRandomFloatInRange(.25f, 1.5f);
-		m_stars[starNum] = new Star(this, randPos, 0.f, randScale);
+		float randScale = m_rng.RollRandomFloatInRange(.25f, 1.5f);
+		Star* newStar = new Star(this, randPos, 0.f, randScale);
+		m_stars.push_back(newStar);
+		m_worldChunks.AddStaticEntity(newStar);
 	}
 }
 
@@ -853,8 +1045,8 @@ void Game::InitAttractScreen()
 	m_attractScreenInfo.rightShipPos = Vec2(SCREEN_CENTER_X + 650.f, SCREEN_CENTER_Y);
 	m_attractScreenInfo.leftShipPos = Vec2(SCREEN_CENTER_X - 650.f, SCREEN_CENTER_Y);
 
-	m_attractScreenInfo.rightShipColor = m_playerColors[g_rng->RollRandomIntInRange(0, MAX_NUM_PLAYERS)];
-	m_attractScreenInfo.leftShipColor = m_playerColors[g_rng->RollRandomIntInRange(0, MAX_NUM_PLAYERS)];
+	m_attractScreenInfo.rightShipColor = m_playerColors[m_rng.RollRandomIntInRange(0, GetNumHUDPlayers() - 1)];
+	m_attractScreenInfo.leftShipColor = m_playerColors[m_rng.RollRandomIntInRange(0, GetNumHUDPlayers() - 1)];
 }
 
 void Game::InitGameOverScreen(int const& winningPlayerNum, bool const& gameWon)
@@ -878,22 +1070,25 @@ void Game::InitGameOverScreen(int const& winningPlayerNum, bool const& gameWon)
 
 void Game::LoadAllAudioAssets() const
 {
+	if (m_audioSystem == nullptr)
+		return;
+
 	//Music tracks
-	g_audioSystem->CreateOrGetSound("Data/Audio/Music/AttractScreenMusic.mp3");
-	g_audioSystem->CreateOrGetSound("Data/Audio/Music/GameMusic.mp3");
-	g_audioSystem->CreateOrGetSound("Data/Audio/Music/PlayerShipEngineThrust.wav");
+	m_audioSystem->CreateOrGetSound("Data/Audio/Music/AttractScreenMusic.mp3");
+	m_audioSystem->CreateOrGetSound("Data/Audio/Music/GameMusic.mp3");
+	m_audioSystem->CreateOrGetSound("Data/Audio/Music/PlayerShipEngineThrust.wav");
 
 	//SFX
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnterGame.mp3");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/FireBullet.wav");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDeath.wav");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerRespawn.mp3");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDeath.wav");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewEnemyWave.mp3");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidHit.mp3");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidBroken.wav");
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PowerUp.wav");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnterGame.mp3");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/FireBullet.wav");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDeath.wav");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerRespawn.mp3");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDeath.wav");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewEnemyWave.mp3");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidHit.mp3");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidBroken.wav");
+	m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PowerUp.wav");
 
 
 }
@@ -940,7 +1135,14 @@ void Game::ManageConditionalGameStateUpdates()
 
 	if (m_shouldRestart)
 	{
-		g_app->RestartGame();
+		//without an app to restart us the match simply ends and the owner decides what to do next
+		if (m_app == nullptr)
+		{
+			m_isMatchOver = true;
+			return;
+		}
+
+		m_app->RestartGame();
 		return;
 	}
 }
@@ -948,7 +1150,7 @@ void Game::ManageConditionalGameStateUpdates()
 void Game::UpdatePlayers(float deltaSeconds)
 {
 	//Player Ships
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_playerShips[playerNum] != nullptr)
 		{
@@ -959,48 +1161,61 @@ void Game::UpdatePlayers(float deltaSeconds)
 
 void Game::UpdateNonPlayerEntities(float deltaSeconds)
 {
-	//Stars
-	for (int starNum = 0; starNum < MAX_STARS; ++starNum)
+	UpdateSimulationLOD();
+	float entityDeltaSeconds = 0.f;
+
+	//Stars, only the ones in active chunks twinkle
+	std::vector<int> const& activeChunkIndexes = m_worldChunks.GetActiveChunkIndexes();
+	for (int activeNum = 0; activeNum < static_cast<int>(activeChunkIndexes.size()); ++activeNum)
 	{
-		if (m_stars[starNum] != nullptr)
+		std::vector<Entity*> const& chunkStars = m_worldChunks.GetStaticEntitiesInChunk(activeChunkIndexes[activeNum]);
+		for (int starNum = 0; starNum < static_cast<int>(chunkStars.size()); ++starNum)
 		{
-			m_stars[starNum]->Update(deltaSeconds);
+			chunkStars[starNum]->Update(deltaSeconds);
 		}
 	}
 
 	//PowerUps
 	for (int powerUpNum = 0; powerUpNum < MAX_POWERUPS; ++powerUpNum)
 	{
-		if (m_powerUps[powerUpNum] == nullptr)
+		if (m_powerUps[powerUpNum] == nullptr || !ShouldEntityUpdateThisFrame(m_powerUps[powerUpNum], powerUpNum, deltaSeconds, entityDeltaSeconds))
 			continue;
 
-		m_powerUps[powerUpNum]->Update(deltaSeconds);
+		m_powerUps[powerUpNum]->Update(entityDeltaSeconds);
 	}
 
 	//Bullets
 	for (int bulletNum = 0; bulletNum < MAX_BULLETS; ++bulletNum)
 	{
-		if (m_bullets[bulletNum] != nullptr)
+		if (m_bullets[bulletNum] == nullptr)
+			continue;
+
+		if (m_bullets[bulletNum]->m_isDormant)
+		{
+			m_bullets[bulletNum]->UpdateDormant(deltaSeconds);
+		}
+
+		else if (ShouldEntityUpdateThisFrame(m_bullets[bulletNum], bulletNum, deltaSeconds, entityDeltaSeconds))
 		{
-			m_bullets[bulletNum]->Update(deltaSeconds);
+			m_bullets[bulletNum]->Update(entityDeltaSeconds);
 		}
 	}
 
 	//Asteroids
 	for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
 	{
-		if (m_asteroids[asteroidNum] != nullptr)
+		if (m_asteroids[asteroidNum] != nullptr && ShouldEntityUpdateThisFrame(m_asteroids[asteroidNum], asteroidNum, deltaSeconds, entityDeltaSeconds))
 		{
-			m_asteroids[asteroidNum]->Update(deltaSeconds);
+			m_asteroids[asteroidNum]->Update(entityDeltaSeconds);
 		}
 	}
 
 	//Debris
 	for (int debrisNum = 0; debrisNum < MAX_DEBRIS; ++debrisNum)
 	{
-		if (m_debris[debrisNum] != nullptr)
+		if (m_debris[debrisNum] != nullptr && ShouldEntityUpdateThisFrame(m_debris[debrisNum], debrisNum, deltaSeconds, entityDeltaSeconds))
 		{
-			m_debris[debrisNum]->Update(deltaSeconds);
+			m_debris[debrisNum]->Update(entityDeltaSeconds);
 		}
 	}
 
@@ -1011,7 +1226,10 @@ void Game::UpdateNonPlayerEntities(float deltaSeconds)
 	{
 		if (m_beetles[beatleNum] != nullptr)
 		{
-			m_beetles[beatleNum]->Update(deltaSeconds);
+			if (ShouldEntityUpdateThisFrame(m_beetles[beatleNum], beatleNum, deltaSeconds, entityDeltaSeconds))
+			{
+				m_beetles[beatleNum]->Update(entityDeltaSeconds);
+			}
 			numActiveEnemies++;
 		}
 	}
@@ -1020,7 +1238,10 @@ void Game::UpdateNonPlayerEntities(float deltaSeconds)
 	{
 		if (m_wasps[waspNum] != nullptr)
 		{
-			m_wasps[waspNum]->Update(deltaSeconds);
+			if (ShouldEntityUpdateThisFrame(m_wasps[waspNum], waspNum, deltaSeconds, entityDeltaSeconds))
+			{
+				m_wasps[waspNum]->Update(entityDeltaSeconds);
+			}
 			numActiveEnemies++;
 		}
 	}
@@ -1081,163 +1302,182 @@ void Game::ManageConditionalGameStateScreenRenders() const
 
 void Game::RenderAttractScreen() const
 {
-	g_renderer->BindTexture(nullptr);
+	m_renderer->BindTexture(nullptr);
 	//Left ship
 	Vertex_PCU leftShipVerts[NUM_PLAYERSHIP_VERTS];
 	PlayerShip::InitializeLocalVerts(&leftShipVerts[0], m_attractScreenInfo.leftShipColor);
 
 	TransformVertexArrayXY3D(NUM_PLAYERSHIP_VERTS, leftShipVerts, 40.f, -90.f, m_attractScreenInfo.leftShipPos);
-	g_renderer->DrawVertexArray(NUM_PLAYERSHIP_VERTS, &leftShipVerts[0]);
+	m_renderer->DrawVertexArray(NUM_PLAYERSHIP_VERTS, &leftShipVerts[0]);
 
 	//right ship
 	Vertex_PCU rightShipVerts[NUM_PLAYERSHIP_VERTS];
 	PlayerShip::InitializeLocalVerts(&rightShipVerts[0], m_attractScreenInfo.rightShipColor);
 
 	TransformVertexArrayXY3D(NUM_PLAYERSHIP_VERTS, rightShipVerts, 40.f, -90.f, m_attractScreenInfo.rightShipPos);
-	g_renderer->DrawVertexArray(NUM_PLAYERSHIP_VERTS, &rightShipVerts[0]);
+	m_renderer->DrawVertexArray(NUM_PLAYERSHIP_VERTS, &rightShipVerts[0]);
 
-	std::vector<Vertex_PCU> textVerts;
-	float textOffset = GetSimpleTriangleStringWidth("Star Ship Gold", 100.f);
-	textOffset *= 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "Star Ship Gold", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 200.f), 100.f, Rgba8(243, 246, 0, 255));
-
-
-	//Render all Buttons
-	Rgba8 color;
-	AABB2 bounds;
-	Vec2 startPos;
-	Vec2 endPos;
-	std::string text;
-	for (int buttonNum = 0; buttonNum < NUM_ATTRACT_BUTTONS; ++buttonNum)
+	//title and buttons only change when the selected button does
+	unsigned long long stateKey = HashWidgetState(WIDGET_STATE_KEY_SEED, static_cast<int>(m_selectedAttractScreenButton));
+	if (m_attractScreenWidget.NeedsRebuild(stateKey))
 	{
-		Button currentButton = m_attractScreenInfo.buttons[buttonNum];
-		bounds = currentButton.buttonBounds;
-		startPos = Vec2(bounds.m_mins.x, Lerp(bounds.m_mins.y, bounds.m_maxs.y, 0.5f));
-		endPos = Vec2(bounds.m_maxs.x, startPos.y);
+		Verts& verts = m_attractScreenWidget.BeginRebuild(stateKey);
 
-		color = m_attractScreenInfo.defaultButtonColor;
-		if (currentButton.buttonType == m_selectedAttractScreenButton)
+		//Button bars
+		for (int buttonNum = 0; buttonNum < NUM_ATTRACT_BUTTONS; ++buttonNum)
 		{
-			color = m_attractScreenInfo.selectedButtonColor;
+			Button const& currentButton = m_attractScreenInfo.buttons[buttonNum];
+			AABB2 const& bounds = currentButton.buttonBounds;
+			Vec2 startPos = Vec2(bounds.m_mins.x, Lerp(bounds.m_mins.y, bounds.m_maxs.y, 0.5f));
+			Vec2 endPos = Vec2(bounds.m_maxs.x, startPos.y);
+
+			Rgba8 color = m_attractScreenInfo.defaultButtonColor;
+			if (currentButton.buttonType == m_selectedAttractScreenButton)
+			{
+				color = m_attractScreenInfo.selectedButtonColor;
+			}
+			AddVertsForDebugLine2D(verts, startPos, endPos, bounds.m_maxs.y - bounds.m_mins.y, color);
 		}
-		DebugDrawLine2D(startPos, endPos, bounds.m_maxs.y - bounds.m_mins.y, color);
-		text = currentButton.buttonText;
 
-		AddVertsForTextTriangles2D(textVerts, text, currentButton.textPos, currentButton.textCellSize, currentButton.textColor);
+		//Text
+		float textOffset = GetSimpleTriangleStringWidth("Star Ship Gold", 100.f);
+		textOffset *= 0.5f;
+		AddVertsForTextTriangles2D(verts, "Star Ship Gold", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 200.f), 100.f, Rgba8(243, 246, 0, 255));
+		for (int buttonNum = 0; buttonNum < NUM_ATTRACT_BUTTONS; ++buttonNum)
+		{
+			Button const& currentButton = m_attractScreenInfo.buttons[buttonNum];
+			AddVertsForTextTriangles2D(verts, currentButton.buttonText, currentButton.textPos, currentButton.textCellSize, currentButton.textColor);
+		}
 
+		m_attractScreenWidget.EndRebuild(*m_renderer);
 	}
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(textVerts);
 
+	m_attractScreenWidget.Render(*m_renderer);
 }
 
 void Game::RenderPlayerConnectionLobby() const
 {
-	//Vertical line
-	DebugDrawLine2D(Vec2(SCREEN_CENTER_X, 0.f), Vec2(SCREEN_CENTER_X, SCREEN_SIZE_Y), 5.f, Rgba8(255, 255, 255, 50));
-	//horizontal line
-	DebugDrawLine2D(Vec2(0.f, SCREEN_CENTER_Y), Vec2(SCREEN_SIZE_X, SCREEN_CENTER_Y), 5.f, Rgba8(255, 255, 255, 50));
-
-	std::vector<Vertex_PCU> textVerts;
+	unsigned long long stateKey = WIDGET_STATE_KEY_SEED;
+	for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
+	{
+		stateKey = HashWidgetState(stateKey, m_playerShips[playerNum] != nullptr);
+		stateKey = HashWidgetState(stateKey, m_readyPlayers[playerNum]);
+	}
 
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	if (m_playerConnectionLobbyWidget.NeedsRebuild(stateKey))
 	{
-		Vec2 textPos = Vec2(400.f, 600.f);
+		Verts& verts = m_playerConnectionLobbyWidget.BeginRebuild(stateKey);
 
-		Rgba8 color = Rgba8(255, 0, 255, 255);
-		switch (playerNum)
-		{
-		case 0:
-			textPos = Vec2(400.f, 600.f);
-			break;
-		case 1:
-			textPos = Vec2(1200.f, 200.f);
-			break;
-		case 2:
-			textPos = Vec2(400.f, 200.f);
-			break;
-		case 3:
-			textPos = Vec2(1200.f, 600.f);
-		}
+		//Vertical line
+		AddVertsForDebugLine2D(verts, Vec2(SCREEN_CENTER_X, 0.f), Vec2(SCREEN_CENTER_X, SCREEN_SIZE_Y), 5.f, Rgba8(255, 255, 255, 50));
+		//horizontal line
+		AddVertsForDebugLine2D(verts, Vec2(0.f, SCREEN_CENTER_Y), Vec2(SCREEN_SIZE_X, SCREEN_CENTER_Y), 5.f, Rgba8(255, 255, 255, 50));
 
-		std::string text = " ";
-		if (m_playerShips[playerNum] == nullptr)
+		for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
 		{
-			text = "Press Start or N to Connect";
-			color = m_standardBodyTextColor;
-		}
+			Vec2 textPos = Vec2(400.f, 600.f);
 
-		else if (!m_readyPlayers[playerNum])
-		{
-			text = "Press A or SPACEBAR to Ready Up";
-			color = m_standardBodyTextColor;
-			textPos.y -= 200.f;
-		}
+			Rgba8 color = Rgba8(255, 0, 255, 255);
+			switch (playerNum)
+			{
+			case 0:
+				textPos = Vec2(400.f, 600.f);
+				break;
+			case 1:
+				textPos = Vec2(1200.f, 200.f);
+				break;
+			case 2:
+				textPos = Vec2(400.f, 200.f);
+				break;
+			case 3:
+				textPos = Vec2(1200.f, 600.f);
+			}
 
-		else
-		{
-			text = "Ready";
-			color = Rgba8(0, 255, 29, 255);
-			textPos.y -= 200.f;
+			std::string text = " ";
+			if (m_playerShips[playerNum] == nullptr)
+			{
+				text = "Press Start or N to Connect";
+				color = m_standardBodyTextColor;
+			}
+
+			else if (!m_readyPlayers[playerNum])
+			{
+				text = "Press A or SPACEBAR to Ready Up";
+				color = m_standardBodyTextColor;
+				textPos.y -= 200.f;
+			}
+
+			else
+			{
+				text = "Ready";
+				color = Rgba8(0, 255, 29, 255);
+				textPos.y -= 200.f;
+			}
+
+			float textOffset = GetSimpleTriangleStringWidth(text, 30.f) * 0.5f;
+			textPos.x -= textOffset;
+			AddVertsForTextTriangles2D(verts, text, textPos, 30.f, color);
 		}
 
-		float textOffset = GetSimpleTriangleStringWidth(text, 30.f) * 0.5f;
-		textPos.x -= textOffset;
-		AddVertsForTextTriangles2D(textVerts, text, textPos, 30.f, color);
+		m_playerConnectionLobbyWidget.EndRebuild(*m_renderer);
 	}
 
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(textVerts);
+	m_playerConnectionLobbyWidget.Render(*m_renderer);
 }
 
 void Game::RenderInstructionsScreen() const
 {
-	std::vector<Vertex_PCU> textVerts;
-	Rgba8 color = m_standardBodyTextColor;
-	float textOffset = GetSimpleTriangleStringWidth("How to Play", 50.f) * 0.5f;
-
-	AddVertsForTextTriangles2D(textVerts, "How To Play", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 75.f), 50.f, Rgba8(243, 246, 0, 255));
-
-	//Keyboard instructions
-	textOffset = GetSimpleTriangleStringWidth("Keyboard Controls", 30.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "Keyboard Controls", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 150.f), 30.f, Rgba8(102, 153, 204, 255));
-	textOffset = GetSimpleTriangleStringWidth("W to Move", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "W to Move", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 190.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("A and S to Rotate", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "A and S to Rotate", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 230.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("SPACEBAR to Shoot", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "SPACEBAR to Shoot", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 270.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("N to Respawn", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "N to Respawn", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 310.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("P To Pause", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "P To Pause", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 350.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("ESC To Exit", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "ESC To Exit", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 390.f), 20.f, color);
-
-	//controller instructions;
-	textOffset = GetSimpleTriangleStringWidth("Xbox Controls", 30.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "Xbox Controls", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 490.f), 30.f, Rgba8(255, 0, 0, 255));
-	textOffset = GetSimpleTriangleStringWidth("Right Stick to Move", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "Right Stick to Move", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 530.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("Left Stick to Rotate", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "Left Stick to Rotate", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 570.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("A button or Right Trigger to Shoot", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "A button or Right Trigger to Shoot", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 610.f), 20.f, color);
-	textOffset = GetSimpleTriangleStringWidth("START to Respawn", 20.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, "START to Respawn", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 650.f), 20.f, color);
-	
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(textVerts);
-
-
+	//static text, built once
+	if (m_instructionsScreenWidget.NeedsRebuild(WIDGET_STATE_KEY_SEED))
+	{
+		Verts& textVerts = m_instructionsScreenWidget.BeginRebuild(WIDGET_STATE_KEY_SEED);
+		Rgba8 color = m_standardBodyTextColor;
+		float textOffset = GetSimpleTriangleStringWidth("How to Play", 50.f) * 0.5f;
+
+		AddVertsForTextTriangles2D(textVerts, "How To Play", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 75.f), 50.f, Rgba8(243, 246, 0, 255));
+
+		//Keyboard instructions
+		textOffset = GetSimpleTriangleStringWidth("Keyboard Controls", 30.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "Keyboard Controls", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 150.f), 30.f, Rgba8(102, 153, 204, 255));
+		textOffset = GetSimpleTriangleStringWidth("W to Move", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "W to Move", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 190.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("A and S to Rotate", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "A and S to Rotate", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 230.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("SPACEBAR to Shoot", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "SPACEBAR to Shoot", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 270.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("N to Respawn", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "N to Respawn", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 310.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("P To Pause", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "P To Pause", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 350.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("ESC To Exit", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "ESC To Exit", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 390.f), 20.f, color);
+
+		//controller instructions;
+		textOffset = GetSimpleTriangleStringWidth("Xbox Controls", 30.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "Xbox Controls", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 490.f), 30.f, Rgba8(255, 0, 0, 255));
+		textOffset = GetSimpleTriangleStringWidth("Right Stick to Move", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "Right Stick to Move", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 530.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("Left Stick to Rotate", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "Left Stick to Rotate", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 570.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("A button or Right Trigger to Shoot", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "A button or Right Trigger to Shoot", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 610.f), 20.f, color);
+		textOffset = GetSimpleTriangleStringWidth("START to Respawn", 20.f) * 0.5f;
+		AddVertsForTextTriangles2D(textVerts, "START to Respawn", Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 650.f), 20.f, color);
+
+		m_instructionsScreenWidget.EndRebuild(*m_renderer);
+	}
+
+	m_instructionsScreenWidget.Render(*m_renderer);
 }
 
 void Game::RenderPlayers() const
 {
+	AABB2 cameraBounds(m_worldCamera->GetOrthoBottomLeft(), m_worldCamera->GetOrthoTopRight());
+
 	//Player Ship
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
-		if (m_playerShips[playerNum] != nullptr)
+		if (m_playerShips[playerNum] != nullptr && m_playerShips[playerNum]->IsVisibleInBounds(cameraBounds))
 		{
 			m_playerShips[playerNum]->Render();
 		}
@@ -1246,20 +1486,28 @@ void Game::RenderPlayers() const
 
 void Game::RenderAllEntities() const
 {
-	g_renderer->BindTexture(nullptr);
-	//Stars
-	for (int starNum = 0; starNum < MAX_STARS; ++starNum)
+	m_renderer->BindTexture(nullptr);
+	AABB2 cameraBounds(m_worldCamera->GetOrthoBottomLeft(), m_worldCamera->GetOrthoTopRight());
+
+	//Stars, only chunks under the camera are visited
+	std::vector<int> visibleChunkIndexes;
+	m_worldChunks.GetChunkIndexesOverlappingBounds(cameraBounds, visibleChunkIndexes);
+	for (int visibleNum = 0; visibleNum < static_cast<int>(visibleChunkIndexes.size()); ++visibleNum)
 	{
-		if (m_stars[starNum] != nullptr)
+		std::vector<Entity*> const& chunkStars = m_worldChunks.GetStaticEntitiesInChunk(visibleChunkIndexes[visibleNum]);
+		for (int starNum = 0; starNum < static_cast<int>(chunkStars.size()); ++starNum)
 		{
-			m_stars[starNum]->Render();
+			if (chunkStars[starNum]->IsVisibleInBounds(cameraBounds))
+			{
+				chunkStars[starNum]->Render();
+			}
 		}
 	}
 
 	//PowerUps
 	for (int powerUpNum = 0; powerUpNum < MAX_POWERUPS; ++powerUpNum)
 	{
-		if (m_powerUps[powerUpNum] == nullptr)
+		if (m_powerUps[powerUpNum] == nullptr || !m_powerUps[powerUpNum]->IsVisibleInBounds(cameraBounds))
 			continue;
 
 		m_powerUps[powerUpNum]->Render();
@@ -1270,7 +1518,7 @@ void Game::RenderAllEntities() const
 	//Debris
 	for (int debrisNum = 0; debrisNum < MAX_DEBRIS; ++debrisNum)
 	{
-		if (m_debris[debrisNum] != nullptr)
+		if (m_debris[debrisNum] != nullptr && m_debris[debrisNum]->IsVisibleInBounds(cameraBounds))
 		{
 			m_debris[debrisNum]->Render();
 		}
@@ -1279,7 +1527,7 @@ void Game::RenderAllEntities() const
 	//Bullets
 	for (int bulletNum = 0; bulletNum < MAX_BULLETS; ++bulletNum)
 	{
-		if (m_bullets[bulletNum] != nullptr)
+		if (m_bullets[bulletNum] != nullptr && m_bullets[bulletNum]->IsVisibleInBounds(cameraBounds))
 		{
 			m_bullets[bulletNum]->Render();
 		}
@@ -1288,7 +1536,7 @@ void Game::RenderAllEntities() const
 	//Asteroids
 	for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
 	{
-		if (m_asteroids[asteroidNum] != nullptr)
+		if (m_asteroids[asteroidNum] != nullptr && m_asteroids[asteroidNum]->IsVisibleInBounds(cameraBounds))
 		{
 			m_asteroids[asteroidNum]->Render();
 		}
@@ -1297,7 +1545,7 @@ void Game::RenderAllEntities() const
 	//Beatles
 	for (int beatleNum = 0; beatleNum < MAX_BEETLES; ++beatleNum)
 	{
-		if (m_beetles[beatleNum] != nullptr)
+		if (m_beetles[beatleNum] != nullptr && m_beetles[beatleNum]->IsVisibleInBounds(cameraBounds))
 		{
 			m_beetles[beatleNum]->Render();
 		}
@@ -1306,7 +1554,7 @@ void Game::RenderAllEntities() const
 	//Wasps
 	for (int waspNum = 0; waspNum < MAX_WASPS; ++waspNum)
 	{
-		if (m_wasps[waspNum] != nullptr)
+		if (m_wasps[waspNum] != nullptr && m_wasps[waspNum]->IsVisibleInBounds(cameraBounds))
 		{
 			m_wasps[waspNum]->Render();
 		}
@@ -1316,114 +1564,180 @@ void Game::RenderAllEntities() const
 
 void Game::RenderPlayerLives() const
 {
-	Vec2 fwrdVector = Vec2::MakeFromPolarDegrees(90.f, 1.f);
-	fwrdVector *= 7.5f; //increases scale
+	unsigned long long stateKey = WIDGET_STATE_KEY_SEED;
+	for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
+	{
+		stateKey = HashWidgetState(stateKey, m_playerShips[playerNum] != nullptr);
+		stateKey = HashWidgetState(stateKey, m_numExtraLives[playerNum]);
+	}
 
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	if (m_playerLivesWidget.NeedsRebuild(stateKey))
 	{
-		if (m_playerShips[playerNum] == nullptr)
-			continue;
+		Verts& verts = m_playerLivesWidget.BeginRebuild(stateKey);
+		Vec2 fwrdVector = Vec2::MakeFromPolarDegrees(90.f, 1.f);
+		fwrdVector *= 7.5f; //increases scale
 
-		for (int lifeIndex = 0; lifeIndex < m_numExtraLives[playerNum]; ++lifeIndex)
+		for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
 		{
+			if (m_playerShips[playerNum] == nullptr)
+				continue;
+
 			Rgba8 playerLifeUIColor = m_playerColors[playerNum];
 			playerLifeUIColor.a = 125; //drop opacity of player color for ui element
 
-			//Create vertex array of ship with correct color
-			Vertex_PCU playerLifeVerts[NUM_PLAYERSHIP_VERTS];
-			PlayerShip::InitializeLocalVerts(&playerLifeVerts[0], playerLifeUIColor);
-			
-			Vec2 playerLifeUILocation = Vec2(m_playerLivesScreenLocation[playerNum].x + (35 * lifeIndex), m_playerLivesScreenLocation[playerNum].y);
-			if (playerNum == 1 || playerNum == 3)
+			for (int lifeIndex = 0; lifeIndex < m_numExtraLives[playerNum]; ++lifeIndex)
 			{
-				playerLifeUILocation = Vec2(m_playerLivesScreenLocation[playerNum].x - (35 * lifeIndex), m_playerLivesScreenLocation[playerNum].y);
+				//Create vertex array of ship with correct color
+				Vertex_PCU playerLifeVerts[NUM_PLAYERSHIP_VERTS];
+				PlayerShip::InitializeLocalVerts(&playerLifeVerts[0], playerLifeUIColor);
+
+				Vec2 playerLifeUILocation = Vec2(m_playerLivesScreenLocation[playerNum].x + (35 * lifeIndex), m_playerLivesScreenLocation[playerNum].y);
+				if (playerNum == 1 || playerNum == 3)
+				{
+					playerLifeUILocation = Vec2(m_playerLivesScreenLocation[playerNum].x - (35 * lifeIndex), m_playerLivesScreenLocation[playerNum].y);
+				}
+
+				TransformVertexArrayXY3D(NUM_PLAYERSHIP_VERTS, &playerLifeVerts[0], fwrdVector, fwrdVector.GetRotated90Degrees(), playerLifeUILocation);
+				verts.insert(verts.end(), &playerLifeVerts[0], &playerLifeVerts[0] + NUM_PLAYERSHIP_VERTS);
 			}
-			
-			TransformVertexArrayXY3D(NUM_PLAYERSHIP_VERTS, &playerLifeVerts[0], fwrdVector, fwrdVector.GetRotated90Degrees(), playerLifeUILocation);
-			g_renderer->BindTexture(nullptr);
-			g_renderer->DrawVertexArray(NUM_PLAYERSHIP_VERTS, &playerLifeVerts[0]);
 		}
+
+		m_playerLivesWidget.EndRebuild(*m_renderer);
 	}
+
+	m_playerLivesWidget.Render(*m_renderer);
 }
 
 void Game::RenderPlayerHealth() const
 {
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	unsigned long long stateKey = WIDGET_STATE_KEY_SEED;
+	for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
 	{
-		if (m_playerShips[playerNum] == nullptr)
-			continue;
+		bool hasPlayer = m_playerShips[playerNum] != nullptr;
+		stateKey = HashWidgetState(stateKey, hasPlayer);
+		stateKey = HashWidgetState(stateKey, hasPlayer ? m_playerShips[playerNum]->m_health : 0);
+	}
 
-		//start pos
-		Vec2 healthBarStartPos = Vec2(m_playerLivesScreenLocation[playerNum].x, m_playerLivesScreenLocation[playerNum].y - 50.f);
-		if (playerNum == 1 || playerNum == 2)
+	if (m_playerHealthWidget.NeedsRebuild(stateKey))
+	{
+		Verts& verts = m_playerHealthWidget.BeginRebuild(stateKey);
+		for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
 		{
-			healthBarStartPos = Vec2(m_playerLivesScreenLocation[playerNum].x, m_playerLivesScreenLocation[playerNum].y + 50.f);
-		}
+			if (m_playerShips[playerNum] == nullptr)
+				continue;
 
-		//end pos
-		Vec2 healthBarEndPos = Vec2(healthBarStartPos.x + (35 * (PLAYER_SHIP_NUM_STARTING_LIVES - 2)), healthBarStartPos.y);
-		if (playerNum == 1 || playerNum == 3)
-		{
-			healthBarEndPos = Vec2(healthBarStartPos.x - (35 * (PLAYER_SHIP_NUM_STARTING_LIVES - 2)), healthBarStartPos.y);
+			//start pos
+			Vec2 healthBarStartPos = Vec2(m_playerLivesScreenLocation[playerNum].x, m_playerLivesScreenLocation[playerNum].y - 50.f);
+			if (playerNum == 1 || playerNum == 2)
+			{
+				healthBarStartPos = Vec2(m_playerLivesScreenLocation[playerNum].x, m_playerLivesScreenLocation[playerNum].y + 50.f);
+			}
+
+			//end pos
+			Vec2 healthBarEndPos = Vec2(healthBarStartPos.x + (35 * (PLAYER_SHIP_NUM_STARTING_LIVES - 2)), healthBarStartPos.y);
+			if (playerNum == 1 || playerNum == 3)
+			{
+				healthBarEndPos = Vec2(healthBarStartPos.x - (35 * (PLAYER_SHIP_NUM_STARTING_LIVES - 2)), healthBarStartPos.y);
+			}
+
+			AddVertsForDebugLine2D(verts, healthBarStartPos, healthBarEndPos, 15.f, Rgba8(133, 136, 134, 100)); //background bar
+
+			float healthPosX = RangeMapClamped(static_cast<float>(m_playerShips[playerNum]->m_health), 0.f, static_cast<float>(PLAYER_SHIP_STARTING_HEALTH), healthBarStartPos.x, healthBarEndPos.x);
+			AddVertsForDebugLine2D(verts, healthBarStartPos, Vec2(healthPosX, healthBarEndPos.y), 15.f, Rgba8(24, 223, 31, 255)); //health bar
 		}
-		
-		DebugDrawLine2D(healthBarStartPos, healthBarEndPos, 15.f, Rgba8(133, 136, 134, 100)); //background bar
 
-		float healthPosX = RangeMapClamped(static_cast<float>(m_playerShips[playerNum]->m_health), 0.f, static_cast<float>(PLAYER_SHIP_STARTING_HEALTH), healthBarStartPos.x, healthBarEndPos.x);
-		DebugDrawLine2D(healthBarStartPos, Vec2(healthPosX, healthBarEndPos.y), 15.f, Rgba8(24, 223, 31, 255)); //health bar
+		m_playerHealthWidget.EndRebuild(*m_renderer);
 	}
+
+	m_playerHealthWidget.Render(*m_renderer);
 }
 
 void Game::RenderPlayerPowerUpTimer() const
 {
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	Vec2 powerUpBarStartPositions[MAX_NUM_LOCAL_PLAYERS];
+	Vec2 powerUpBarEndPositions[MAX_NUM_LOCAL_PLAYERS];
+	float powerUpPositionsX[MAX_NUM_LOCAL_PLAYERS] = {};
+	unsigned long long stateKey = WIDGET_STATE_KEY_SEED;
+	for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
 	{
-		if (m_playerShips[playerNum] == nullptr || !m_playerShips[playerNum]->m_hasPowerUp)
+		bool hasPowerUp = m_playerShips[playerNum] != nullptr && m_playerShips[playerNum]->m_hasPowerUp;
+		stateKey = HashWidgetState(stateKey, hasPowerUp);
+		if (!hasPowerUp)
 			continue;
 
 		//start pos
-		Vec2 powerUpBarStartPos = Vec2(m_playerLivesScreenLocation[playerNum].x, m_playerLivesScreenLocation[playerNum].y - 75.f);
+		Vec2& powerUpBarStartPos = powerUpBarStartPositions[playerNum];
+		powerUpBarStartPos = Vec2(m_playerLivesScreenLocation[playerNum].x, m_playerLivesScreenLocation[playerNum].y - 75.f);
 		if (playerNum == 1 || playerNum == 2)
 		{
 			powerUpBarStartPos = Vec2(m_playerLivesScreenLocation[playerNum].x, m_playerLivesScreenLocation[playerNum].y + 75.f);
 		}
 
 		//end pos
-		Vec2 powerUpBarEndPos = Vec2(powerUpBarStartPos.x + (35 * (PLAYER_SHIP_NUM_STARTING_LIVES - 2)), powerUpBarStartPos.y);
+		Vec2& powerUpBarEndPos = powerUpBarEndPositions[playerNum];
+		powerUpBarEndPos = Vec2(powerUpBarStartPos.x + (35 * (PLAYER_SHIP_NUM_STARTING_LIVES - 2)), powerUpBarStartPos.y);
 		if (playerNum == 1 || playerNum == 3)
 		{
 			powerUpBarEndPos = Vec2(powerUpBarStartPos.x - (35 * (PLAYER_SHIP_NUM_STARTING_LIVES - 2)), powerUpBarStartPos.y);
 		}
 
-		DebugDrawLine2D(powerUpBarStartPos, powerUpBarEndPos, 15.f, Rgba8(133, 136, 134, 100)); //background bar
+		//bar only needs new verts when it moves a whole pixel
+		powerUpPositionsX[playerNum] = RangeMapClamped(static_cast<float>(m_playerShips[playerNum]->m_powerUpAge), 0.f, m_playerShips[playerNum]->m_powerUpMaxAge, powerUpBarEndPos.x, powerUpBarStartPos.x);
+		stateKey = HashWidgetState(stateKey, static_cast<int>(powerUpPositionsX[playerNum]));
+	}
+
+	if (m_playerPowerUpTimerWidget.NeedsRebuild(stateKey))
+	{
+		Verts& verts = m_playerPowerUpTimerWidget.BeginRebuild(stateKey);
+		for (int playerNum = 0; playerNum < GetNumHUDPlayers(); ++playerNum)
+		{
+			if (m_playerShips[playerNum] == nullptr || !m_playerShips[playerNum]->m_hasPowerUp)
+				continue;
+
+			Vec2 const& powerUpBarStartPos = powerUpBarStartPositions[playerNum];
+			Vec2 const& powerUpBarEndPos = powerUpBarEndPositions[playerNum];
+			AddVertsForDebugLine2D(verts, powerUpBarStartPos, powerUpBarEndPos, 15.f, Rgba8(133, 136, 134, 100)); //background bar
+			AddVertsForDebugLine2D(verts, powerUpBarStartPos, Vec2(static_cast<float>(static_cast<int>(powerUpPositionsX[playerNum])), powerUpBarEndPos.y), 15.f, Rgba8(102, 153, 204, 255)); //power up bar
+		}
 
-		float healthPosX = RangeMapClamped(static_cast<float>(m_playerShips[playerNum]->m_powerUpAge), 0.f, m_playerShips[playerNum]->m_powerUpMaxAge, powerUpBarEndPos.x, powerUpBarStartPos.x);
-		DebugDrawLine2D(powerUpBarStartPos, Vec2(healthPosX, powerUpBarEndPos.y), 15.f, Rgba8(102, 153, 204, 255)); //power up bar
+		m_playerPowerUpTimerWidget.EndRebuild(*m_renderer);
 	}
+
+	m_playerPowerUpTimerWidget.Render(*m_renderer);
 }
 
 void Game::RenderEnemyWaveData() const
 {
-	Vec2 enemyBarStartPos = Vec2(SCREEN_CENTER_X - 500.f, SCREEN_SIZE_Y - 50.f);
-	Vec2 enemyBarEndPos = Vec2(SCREEN_CENTER_X + 500.f, SCREEN_SIZE_Y - 50.f);
+	unsigned long long stateKey = HashWidgetState(WIDGET_STATE_KEY_SEED, m_currentWave);
+	stateKey = HashWidgetState(stateKey, m_numEnemies);
+	stateKey = HashWidgetState(stateKey, m_numEnemiesInCurrentWave);
 
-	DebugDrawLine2D(enemyBarStartPos, enemyBarEndPos, 10.f, Rgba8(133, 136, 134, 100)); //background bar
-	float completedPosX = RangeMapClamped(static_cast<float>(m_numEnemies), 0.f, static_cast<float>(m_numEnemiesInCurrentWave), enemyBarStartPos.x, enemyBarEndPos.x);
-	DebugDrawLine2D(enemyBarStartPos,Vec2(completedPosX, enemyBarEndPos.y), 10.f, Rgba8(164, 16, 26, 100)); //wave bar
+	if (m_enemyWaveDataWidget.NeedsRebuild(stateKey))
+	{
+		Verts& verts = m_enemyWaveDataWidget.BeginRebuild(stateKey);
+		Vec2 enemyBarStartPos = Vec2(SCREEN_CENTER_X - 500.f, SCREEN_SIZE_Y - 50.f);
+		Vec2 enemyBarEndPos = Vec2(SCREEN_CENTER_X + 500.f, SCREEN_SIZE_Y - 50.f);
 
-	std::vector<Vertex_PCU> textVerts;
-	std::string waveTitle = "Wave: ";
-	std::string waveNumber = std::to_string(m_currentWave);
-	float textOffset = GetSimpleTriangleStringWidth(waveTitle + waveNumber, 30.f) * 0.5f;
-	AddVertsForTextTriangles2D(textVerts, waveTitle + waveNumber, Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 40.f), 30.f, Rgba8(164, 16, 26, 255));
-	g_renderer->DrawVertexArray(textVerts);
+		AddVertsForDebugLine2D(verts, enemyBarStartPos, enemyBarEndPos, 10.f, Rgba8(133, 136, 134, 100)); //background bar
+		float completedPosX = RangeMapClamped(static_cast<float>(m_numEnemies), 0.f, static_cast<float>(m_numEnemiesInCurrentWave), enemyBarStartPos.x, enemyBarEndPos.x);
+		AddVertsForDebugLine2D(verts, enemyBarStartPos, Vec2(completedPosX, enemyBarEndPos.y), 10.f, Rgba8(164, 16, 26, 100)); //wave bar
+
+		std::string waveTitle = "Wave: ";
+		std::string waveNumber = std::to_string(m_currentWave);
+		float textOffset = GetSimpleTriangleStringWidth(waveTitle + waveNumber, 30.f) * 0.5f;
+		AddVertsForTextTriangles2D(verts, waveTitle + waveNumber, Vec2(SCREEN_CENTER_X - textOffset, SCREEN_SIZE_Y - 40.f), 30.f, Rgba8(164, 16, 26, 255));
+
+		m_enemyWaveDataWidget.EndRebuild(*m_renderer);
+	}
+
+	m_enemyWaveDataWidget.Render(*m_renderer);
 }
 
 void Game::RenderGameOverScreen() const
 {
 	std::vector<Vertex_PCU> textVerts;
 	AddVertsForTextTriangles2D(textVerts, m_gameOverInfo.text, m_gameOverInfo.titlePos, m_gameOverInfo.textCellSize, m_gameOverInfo.titleColor);
-	g_renderer->DrawVertexArray(textVerts);
+	m_renderer->DrawVertexArray(textVerts);
 }
 
 //Spawn Functions
@@ -1537,7 +1851,7 @@ void Game::SpawnAsteroid()
 		if (m_asteroids[i] == nullptr)
 		{ 
 			Vec2 randomScreenPos = GetRandomPointOutsideScreen(ASTEROID_COSMETIC_RADIUS);
-			float randomOrientation = g_rng->RollRandomFloatInRange(0.f, 360.f);
+			float randomOrientation = m_rng.RollRandomFloatInRange(0.f, 360.f);
 
 			m_asteroids[i] = new Asteroid(this, randomScreenPos, randomOrientation);
 			return;
@@ -1579,7 +1893,7 @@ void Game::SpawnNewDebris(Vec2 const& position, Vec2 const& velocity, float cons
 	{
 		if (m_debris[i] == nullptr)
 		{
-			float orientationDeg = g_rng->RollRandomFloatInRange(0.f, 360.f);
+			float orientationDeg = m_rng.RollRandomFloatInRange(0.f, 360.f);
 			float radiusMax = averageRadius * 1.5f;
 			float radiusMin = averageRadius * .05f;
 			m_debris[i] = new Debris(this, position, orientationDeg, velocity, color, radiusMax, radiusMin);
@@ -1592,8 +1906,8 @@ void Game::SpawnNewDebrisCluster(Vec2 const& position, int numDebris, Vec2 const
 {
 	for (int i = 0; i < numDebris; ++i)
 	{
-		float thetaDegrees = g_rng->RollRandomFloatInRange(0.f, 360.f);
-		float speed = g_rng->RollRandomFloatZeroToOne() * maxScatterSpeed;
+		float thetaDegrees = m_rng.RollRandomFloatInRange(0.f, 360.f);
+		float speed = m_rng.RollRandomFloatZeroToOne() * maxScatterSpeed;
 		Vec2 scatterVelocity = Vec2::MakeFromPolarDegrees(thetaDegrees, speed);
 		Vec2 velocity = averageVelocity + scatterVelocity;
 		SpawnNewDebris(position, velocity, averageRadius, color);
@@ -1607,7 +1921,7 @@ void Game::SpawnNewPowerUp(Vec2 const& position)
 	{
 		if (m_powerUps[powerUpNum] == nullptr)
 		{
-			m_powerUps[powerUpNum] = new PowerUp(this, position, g_rng->RollRandomFloatInRange(0.f, 360.f));
+			m_powerUps[powerUpNum] = new PowerUp(this, position, m_rng.RollRandomFloatInRange(0.f, 360.f));
 			return;
 		}
 			
@@ -1678,7 +1992,7 @@ void Game::SpawnRandomizedEnemyWave()
 
 	for (int numEnemies = 0; numEnemies < m_currentWave; ++numEnemies)
 	{
-		int randRoll = g_rng->RollRandomIntInRange(0, WASP_BIAS);
+		int randRoll = m_rng.RollRandomIntInRange(0, WASP_BIAS);
 		if (randRoll == 0)
 		{
 			SpawnBeetle();
@@ -1820,11 +2134,65 @@ void Game::ClearEnemyWave()
 //--------------------------------------------------------------------
 void Game::CheckAllEntityCollisions()
 {
+	FillCollisionGrid();
 	CheckBulletCollisions();
 	CheckPlayerCollisions();
 	CheckEnemyCollisions();
 }
 
+void Game::FillCollisionGrid()
+{
+	m_collisionGrid.Clear();
+
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
+	{
+		if (m_playerShips[playerNum] != nullptr && m_playerShips[playerNum]->IsAlive())
+		{
+			m_collisionGrid.AddEntity(m_playerShips[playerNum], CollisionLayer::PLAYER_SHIP);
+		}
+	}
+
+	for (int bulletNum = 0; bulletNum < MAX_BULLETS; ++bulletNum)
+	{
+		if (m_bullets[bulletNum] != nullptr && m_bullets[bulletNum]->IsAlive() && !m_bullets[bulletNum]->m_isDormant)
+		{
+			m_collisionGrid.AddEntity(m_bullets[bulletNum], CollisionLayer::BULLET);
+		}
+	}
+
+	for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
+	{
+		if (m_asteroids[asteroidNum] != nullptr && m_asteroids[asteroidNum]->IsAlive() && !m_asteroids[asteroidNum]->m_isDormant)
+		{
+			m_collisionGrid.AddEntity(m_asteroids[asteroidNum], CollisionLayer::ASTEROID);
+		}
+	}
+
+	for (int beetleNum = 0; beetleNum < MAX_BEETLES; ++beetleNum)
+	{
+		if (m_beetles[beetleNum] != nullptr && m_beetles[beetleNum]->IsAlive() && !m_beetles[beetleNum]->m_isDormant)
+		{
+			m_collisionGrid.AddEntity(m_beetles[beetleNum], CollisionLayer::BEETLE);
+		}
+	}
+
+	for (int waspNum = 0; waspNum < MAX_WASPS; ++waspNum)
+	{
+		if (m_wasps[waspNum] != nullptr && m_wasps[waspNum]->IsAlive() && !m_wasps[waspNum]->m_isDormant)
+		{
+			m_collisionGrid.AddEntity(m_wasps[waspNum], CollisionLayer::WASP);
+		}
+	}
+
+	for (int powerUpNum = 0; powerUpNum < MAX_POWERUPS; ++powerUpNum)
+	{
+		if (m_powerUps[powerUpNum] != nullptr && m_powerUps[powerUpNum]->IsAlive() && !m_powerUps[powerUpNum]->m_isDormant)
+		{
+			m_collisionGrid.AddEntity(m_powerUps[powerUpNum], CollisionLayer::POWERUP);
+		}
+	}
+}
+
 void Game::CheckBulletCollisions()
 {
 	for (int bulletNum = 0; bulletNum < MAX_BULLETS; ++bulletNum)
@@ -1833,28 +2201,27 @@ void Game::CheckBulletCollisions()
 		if (currentBullet == nullptr) //skip index if element is a nullptr
 			continue;
 
-		if (!currentBullet->IsAlive()) //skip index if bullet is already dead
+		if (!currentBullet->IsAlive() || currentBullet->m_isDormant) //skip index if bullet is already dead
 			continue;
 
 		Vec2 bulletPos = currentBullet->m_position;
 
 		//Bullet vs Asteroids
-		for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(bulletPos, BULLET_PHYSICS_RADIUS, CollisionLayer::ASTEROID, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Asteroid*& currentAsteroid = m_asteroids[asteroidNum];
-			if (currentAsteroid == nullptr) //skips index if element is a nullptr
+			Entity* currentAsteroid = m_collisionCandidates[candidateNum];
+			if (!currentAsteroid->IsAlive())//skips asteroid if it already died this frame
 				continue;
 
-			if (!currentAsteroid->IsAlive())//skips index if asteroid is already dead
-				continue;
-
-			else if (DoDiscsOverlap(currentBullet->m_position, BULLET_PHYSICS_RADIUS, currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS))
+			if (DoDiscsOverlap(currentBullet->m_position, BULLET_PHYSICS_RADIUS, currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS))
 			{
 				currentAsteroid->LoseHealth();
 				currentBullet->Die();
 
 				//spawn small debris
-				int debrisAmount = g_rng->RollRandomIntInRange(m_smallDebrisAmountRange.x, m_smallDebrisAmountRange.y);
+				int debrisAmount = m_rng.RollRandomIntInRange(m_smallDebrisAmountRange.x, m_smallDebrisAmountRange.y);
 				Vec2 velocity = currentBullet->m_velocity * m_smallDebrisVelocityScale;
 				SpawnNewDebrisCluster(bulletPos, debrisAmount, velocity, DEBRIS_MAX_SCATTER_SPEED, .25f, currentAsteroid->m_color);
 
@@ -1862,44 +2229,42 @@ void Game::CheckBulletCollisions()
 		}
 
 		//Bullet vs Beetles
-		for (int beetleNum = 0; beetleNum < MAX_BEETLES; ++beetleNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(bulletPos, BULLET_PHYSICS_RADIUS, CollisionLayer::BEETLE, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Beetle*& currentBeetle = m_beetles[beetleNum];
-			if (currentBeetle == nullptr)
-				continue;
-
+			Entity* currentBeetle = m_collisionCandidates[candidateNum];
 			if (!currentBeetle->IsAlive())
 				continue;
 
-			else if (DoDiscsOverlap(bulletPos, BULLET_PHYSICS_RADIUS, currentBeetle->m_position, BEETLE_PHYSICS_RADIUS))
+			if (DoDiscsOverlap(bulletPos, BULLET_PHYSICS_RADIUS, currentBeetle->m_position, BEETLE_PHYSICS_RADIUS))
 			{
 				currentBullet->Die();
 				currentBeetle->LoseHealth();
 
 				//spawn small debris
-				int debrisAmount = g_rng->RollRandomIntInRange(m_smallDebrisAmountRange.x, m_smallDebrisAmountRange.y);
+				int debrisAmount = m_rng.RollRandomIntInRange(m_smallDebrisAmountRange.x, m_smallDebrisAmountRange.y);
 				Vec2 velocity = currentBullet->m_velocity * m_smallDebrisVelocityScale;
 				SpawnNewDebrisCluster(bulletPos, debrisAmount, velocity, DEBRIS_MAX_SCATTER_SPEED, .25f, currentBeetle->m_color);
 			}
 		}
 
 		//Bullet vs Wasps
-		for (int waspNum = 0; waspNum < MAX_WASPS; ++waspNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(bulletPos, BULLET_PHYSICS_RADIUS, CollisionLayer::WASP, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Wasp*& currentWasp = m_wasps[waspNum];
-			if (currentWasp == nullptr)
-				continue;
-
+			Entity* currentWasp = m_collisionCandidates[candidateNum];
 			if (!currentWasp->IsAlive())
 				continue;
 			
-			else if (DoDiscsOverlap(bulletPos, BULLET_PHYSICS_RADIUS, currentWasp->m_position, WASP_PHYSICS_RADIUS))
+			if (DoDiscsOverlap(bulletPos, BULLET_PHYSICS_RADIUS, currentWasp->m_position, WASP_PHYSICS_RADIUS))
 			{
 				currentBullet->Die();
 				currentWasp->LoseHealth();
 
 				//spawn small debris
-				int debrisAmount = g_rng->RollRandomIntInRange(m_smallDebrisAmountRange.x, m_smallDebrisAmountRange.y);
+				int debrisAmount = m_rng.RollRandomIntInRange(m_smallDebrisAmountRange.x, m_smallDebrisAmountRange.y);
 				Vec2 velocity = currentBullet->m_velocity * m_smallDebrisVelocityScale;
 				SpawnNewDebrisCluster(bulletPos, debrisAmount, velocity, DEBRIS_MAX_SCATTER_SPEED, .25f, currentWasp->m_color);
 			}
@@ -1909,7 +2274,7 @@ void Game::CheckBulletCollisions()
 
 void Game::CheckPlayerCollisions()
 {
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		PlayerShip*& currentPlayerShip = m_playerShips[playerNum];
 
@@ -1920,15 +2285,15 @@ void Game::CheckPlayerCollisions()
 			continue;
 
 		Vec2 playerShipPos = currentPlayerShip->m_position;
+		float playerQueryRadius = currentPlayerShip->HasShield() ? PLAYER_SHIP_SHIELD_RADIUS : PLAYER_SHIP_PHYSICS_RADIUS;
 
 		//Player vs Asteroids
-		for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(playerShipPos, playerQueryRadius, CollisionLayer::ASTEROID, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Asteroid*& currentAsteroid = m_asteroids[asteroidNum];
-			if (currentAsteroid == nullptr) //skips index if element is a nullptr
-				continue;
-
-			if (!currentAsteroid->IsAlive()) //skip index if asteroid is already dead
+			Entity* currentAsteroid = m_collisionCandidates[candidateNum];
+			if (!currentAsteroid->IsAlive()) //skip asteroid if it already died this frame
 				continue;
 
 			if (currentPlayerShip->HasShield())
@@ -1948,12 +2313,11 @@ void Game::CheckPlayerCollisions()
 		}
 
 		//Player vs Beetles
-		for (int beetleNum = 0; beetleNum < MAX_BEETLES; ++beetleNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(playerShipPos, playerQueryRadius, CollisionLayer::BEETLE, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Beetle*& currentBeetle = m_beetles[beetleNum];
-			if (currentBeetle == nullptr)
-				continue;
-
+			Entity* currentBeetle = m_collisionCandidates[candidateNum];
 			if (!currentBeetle->IsAlive())
 				continue;
 
@@ -1973,12 +2337,11 @@ void Game::CheckPlayerCollisions()
 		}
 
 		//Player vs Wasps
-		for (int waspNum = 0; waspNum < MAX_WASPS; ++waspNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(playerShipPos, playerQueryRadius, CollisionLayer::WASP, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Wasp*& currentWasp = m_wasps[waspNum];
-			if (currentWasp == nullptr)
-				continue;
-
+			Entity* currentWasp = m_collisionCandidates[candidateNum];
 			if (!currentWasp->IsAlive())
 				continue;
 
@@ -1998,13 +2361,12 @@ void Game::CheckPlayerCollisions()
 		}
 
 		//Player vs other players
-		for (int otherPlayerNum = 0; otherPlayerNum < MAX_NUM_PLAYERS; ++otherPlayerNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(playerShipPos, playerQueryRadius, CollisionLayer::PLAYER_SHIP, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			if (otherPlayerNum == playerNum)
-				continue;
-			PlayerShip*& otherPlayer = m_playerShips[otherPlayerNum];
-
-			if (otherPlayer == nullptr)
+			PlayerShip* otherPlayer = static_cast<PlayerShip*>(m_collisionCandidates[candidateNum]);
+			if (otherPlayer == currentPlayerShip)
 				continue;
 
 			if (!otherPlayer->IsAlive())
@@ -2039,12 +2401,11 @@ void Game::CheckPlayerCollisions()
 			}
 		}
 		//Player vs PowerUps
-		for (int powerUpNum = 0; powerUpNum < MAX_POWERUPS; ++powerUpNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(playerShipPos, PLAYER_SHIP_PHYSICS_RADIUS, CollisionLayer::POWERUP, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			PowerUp*& currentPowerUp = m_powerUps[powerUpNum];
-			if (currentPowerUp == nullptr)
-				continue;
-
+			PowerUp* currentPowerUp = static_cast<PowerUp*>(m_collisionCandidates[candidateNum]);
 			if (!currentPowerUp->IsAlive())
 				continue;
 
@@ -2059,12 +2420,11 @@ void Game::CheckPlayerCollisions()
 		if (m_inCoOpMode)
 			continue;
 
-		for (int bulletNum = 0; bulletNum < MAX_BULLETS; ++bulletNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(playerShipPos, PLAYER_SHIP_PHYSICS_RADIUS, CollisionLayer::BULLET, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Bullet*& currentBullet = m_bullets[bulletNum];
-			if (currentBullet == nullptr)
-				continue;
-
+			Bullet* currentBullet = static_cast<Bullet*>(m_collisionCandidates[candidateNum]);
 			if (!currentBullet->IsAlive())
 				continue;
 
@@ -2091,20 +2451,19 @@ void Game::CheckEnemyCollisions()
 		if (currentBeetle == nullptr)
 			continue;
 
-		if (!currentBeetle->IsAlive())
+		if (!currentBeetle->IsAlive() || currentBeetle->m_isDormant)
 			continue;
 
 		//Asteroids
-		for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(currentBeetle->m_position, BEETLE_PHYSICS_RADIUS, CollisionLayer::ASTEROID, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Asteroid*& currentAsteroid = m_asteroids[asteroidNum];
-			if (currentAsteroid == nullptr) //skips index if element is a nullptr
+			Entity* currentAsteroid = m_collisionCandidates[candidateNum];
+			if (!currentAsteroid->IsAlive()) //skip asteroid if it already died this frame
 				continue;
 
-			if (!currentAsteroid->IsAlive()) //skip index if asteroid is already dead
-				continue;
-
-			else if (DoDiscsOverlap(currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS, currentBeetle->m_position, BEETLE_PHYSICS_RADIUS))
+			if (DoDiscsOverlap(currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS, currentBeetle->m_position, BEETLE_PHYSICS_RADIUS))
 			{
 				currentAsteroid->Die();
 				currentBeetle->LoseHealth();
@@ -2112,13 +2471,12 @@ void Game::CheckEnemyCollisions()
 		}
 
 		//Checking against other enemies to push away from each other
-		for (int otherBeetleNum = 0; otherBeetleNum < MAX_BEETLES; ++otherBeetleNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(currentBeetle->m_position, BEETLE_PHYSICS_RADIUS, CollisionLayer::BEETLE, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			if (otherBeetleNum == beetleNum) // skip if same beetle
-				continue;
-
-			Beetle*& otherBeetle = m_beetles[otherBeetleNum];
-			if (otherBeetle == nullptr)
+			Entity* otherBeetle = m_collisionCandidates[candidateNum];
+			if (otherBeetle == currentBeetle) // skip if same beetle
 				continue;
 
 			if (!otherBeetle->IsAlive())
@@ -2130,12 +2488,11 @@ void Game::CheckEnemyCollisions()
 			}
 		}
 
-		for (int waspNum = 0; waspNum < MAX_WASPS; ++waspNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(currentBeetle->m_position, BEETLE_PHYSICS_RADIUS, CollisionLayer::WASP, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Wasp*& currentWasp = m_wasps[waspNum];
-			if (currentWasp == nullptr)
-				continue;
-
+			Entity* currentWasp = m_collisionCandidates[candidateNum];
 			if (!currentWasp->IsAlive())
 				continue;
 
@@ -2153,20 +2510,19 @@ void Game::CheckEnemyCollisions()
 		if (currentWasp == nullptr)
 			continue;
 
-		if (!currentWasp->IsAlive())
+		if (!currentWasp->IsAlive() || currentWasp->m_isDormant)
 			continue;
 
 		//Asteroids
-		for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(currentWasp->m_position, WASP_PHYSICS_RADIUS, CollisionLayer::ASTEROID, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			Asteroid*& currentAsteroid = m_asteroids[asteroidNum];
-			if (currentAsteroid == nullptr) //skips index if element is a nullptr
-				continue;
-
-			if (!currentAsteroid->IsAlive()) //skip index if asteroid is already dead
+			Entity* currentAsteroid = m_collisionCandidates[candidateNum];
+			if (!currentAsteroid->IsAlive()) //skip asteroid if it already died this frame
 				continue;
 
-			else if (DoDiscsOverlap(currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS, currentWasp->m_position, WASP_PHYSICS_RADIUS))
+			if (DoDiscsOverlap(currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS, currentWasp->m_position, WASP_PHYSICS_RADIUS))
 			{
 				currentAsteroid->Die();
 				currentWasp->LoseHealth();
@@ -2174,13 +2530,12 @@ void Game::CheckEnemyCollisions()
 		}
 
 		//Other Wasps
-		for (int otherWaspNum = 0; otherWaspNum < MAX_WASPS; ++otherWaspNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(currentWasp->m_position, WASP_PHYSICS_RADIUS, CollisionLayer::WASP, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			if (otherWaspNum == waspNum) //Skip if same wasp
-				continue;
-
-			Wasp*& otherWasp = m_wasps[otherWaspNum];
-			if (otherWasp == nullptr)
+			Entity* otherWasp = m_collisionCandidates[candidateNum];
+			if (otherWasp == currentWasp) //Skip if same wasp
 				continue;
 
 			if (!otherWasp->IsAlive())
@@ -2200,19 +2555,18 @@ void Game::CheckEnemyCollisions()
 		if (currentAsteroid == nullptr) //skips index if element is a nullptr
 			continue;
 
-		if (!currentAsteroid->IsAlive()) //skip index if asteroid is already dead
+		if (!currentAsteroid->IsAlive() || currentAsteroid->m_isDormant) //skip index if asteroid is already dead
 			continue;
 
-		for (int otherAsteroidNum = 0; otherAsteroidNum < MAX_ASTEROIDS; ++otherAsteroidNum)
+		m_collisionCandidates.clear();
+		m_collisionGrid.GetEntitiesNearDisc(currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS, CollisionLayer::ASTEROID, m_collisionCandidates);
+		for (int candidateNum = 0; candidateNum < (int)m_collisionCandidates.size(); ++candidateNum)
 		{
-			if (otherAsteroidNum == asteroidNum)
+			Entity* otherAsteroid = m_collisionCandidates[candidateNum];
+			if (otherAsteroid == currentAsteroid)
 				continue;
 
-			Asteroid*& otherAsteroid = m_asteroids[otherAsteroidNum];
-			if (otherAsteroid == nullptr) //skips index if element is a nullptr
-				continue;
-
-			if (!otherAsteroid->IsAlive()) //skip index if asteroid is already dead
+			if (!otherAsteroid->IsAlive()) //skip asteroid if it already died this frame
 				continue;
 
 			else if (DoDiscsOverlap(currentAsteroid->m_position, ASTEROID_PHYSICS_RADIUS, otherAsteroid->m_position, ASTEROID_PHYSICS_RADIUS))
@@ -2228,8 +2582,11 @@ void Game::CheckEnemyCollisions()
 //-----------------------------------------------------------------------------------------------
 void const Game::PlayGameSFX(StarShipSFX soundEffect) const
 {
+	if (m_audioSystem == nullptr)
+		return;
+
 	//default sound initialized with non-existant sound
-	SoundID newSound = g_audioSystem->CreateOrGetSound("NonExistantSound");
+	SoundID newSound = m_audioSystem->CreateOrGetSound("NonExistantSound");
 	bool isLooped = false;
 	float volume = 1.f;
 	float balance = 0.f;
@@ -2239,60 +2596,63 @@ void const Game::PlayGameSFX(StarShipSFX soundEffect) const
 	switch (soundEffect)
 	{
 	case StarShipSFX::ENTER_GAME:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnterGame.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnterGame.mp3");
 		speed = 1.5f;
 		break;
 
 	case StarShipSFX::FIRE_BULLET:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/FireBullet.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/FireBullet.wav");
 		volume = 0.5f;
 		break;
 
 	case StarShipSFX::PLAYER_DAMAGED:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
 		break;
 
 	case StarShipSFX::PLAYER_DEATH:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDeath.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDeath.wav");
 		break;
 
 	case StarShipSFX::PLAYER_RESPAWN:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerRespawn.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerRespawn.mp3");
 		break;
 
 	case StarShipSFX::ENEMY_DEATH:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDeath.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDeath.wav");
 		volume = .75f;
 		speed = 1.5f;
 		break;
 
 	case StarShipSFX::NEW_ENEMY_WAVE:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewEnemyWave.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewEnemyWave.mp3");
 		break;
 
 	case StarShipSFX::POWERUP:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PowerUp.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PowerUp.wav");
 		break;
 
 	case StarShipSFX::ASTEROID_HIT:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidHit.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidHit.mp3");
 		break;
 
 	case StarShipSFX::ASTEROID_BROKEN:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidBroken.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidBroken.wav");
 		break;
 
 	default:
 		break;
 	}
 
-	g_audioSystem->StartSound(newSound, isLooped, volume, balance, speed, isPaused);
+	m_audioSystem->StartSound(newSound, isLooped, volume, balance, speed, isPaused);
 }
 
 void const Game::PlayGameSFX(StarShipSFX soundEffect, Vec2 const& worldPosition)
 {
+	if (m_audioSystem == nullptr)
+		return;
+
 	//default sound initialized with non-existant sound
-	SoundID newSound = g_audioSystem->CreateOrGetSound("NonExistantSound");
+	SoundID newSound = m_audioSystem->CreateOrGetSound("NonExistantSound");
 	bool isLooped = false;
 	float volume = 1.f;
 	float balance = 0.f;
@@ -2302,78 +2662,81 @@ void const Game::PlayGameSFX(StarShipSFX soundEffect, Vec2 const& worldPosition)
 	switch (soundEffect)
 	{
 	case StarShipSFX::ENTER_GAME:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnterGame.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnterGame.mp3");
 		speed = 1.5f;
 		break;
 
 	case StarShipSFX::FIRE_BULLET:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/FireBullet.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/FireBullet.wav");
 		volume = 0.5f;
 		break;
 
 	case StarShipSFX::PLAYER_DAMAGED:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
 		break;
 
 	case StarShipSFX::PLAYER_DEATH:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDeath.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDeath.wav");
 		break;
 
 	case StarShipSFX::PLAYER_RESPAWN:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerRespawn.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerRespawn.mp3");
 		break;
 
 	case StarShipSFX::ENEMY_DEATH:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDeath.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDeath.wav");
 		volume = .75f;
 		speed = 1.5f;
 		break;
 
 	case StarShipSFX::NEW_ENEMY_WAVE:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewEnemyWave.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewEnemyWave.mp3");
 		break;
 
 	case StarShipSFX::POWERUP:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PowerUp.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/PowerUp.wav");
 		break;
 
 	case StarShipSFX::ASTEROID_HIT:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidHit.mp3");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidHit.mp3");
 		break;
 
 	case StarShipSFX::ASTEROID_BROKEN:
-		newSound = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidBroken.wav");
+		newSound = m_audioSystem->CreateOrGetSound("Data/Audio/SFX/AsteroidBroken.wav");
 		break;
 
 	default:
 		break;
 	}
 
-	SoundPlaybackID newPlayback = g_audioSystem->StartSound(newSound, isLooped, volume, balance, speed, isPaused);
+	SoundPlaybackID newPlayback = m_audioSystem->StartSound(newSound, isLooped, volume, balance, speed, isPaused);
 	SetAudioBalanceAndVolumeFromWorldPosition(newPlayback, worldPosition);
 }
 
 void const Game::PlayGameMusic(StarShipMusic musicTrack, bool loop)
 {
-	SoundID newMusic = g_audioSystem->CreateOrGetSound("NonExistantSound");
+	if (m_audioSystem == nullptr)
+		return;
+
+	SoundID newMusic = m_audioSystem->CreateOrGetSound("NonExistantSound");
 
 	switch (musicTrack)
 	{
 	case StarShipMusic::ATTRACT_SCREEN_MUSIC:
 		StopGameMusic(m_attractScreenMusic);
-		newMusic = g_audioSystem->CreateOrGetSound("Data/Audio/Music/AttractScreenMusic.mp3");
-		m_attractScreenMusic = g_audioSystem->StartSound(newMusic, loop, 1.f, 0.f, 1.f, false);
+		newMusic = m_audioSystem->CreateOrGetSound("Data/Audio/Music/AttractScreenMusic.mp3");
+		m_attractScreenMusic = m_audioSystem->StartSound(newMusic, loop, 1.f, 0.f, 1.f, false);
 		break;
 
 	case StarShipMusic::GAME_MUSIC:
 		StopGameMusic(m_gameMusic);
-		newMusic = g_audioSystem->CreateOrGetSound("Data/Audio/Music/GameMusic.mp3");
-		m_gameMusic = g_audioSystem->StartSound(newMusic, loop, .5f, 0.f, 1.f, false);
+		newMusic = m_audioSystem->CreateOrGetSound("Data/Audio/Music/GameMusic.mp3");
+		m_gameMusic = m_audioSystem->StartSound(newMusic, loop, .5f, 0.f, 1.f, false);
 		break;
 
 	case StarShipMusic::PLAYER_SHIP_ENGINE_THRUST:
-		newMusic = g_audioSystem->CreateOrGetSound("Data/Audio/Music/PlayerShipEngineThrust.wav");
-		g_audioSystem->StartSound(newMusic, false, .5f, 0.f, 1.f, false);
+		newMusic = m_audioSystem->CreateOrGetSound("Data/Audio/Music/PlayerShipEngineThrust.wav");
+		m_audioSystem->StartSound(newMusic, false, .5f, 0.f, 1.f, false);
 
 	}
 
@@ -2381,25 +2744,28 @@ void const Game::PlayGameMusic(StarShipMusic musicTrack, bool loop)
 
 void const Game::PlayGameMusic(SoundPlaybackID& soundPlayBackID, StarShipMusic musicTrack, bool loop)
 {
-	SoundID newMusic = g_audioSystem->CreateOrGetSound("NonExistantSound");
+	if (m_audioSystem == nullptr)
+		return;
+
+	SoundID newMusic = m_audioSystem->CreateOrGetSound("NonExistantSound");
 
 	switch (musicTrack)
 	{
 	case StarShipMusic::ATTRACT_SCREEN_MUSIC:
 		StopGameMusic(m_attractScreenMusic);
-		newMusic = g_audioSystem->CreateOrGetSound("Data/Audio/Music/AttractScreenMusic.mp3");
-		soundPlayBackID = g_audioSystem->StartSound(newMusic, loop, 1.f, 0.f, 1.f, false);
+		newMusic = m_audioSystem->CreateOrGetSound("Data/Audio/Music/AttractScreenMusic.mp3");
+		soundPlayBackID = m_audioSystem->StartSound(newMusic, loop, 1.f, 0.f, 1.f, false);
 		break;
 
 	case StarShipMusic::GAME_MUSIC:
 		StopGameMusic(m_gameMusic);
-		newMusic = g_audioSystem->CreateOrGetSound("Data/Audio/Music/GameMusic.mp3");
-		soundPlayBackID = g_audioSystem->StartSound(newMusic, loop, .5f, 0.f, 1.f, false);
+		newMusic = m_audioSystem->CreateOrGetSound("Data/Audio/Music/GameMusic.mp3");
+		soundPlayBackID = m_audioSystem->StartSound(newMusic, loop, .5f, 0.f, 1.f, false);
 		break;
 
 	case StarShipMusic::PLAYER_SHIP_ENGINE_THRUST:
-		newMusic = g_audioSystem->CreateOrGetSound("Data/Audio/Music/PlayerShipEngineThrust.wav");
-		soundPlayBackID = g_audioSystem->StartSound(newMusic, loop, .5f, 0.f, 1.f, false);
+		newMusic = m_audioSystem->CreateOrGetSound("Data/Audio/Music/PlayerShipEngineThrust.wav");
+		soundPlayBackID = m_audioSystem->StartSound(newMusic, loop, .5f, 0.f, 1.f, false);
 
 	default:
 		break;
@@ -2408,14 +2774,17 @@ void const Game::PlayGameMusic(SoundPlaybackID& soundPlayBackID, StarShipMusic m
 
 void const Game::StopGameMusic(StarShipMusic musicTrack)
 {
+	if (m_audioSystem == nullptr)
+		return;
+
 	switch (musicTrack)
 	{
 	case StarShipMusic::ATTRACT_SCREEN_MUSIC:
-		g_audioSystem->StopSound(m_attractScreenMusic);
+		m_audioSystem->StopSound(m_attractScreenMusic);
 		break;
 
 	case StarShipMusic::GAME_MUSIC:
-		g_audioSystem->StopSound(m_gameMusic);
+		m_audioSystem->StopSound(m_gameMusic);
 		break;
 
 	default:
@@ -2425,7 +2794,10 @@ void const Game::StopGameMusic(StarShipMusic musicTrack)
 
 void const Game::StopGameMusic(SoundPlaybackID soundPlaybackID)
 {
-	g_audioSystem->StopSound(soundPlaybackID);
+	if (m_audioSystem == nullptr)
+		return;
+
+	m_audioSystem->StopSound(soundPlaybackID);
 }
 
 float Game::GetAudioBalanceFromWorldPosition(Vec2 const& inPosition) const
@@ -2435,46 +2807,213 @@ float Game::GetAudioBalanceFromWorldPosition(Vec2 const& inPosition) const
 
 void const Game::SetAudioBalanceAndVolumeFromWorldPosition(SoundPlaybackID& sound, Vec2 const& worldPos)
 {
+	if (m_audioSystem == nullptr)
+		return;
+
 	AABB2 cameraView = AABB2(m_worldCamBottomLeft, m_worldCamTopRight);
 	if (!cameraView.IsPointInside(worldPos)) // volume = 0 if position is not in camera view
 	{
-		g_audioSystem->SetSoundPlaybackVolume(sound, 0.f);
+		m_audioSystem->SetSoundPlaybackVolume(sound, 0.f);
 	}
-	g_audioSystem->SetSoundPlaybackBalance(sound, RangeMapClamped(worldPos.x, m_worldCamBottomLeft.x, m_worldCamTopRight.x, -1.f, 1.f));
+	m_audioSystem->SetSoundPlaybackBalance(sound, RangeMapClamped(worldPos.x, m_worldCamBottomLeft.x, m_worldCamTopRight.x, -1.f, 1.f));
 }
 
 //Helper Functions
 //-----------------------------------------------------------------------------------------------
-Vec2 const Game::GetRandomPointOutsideScreen(float const& offset) const
+Vec2 const Game::GetRandomPointOutsideScreen(float const& offset)
 {
+	//spawn just outside the camera, which is the whole world unless in large world mode
+	AABB2 cameraBounds(m_worldCamBottomLeft, m_worldCamTopRight);
 	Vec2 randomScreenPos;
 
-	int side = g_rng->RollRandomIntInRange(0, 3);
-	switch (side)
+	int side = m_rng.RollRandomIntInRange(0, 3);
+	for (int attemptNum = 0; attemptNum < 2; ++attemptNum)
 	{
-	case 0: //bottom
-		randomScreenPos.x = g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_X);
-		randomScreenPos.y = -offset;
-		break;
+		switch (side)
+		{
+		case 0: //bottom
+			randomScreenPos.x = m_rng.RollRandomFloatInRange(cameraBounds.m_mins.x, cameraBounds.m_maxs.x);
+			randomScreenPos.y = cameraBounds.m_mins.y - offset;
+			break;
 
-	case 1: //right
-		randomScreenPos.x = WORLD_SIZE_X + offset;
-		randomScreenPos.y = g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_Y);
-		break;
+		case 1: //right
+			randomScreenPos.x = cameraBounds.m_maxs.x + offset;
+			randomScreenPos.y = m_rng.RollRandomFloatInRange(cameraBounds.m_mins.y, cameraBounds.m_maxs.y);
+			break;
 
-	case 2: //top
-		randomScreenPos.x = g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_X);
-		randomScreenPos.y = WORLD_SIZE_Y + offset;
-		break;
+		case 2: //top
+			randomScreenPos.x = m_rng.RollRandomFloatInRange(cameraBounds.m_mins.x, cameraBounds.m_maxs.x);
+			randomScreenPos.y = cameraBounds.m_maxs.y + offset;
+			break;
 
-	case 3: //left
-		randomScreenPos.x = -offset;
-		randomScreenPos.y = g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_Y);
-		break;
+		case 3: //left
+			randomScreenPos.x = cameraBounds.m_mins.x - offset;
+			randomScreenPos.y = m_rng.RollRandomFloatInRange(cameraBounds.m_mins.y, cameraBounds.m_maxs.y);
+			break;
+		}
+
+		//camera is against the world edge, use the opposite side so the spawn does not wrap across the world
+		if (!m_inLargeWorldMode || m_worldBounds.IsPointInside(randomScreenPos))
+			break;
+
+		side = (side + 2) % 4;
 	}
 	return randomScreenPos;
 }
 
+AABB2 const& Game::GetWorldBounds() const
+{
+	return m_worldBounds;
+}
+
+bool Game::SetLargeWorldMode(bool largeWorld)
+{
+	if (!m_inAttractMode)
+		return false;
+
+	m_inLargeWorldMode = largeWorld;
+	InitWorldBounds();
+	InitPlayerData();
+	InitStarLocations();
+	return true;
+}
+
+void Game::UpdateSimulationLOD()
+{
+	m_simulationFrameCount++;
+	m_worldChunks.ClearActiveChunks();
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
+	{
+		if (m_playerShips[playerNum] == nullptr)
+			continue;
+
+		m_worldChunks.ActivateChunksAroundPosition(m_playerShips[playerNum]->m_position, ACTIVE_CHUNK_RADIUS);
+	}
+
+	AABB2 cameraBounds(m_worldCamBottomLeft, m_worldCamTopRight);
+
+	//bullets are fast and always collision relevant so they never drop below full rate
+	for (int bulletNum = 0; bulletNum < MAX_BULLETS; ++bulletNum)
+	{
+		if (m_bullets[bulletNum] != nullptr)
+		{
+			UpdateEntitySimulationLOD(m_bullets[bulletNum], cameraBounds, true);
+		}
+	}
+
+	for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
+	{
+		if (m_asteroids[asteroidNum] != nullptr)
+		{
+			UpdateEntitySimulationLOD(m_asteroids[asteroidNum], cameraBounds);
+		}
+	}
+
+	for (int debrisNum = 0; debrisNum < MAX_DEBRIS; ++debrisNum)
+	{
+		if (m_debris[debrisNum] != nullptr)
+		{
+			UpdateEntitySimulationLOD(m_debris[debrisNum], cameraBounds);
+		}
+	}
+
+	for (int beetleNum = 0; beetleNum < MAX_BEETLES; ++beetleNum)
+	{
+		if (m_beetles[beetleNum] != nullptr)
+		{
+			UpdateEntitySimulationLOD(m_beetles[beetleNum], cameraBounds);
+		}
+	}
+
+	for (int waspNum = 0; waspNum < MAX_WASPS; ++waspNum)
+	{
+		if (m_wasps[waspNum] != nullptr)
+		{
+			UpdateEntitySimulationLOD(m_wasps[waspNum], cameraBounds);
+		}
+	}
+
+	for (int powerUpNum = 0; powerUpNum < MAX_POWERUPS; ++powerUpNum)
+	{
+		if (m_powerUps[powerUpNum] != nullptr)
+		{
+			UpdateEntitySimulationLOD(m_powerUps[powerUpNum], cameraBounds);
+		}
+	}
+}
+
+void Game::UpdateEntitySimulationLOD(Entity* entity, AABB2 const& cameraBounds, bool alwaysFullRate)
+{
+	//anything outside every player's active chunks sleeps until a player comes back
+	entity->m_isDormant = !m_worldChunks.IsPositionInActiveChunk(entity->m_position);
+	if (entity->m_isDormant)
+	{
+		entity->m_unsimulatedSeconds = 0.f;
+		return;
+	}
+
+	if (alwaysFullRate || entity->IsVisibleInBounds(cameraBounds))
+	{
+		entity->m_updateLOD = UpdateLOD::FULL;
+		return;
+	}
+
+	float nearestPlayerDistanceSquared = 9999999999999.f;
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
+	{
+		if (m_playerShips[playerNum] == nullptr || !m_playerShips[playerNum]->IsAlive())
+			continue;
+
+		float distanceSquared = GetDistanceSquared2D(entity->m_position, m_playerShips[playerNum]->m_position);
+		if (distanceSquared < nearestPlayerDistanceSquared)
+		{
+			nearestPlayerDistanceSquared = distanceSquared;
+		}
+	}
+
+	if (nearestPlayerDistanceSquared < UPDATE_LOD_HALF_RATE_DISTANCE * UPDATE_LOD_HALF_RATE_DISTANCE)
+	{
+		entity->m_updateLOD = UpdateLOD::FULL;
+	}
+
+	else if (nearestPlayerDistanceSquared < UPDATE_LOD_QUARTER_RATE_DISTANCE * UPDATE_LOD_QUARTER_RATE_DISTANCE)
+	{
+		entity->m_updateLOD = UpdateLOD::HALF;
+	}
+
+	else
+	{
+		entity->m_updateLOD = UpdateLOD::QUARTER;
+	}
+}
+
+bool Game::ShouldEntityUpdateThisFrame(Entity* entity, int slotIndex, float deltaSeconds, float& out_entityDeltaSeconds) const
+{
+	if (entity->m_isDormant)
+		return false;
+
+	entity->m_unsimulatedSeconds += deltaSeconds;
+
+	int updatePeriod = 1;
+	if (entity->m_updateLOD == UpdateLOD::HALF)
+	{
+		updatePeriod = 2;
+	}
+
+	else if (entity->m_updateLOD == UpdateLOD::QUARTER)
+	{
+		updatePeriod = 4;
+	}
+
+	//slot index staggers entities in the same bucket across frames
+	if ((m_simulationFrameCount + slotIndex) % updatePeriod != 0)
+		return false;
+
+	out_entityDeltaSeconds = entity->m_unsimulatedSeconds;
+	entity->m_unsimulatedSeconds = 0.f;
+	return true;
+}
+
 void Game::AdjustTimeDistortion()
 {
 	//#TODO: fix time issue with game over sequence
@@ -2491,7 +3030,7 @@ Vec2 const Game::GetNearestPlayerPosition(Vec2 const& inPosition)
 	Vec2 closestPlayerPos = m_playerShips[0]->m_position;
 	float shortestDistance = 9999999999999.f;
 
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_playerShips[playerNum] == nullptr || !m_playerShips[playerNum]->IsAlive())
 			continue;
@@ -2509,9 +3048,47 @@ Vec2 const Game::GetNearestPlayerPosition(Vec2 const& inPosition)
 	return closestPlayerPos;
 }
 
+Vec2 const Game::GetNearestEnemyPosition(Vec2 const& inPosition, bool& out_foundEnemy) const
+{
+	Vec2 closestEnemyPos = inPosition;
+	float shortestDistanceSquared = 9999999999999.f;
+	out_foundEnemy = false;
+
+	auto checkEnemy = [&](Entity const* enemy)
+	{
+		if (enemy == nullptr || !enemy->IsAlive())
+			return;
+
+		float distanceSquared = GetDistanceSquared2D(inPosition, enemy->m_position);
+		if (distanceSquared < shortestDistanceSquared)
+		{
+			shortestDistanceSquared = distanceSquared;
+			closestEnemyPos = enemy->m_position;
+			out_foundEnemy = true;
+		}
+	};
+
+	for (int asteroidNum = 0; asteroidNum < MAX_ASTEROIDS; ++asteroidNum)
+	{
+		checkEnemy(m_asteroids[asteroidNum]);
+	}
+
+	for (int beetleNum = 0; beetleNum < MAX_BEETLES; ++beetleNum)
+	{
+		checkEnemy(m_beetles[beetleNum]);
+	}
+
+	for (int waspNum = 0; waspNum < MAX_WASPS; ++waspNum)
+	{
+		checkEnemy(m_wasps[waspNum]);
+	}
+
+	return closestEnemyPos;
+}
+
 bool const Game::AllPlayersDead() const
 {
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_playerShips[playerNum] == nullptr)
 			continue;
@@ -2525,9 +3102,9 @@ bool const Game::AllPlayersDead() const
 
 PlayerShip* Game::GetPlayerShipByID(int idNum) const
 {
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
-		if (m_playerShips[playerNum]->m_playerID == idNum)
+		if (m_playerShips[playerNum] != nullptr && m_playerShips[playerNum]->m_playerID == idNum)
 		{
 			return m_playerShips[playerNum];
 		}
@@ -2537,7 +3114,7 @@ PlayerShip* Game::GetPlayerShipByID(int idNum) const
 
 int Game::GetPlayerNumFromPlayerID(int idNum) const
 {
-	for (int playerNum = 0; playerNum < MAX_NUM_PLAYERS; ++playerNum)
+	for (int playerNum = 0; playerNum < m_numPlayerSlots; ++playerNum)
 	{
 		if (m_playerShips[playerNum]!= nullptr && m_playerShips[playerNum]->m_playerID == idNum)
 		{
@@ -2547,6 +3124,16 @@ int Game::GetPlayerNumFromPlayerID(int idNum) const
 	return -1;
 }
 
+int Game::GetNumPlayerSlots() const
+{
+	return m_numPlayerSlots;
+}
+
+int Game::GetNumHUDPlayers() const
+{
+	return m_numPlayerSlots < MAX_NUM_LOCAL_PLAYERS ? m_numPlayerSlots : MAX_NUM_LOCAL_PLAYERS;
+}
+
 void Game::CheckNumRemainingPlayersForGameOver()
 {
 	int numPlayersAlive = 0;
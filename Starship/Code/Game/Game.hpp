@@ -6,6 +6,12 @@
 #include "Engine/Audio/AudioSystem.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Core/EventSystem.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+
+#include "Game/ScreenWidget.hpp"
+#include "Game/WorldChunkGrid.hpp"
+#include "Game/CollisionGrid.hpp"
+#include <vector>
 
 class PlayerShip;
 class Asteroid;
@@ -22,6 +28,28 @@ class PowerUp;
 enum class PowerUpTypes;
 class Clock;
 class Timer;
+class App;
+class RendererDX11;
+class InputSystem;
+class DevConsole;
+
+//Services a game instance talks to, any left null are skipped so headless games can run side by side on worker threads
+struct GameConfig
+{
+	App* m_app = nullptr;
+	RendererDX11* m_renderer = nullptr;
+	AudioSystem* m_audioSystem = nullptr;
+	InputSystem* m_inputSystem = nullptr;
+	EventSystem* m_eventSystem = nullptr;
+	DevConsole* m_devConsole = nullptr;
+
+	Clock* m_parentClock = nullptr; //null gives the game its own root clock, advanced only by StepFrame()
+	unsigned int m_seed = 0;
+
+	int m_maxNumPlayers = MAX_NUM_LOCAL_PLAYERS; //raise for bot or networked matches, only the first MAX_NUM_LOCAL_PLAYERS get lobby and HUD slots
+	int m_numBotPlayers = 0; //bots skip the attract screen and start a match right away
+	bool m_coOpMode = true;
+};
 
 struct EnemyWaveInfo
 {
@@ -106,7 +134,7 @@ enum class StarShipMusic
 class Game
 {
 public:
-	Game();
+	explicit Game(GameConfig const& config);
 	~Game();
 
 	//Game Flow Management
@@ -116,6 +144,7 @@ public:
 	void Update();
 	void Render() const;
 	void EndFrame();
+	void StepFrame(float deltaSeconds); //advances a game with its own root clock by a fixed step
 
 	void GameOver(int const& playerNum, bool const& gameWon);
 
@@ -127,6 +156,7 @@ public:
 	static bool Event_TimeScale(EventArgs& args);
 	static bool Event_DebugDraw(EventArgs& args);
 	static bool Event_Restart(EventArgs& args);
+	static bool Event_LargeWorld(EventArgs& args);
 
 	//Public Spawn Functions
 	void SpawnNewBullet(Vec2 const& position, float const& orientationDegrees, int const& playerID);
@@ -147,15 +177,28 @@ public:
 	//Screen Shake
 	void StartScreenShake(float duration, float shakeTrauma);
 
+	//World
+	AABB2 const& GetWorldBounds() const;
+
 	//Player Data
 	Vec2 const GetNearestPlayerPosition(Vec2 const& inPosition);
 	bool const AllPlayersDead() const;
 	PlayerShip* GetPlayerShipByID(int idNum) const;
 	int GetPlayerNumFromPlayerID(int idNum) const;
+	int GetNumPlayerSlots() const;
+	int GetNumHUDPlayers() const;
 	void CheckNumRemainingPlayersForGameOver();
 
+	//Enemy Data
+	Vec2 const GetNearestEnemyPosition(Vec2 const& inPosition, bool& out_foundEnemy) const;
+
+	//Match Results
+	bool IsMatchOver() const;
+	int GetCurrentWave() const;
+
 private:
 	//Initialization
+	void InitWorldBounds();
 	void InitPlayerData();
 	void InitEnemyWaveData();
 	void InitStarLocations();
@@ -169,6 +212,7 @@ private:
 	void ConnectNewPlayer(int playerID);
 	void CheckIfAllPlayersReady();
 	void StartGame();
+	void StartBotMatch(int numBots, bool coOpMode);
 
 	//Update
 	void ManageConditionalGameStateUpdates();
@@ -197,6 +241,13 @@ private:
 
 	//Camera Management
 	void UpdateCameras(float deltaSeconds);
+	void FollowPlayersWithWorldCamera();
+
+	//Large World
+	bool SetLargeWorldMode(bool largeWorld);
+	void UpdateSimulationLOD();
+	void UpdateEntitySimulationLOD(Entity* entity, AABB2 const& cameraBounds, bool alwaysFullRate = false);
+	bool ShouldEntityUpdateThisFrame(Entity* entity, int slotIndex, float deltaSeconds, float& out_entityDeltaSeconds) const;
 
 	//Entity Management
 	void UpdatePlayers(float deltaSeconds);
@@ -208,6 +259,7 @@ private:
 
 	//Collision
 	void CheckAllEntityCollisions();
+	void FillCollisionGrid();
 	void CheckBulletCollisions();
 	void CheckPlayerCollisions();
 	void CheckEnemyCollisions();
@@ -219,13 +271,22 @@ private:
 
 	//Helpers
 	void AdjustTimeDistortion();
-	Vec2 const GetRandomPointOutsideScreen(float const& offset) const;
+	Vec2 const GetRandomPointOutsideScreen(float const& offset);
 
 public:
+	//Services
+	GameConfig m_config;
+	RandomNumberGenerator m_rng;
+	RendererDX11* m_renderer = nullptr;
+	AudioSystem* m_audioSystem = nullptr;
+	InputSystem* m_inputSystem = nullptr;
+	DevConsole* m_devConsole = nullptr;
+	App* m_app = nullptr;
+
 	//Player management
-	PlayerShip* m_playerShips[MAX_NUM_PLAYERS] = {};
+	std::vector<PlayerShip*> m_playerShips;
 	PlayerShip* m_firstPlayerShip;
-	int m_numExtraLives[MAX_NUM_PLAYERS] = {};
+	std::vector<int> m_numExtraLives;
 	
 	//Debug
 	bool m_shouldDrawDebug = false;
@@ -246,13 +307,21 @@ private:
 	Vec2 m_worldCamBottomLeft;
 	Vec2 m_worldCamTopRight;
 
+	//World
+	bool m_inLargeWorldMode = false;
+	AABB2 m_worldBounds;
+	WorldChunkGrid m_worldChunks;
+	CollisionGrid m_collisionGrid;
+	std::vector<Entity*> m_collisionCandidates; //reused by every broadphase query
+	int m_simulationFrameCount = 0;
+
 	//Entities
 	Asteroid* m_asteroids[MAX_ASTEROIDS] = {};
 	Bullet* m_bullets[MAX_BULLETS] = {};
 	Debris* m_debris[MAX_DEBRIS] = {};
 	Beetle* m_beetles[MAX_BEETLES] = {};
 	Wasp* m_wasps[MAX_WASPS] = {};
-	Star* m_stars[MAX_STARS] = {};
+	std::vector<Star*> m_stars;
 	PowerUp* m_powerUps[MAX_POWERUPS] = {};
 
 	//Game States
@@ -264,6 +333,7 @@ private:
 
 	//Debug
 	bool m_shouldRestart = false;
+	bool m_isMatchOver = false;
 
 	//Debris
 	IntVec2 m_smallDebrisAmountRange = IntVec2(1, 3);
@@ -275,10 +345,11 @@ private:
 	int m_numEnemiesInCurrentWave = 0;
 
 	//Player Initialization
-	Vec2 m_playerSpawnLocations[MAX_NUM_PLAYERS] = {};
-	float m_playerSpawnRotation[MAX_NUM_PLAYERS] = { -45.f, 135.f, 45.f, 225.f };
-	Vec2 m_playerLivesScreenLocation[MAX_NUM_PLAYERS] = {};
-	Rgba8 m_playerColors[MAX_NUM_PLAYERS] = {};
+	int m_numPlayerSlots = MAX_NUM_LOCAL_PLAYERS;
+	std::vector<Vec2> m_playerSpawnLocations;
+	std::vector<float> m_playerSpawnRotation;
+	std::vector<Rgba8> m_playerColors;
+	Vec2 m_playerLivesScreenLocation[MAX_NUM_LOCAL_PLAYERS] = {};
 
 	//Screen Shake
 	bool m_inScreenShake = false;
@@ -292,7 +363,7 @@ private:
 
 	//Player Connection
 	int m_numConnectedPlayers = 0;
-	bool m_readyPlayers[MAX_NUM_PLAYERS] = { false, false, false, false };
+	std::vector<bool> m_readyPlayers;
 
 	//Attract screen
 	AttractScreenInfo m_attractScreenInfo;
@@ -303,8 +374,19 @@ private:
 
 	Rgba8 m_standardBodyTextColor;
 
+	Clock* m_parentClock = nullptr;
+	Clock* m_ownedRootClock = nullptr; //only set when no parent clock was given
 	Clock* m_clock = nullptr;
 	Timer* m_gameOverTimer = nullptr;
 
+	//Cached screen ui, rebuilt only when the state they display changes
+	mutable ScreenWidget m_attractScreenWidget;
+	mutable ScreenWidget m_instructionsScreenWidget;
+	mutable ScreenWidget m_playerConnectionLobbyWidget;
+	mutable ScreenWidget m_playerLivesWidget;
+	mutable ScreenWidget m_playerHealthWidget;
+	mutable ScreenWidget m_playerPowerUpTimerWidget;
+	mutable ScreenWidget m_enemyWaveDataWidget;
+
 };
 
@@ -4,10 +4,14 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Renderer/RendererDX11.hpp"
 
-void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color)
+void DebugDrawRing(RendererDX11* renderer, Vec2 const& center, float radius, float thickness, Rgba8 const& color)
 {
+	if (renderer == nullptr)
+		return;
+
 	float halfThickness = 0.5f * thickness;
 	float innerRadius = radius - halfThickness;
 	float outerRadius = radius + halfThickness;
@@ -58,12 +62,22 @@ void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 cons
 		verts[vertIndexF].m_color = color;
 	}
 
-	g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
+	renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
+}
+
+void DebugDrawLine2D(RendererDX11* renderer, Vec2 const& start, Vec2 const& end, float thickness, Rgba8 color)
+{
+	if (renderer == nullptr)
+		return;
+
+	Verts verts;
+	verts.reserve(6);
+	AddVertsForDebugLine2D(verts, start, end, thickness, color);
+	renderer->DrawVertexArray(verts);
 }
 
-void DebugDrawLine2D(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 color)
+void AddVertsForDebugLine2D(std::vector<Vertex_PCU>& verts, Vec2 const& start, Vec2 const& end, float thickness, Rgba8 const& color)
 {
-	constexpr int NUM_VERTS = 6;
 	Vec2 startEndVector = end - start;
 	float halfThickness = thickness * 0.5f;
 	Vec2 stepFwrd = halfThickness * startEndVector.GetNormalized();
@@ -78,20 +92,10 @@ void DebugDrawLine2D(Vec2 const& start, Vec2 const& end, float thickness, Rgba8
 	Vec3 endRightPos(endRightVert.x, endRightVert.y, 0.f);
 	Vec3 endLeftPos(endLeftVert.x, endLeftVert.y, 0.f);
 
-	Vertex_PCU verts[NUM_VERTS];
-	verts[0].m_position = startRightPos;
-	verts[1].m_position = endLeftPos;
-	verts[2].m_position = startLeftPos;
-	verts[3].m_position = endLeftPos;
-	verts[4].m_position = startRightPos;
-	verts[5].m_position = endRightPos;
-
-	verts[0].m_color = color;
-	verts[1].m_color = color;
-	verts[2].m_color = color;
-	verts[3].m_color = color;
-	verts[4].m_color = color;
-	verts[5].m_color = color;
-
-	g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
+	verts.push_back(Vertex_PCU(startRightPos, color));
+	verts.push_back(Vertex_PCU(endLeftPos, color));
+	verts.push_back(Vertex_PCU(startLeftPos, color));
+	verts.push_back(Vertex_PCU(endLeftPos, color));
+	verts.push_back(Vertex_PCU(startRightPos, color));
+	verts.push_back(Vertex_PCU(endRightPos, color));
 }
@@ -1,23 +1,25 @@
 #pragma once
 #include "Engine/Math/Vec2.hpp"
+#include <vector>
 
 class RendererDX11;
 class App;
-class RandomNumberGenerator;
 class InputSystem;
 struct Rgba8;
+struct Vertex_PCU;
 class AudioSystem;
 class Window;
 
 extern RendererDX11* g_renderer;
 extern App* g_app;
-extern RandomNumberGenerator* g_rng;
 extern InputSystem* g_inputSystem;
 extern AudioSystem* g_audioSystem;
 extern Window* g_window;
 
 //Max Number Entities
-constexpr int MAX_NUM_PLAYERS = 4;
+constexpr int MAX_NUM_LOCAL_PLAYERS = 4; //keyboard and controllers, also the number of lobby quadrants and HUD corners
+constexpr float EXTRA_PLAYER_SPAWN_RING_RADIUS = 35.f; //players past MAX_NUM_LOCAL_PLAYERS spawn on this ring
+constexpr int FIRST_BOT_PLAYER_ID = 100; //player ids at or above this are driven by PlayerShip::CheckBotInput
 constexpr int MAX_ASTEROIDS = 50;
 constexpr int MAX_BULLETS = 100;
 constexpr int MAX_DEBRIS = 100;
@@ -31,6 +33,20 @@ constexpr float WORLD_SIZE_Y = 100.f;
 constexpr float WORLD_CENTER_X = WORLD_SIZE_X / 2.f;
 constexpr float WORLD_CENTER_Y = WORLD_SIZE_Y / 2.f;
 
+//Large World (camera keeps the WORLD_SIZE view and follows the players)
+constexpr float LARGE_WORLD_SIZE_X = WORLD_SIZE_X * 10.f;
+constexpr float LARGE_WORLD_SIZE_Y = WORLD_SIZE_Y * 10.f;
+constexpr float WORLD_CHUNK_SIZE = 50.f;
+constexpr int ACTIVE_CHUNK_RADIUS = 3; //chunks around each player that keep simulating
+
+//Collision broadphase
+constexpr float COLLISION_GRID_CELL_SIZE = 10.f;
+constexpr float COLLISION_MAX_ENTITY_RADIUS = 3.f; //largest physics or shield radius of anything in the grid
+
+//Update LOD, on-screen entities always update at full rate
+constexpr float UPDATE_LOD_HALF_RATE_DISTANCE = 60.f;
+constexpr float UPDATE_LOD_QUARTER_RATE_DISTANCE = 120.f;
+
 //Screen Size
 constexpr float SCREEN_SIZE_X = 1600.f;
 constexpr float SCREEN_SIZE_Y = 800.f;
@@ -100,7 +116,8 @@ constexpr float GAME_OVER_SEQUENCE_DURATION = 5.f;
 //Debug
 constexpr float DEBUG_LINE_THICKNESS = .2f;
 
-void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color);
-void DebugDrawLine2D(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 color);
+void DebugDrawRing(RendererDX11* renderer, Vec2 const& center, float radius, float thickness, Rgba8 const& color);
+void DebugDrawLine2D(RendererDX11* renderer, Vec2 const& start, Vec2 const& end, float thickness, Rgba8 color);
+void AddVertsForDebugLine2D(std::vector<Vertex_PCU>& verts, Vec2 const& start, Vec2 const& end, float thickness, Rgba8 const& color); //same shape as DebugDrawLine2D, for cached ui verts
 
 
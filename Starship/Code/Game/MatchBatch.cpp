@@ -0,0 +1,76 @@
+#include "Game/MatchBatch.hpp"
+
+#include "Game/Game.hpp"
+
+MatchBatch::MatchBatch(ThreadPoolConfig const& threadPoolConfig)
+	:m_threadPool(threadPoolConfig)
+{
+	m_threadPool.Startup();
+}
+
+MatchBatch::~MatchBatch()
+{
+	ClearMatches();
+	m_threadPool.ShutDown();
+}
+
+Game* MatchBatch::AddHeadlessMatch(unsigned int seed, int numBotPlayers, bool coOpMode)
+{
+	//no services and no parent clock, so the match shares nothing with other matches or the app
+	GameConfig config;
+	config.m_seed = seed;
+	config.m_numBotPlayers = numBotPlayers;
+	config.m_maxNumPlayers = numBotPlayers > MAX_NUM_LOCAL_PLAYERS ? numBotPlayers : MAX_NUM_LOCAL_PLAYERS;
+	config.m_coOpMode = coOpMode;
+
+	Game* newMatch = new Game(config);
+	m_matches.push_back(newMatch);
+	return newMatch;
+}
+
+void MatchBatch::ClearMatches()
+{
+	for (int matchNum = 0; matchNum < (int)m_matches.size(); ++matchNum)
+	{
+		delete m_matches[matchNum];
+		m_matches[matchNum] = nullptr;
+	}
+	m_matches.clear();
+}
+
+void MatchBatch::StepAllMatches(float deltaSeconds)
+{
+	m_threadPool.ParallelFor((int)m_matches.size(), [this, deltaSeconds](int beginIndex, int endIndex)
+	{
+		for (int matchNum = beginIndex; matchNum < endIndex; ++matchNum)
+		{
+			m_matches[matchNum]->StepFrame(deltaSeconds);
+		}
+	});
+}
+
+int MatchBatch::GetNumMatches() const
+{
+	return (int)m_matches.size();
+}
+
+int MatchBatch::GetNumFinishedMatches() const
+{
+	int numFinished = 0;
+	for (int matchNum = 0; matchNum < (int)m_matches.size(); ++matchNum)
+	{
+		if (m_matches[matchNum]->IsMatchOver())
+		{
+			numFinished++;
+		}
+	}
+	return numFinished;
+}
+
+Game* MatchBatch::GetMatch(int matchIndex) const
+{
+	if (matchIndex < 0 || matchIndex >= (int)m_matches.size())
+		return nullptr;
+
+	return m_matches[matchIndex];
+}
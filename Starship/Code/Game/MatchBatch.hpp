@@ -0,0 +1,27 @@
+#pragma once
+#include "Engine/Core/ThreadPool.hpp"
+#include <vector>
+
+class Game;
+
+//Owns a set of headless, seeded bot matches and steps them together across a thread pool
+class MatchBatch
+{
+public:
+	explicit MatchBatch(ThreadPoolConfig const& threadPoolConfig = ThreadPoolConfig());
+	~MatchBatch();
+	MatchBatch(MatchBatch const& copy) = delete;
+
+	Game* AddHeadlessMatch(unsigned int seed, int numBotPlayers, bool coOpMode = true);
+	void ClearMatches();
+
+	void StepAllMatches(float deltaSeconds); //advances every unfinished match by one frame, returns when all are done
+
+	int GetNumMatches() const;
+	int GetNumFinishedMatches() const;
+	Game* GetMatch(int matchIndex) const;
+
+private:
+	ThreadPool m_threadPool;
+	std::vector<Game*> m_matches;
+};
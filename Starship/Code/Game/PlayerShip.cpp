@@ -34,7 +34,7 @@ PlayerShip::PlayerShip(Game* owner, Vec2 const& startPos, float orientationDeg,
 
 PlayerShip::~PlayerShip()
 {
-	g_audioSystem->StopSound(m_engineThrustSound);
+	m_game->StopGameMusic(m_engineThrustSound);
 }
 																					
 void PlayerShip::Update(float deltaSeconds)											
@@ -48,13 +48,16 @@ void PlayerShip::Update(float deltaSeconds)
 	BounceOffWalls();
 
 	//Change flame length
-	float flameVariation = g_rng->RollRandomFloatZeroToOne();
+	float flameVariation = m_game->m_rng.RollRandomFloatZeroToOne();
 	float flamePointPos = Lerp(-2.f, -2.f - (m_thrustFraction * m_engineFlameMaxLength), flameVariation);
 	m_engineFlameVerts[2].m_position = Vec3(flamePointPos, 0.f, 0.f);
 
 	//Change Engine Audio
-	g_audioSystem->SetSoundPlaybackVolume(m_engineThrustSound, m_thrustFraction);
-	g_audioSystem->SetSoundPlaybackBalance(m_engineThrustSound, m_game->GetAudioBalanceFromWorldPosition(m_position));
+	if (m_game->m_audioSystem != nullptr)
+	{
+		m_game->m_audioSystem->SetSoundPlaybackVolume(m_engineThrustSound, m_thrustFraction);
+		m_game->m_audioSystem->SetSoundPlaybackBalance(m_engineThrustSound, m_game->GetAudioBalanceFromWorldPosition(m_position));
+	}
 
 	RunTimers(deltaSeconds);
 	
@@ -76,7 +79,7 @@ void PlayerShip::Render() const
 
 	Vec2 fwrdNormal = GetForwardNormal();
 	TransformVertexArrayXY3D(NUM_PLAYERSHIP_VERTS, worldSpaceVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-	g_renderer->DrawVertexArray(NUM_PLAYERSHIP_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->DrawVertexArray(NUM_PLAYERSHIP_VERTS, &worldSpaceVerts[0]);
 	
 	//Engine flame
 	//---------------------------------------------------------------------------------
@@ -87,14 +90,14 @@ void PlayerShip::Render() const
 	}
 
 	TransformVertexArrayXY3D(NUM_ENGINE_FLAME_VERTS, worldSpaceFlameVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(NUM_ENGINE_FLAME_VERTS, &worldSpaceFlameVerts[0]);
+	m_game->m_renderer->BindTexture(nullptr);
+	m_game->m_renderer->DrawVertexArray(NUM_ENGINE_FLAME_VERTS, &worldSpaceFlameVerts[0]);
 
 	//Respawn Shield
 	//---------------------------------------------------------------------------------
 	if (m_hasShield)
 	{
-		DebugDrawRing(m_position, PLAYER_SHIP_SHIELD_RADIUS, PLAYER_SHIP_SHIELD_RADIUS - PLAYER_SHIP_COSMETIC_RADIUS, Rgba8(182, 234, 246, static_cast<unsigned char> (m_shieldOpacity)));
+		DebugDrawRing(m_game->m_renderer, m_position, PLAYER_SHIP_SHIELD_RADIUS, PLAYER_SHIP_SHIELD_RADIUS - PLAYER_SHIP_COSMETIC_RADIUS, Rgba8(182, 234, 246, static_cast<unsigned char> (m_shieldOpacity)));
 	}
 
 	if(m_game->m_shouldDrawDebug)
@@ -109,7 +112,7 @@ void PlayerShip::Die()
 	m_remainingLives--;
 
 	m_game->StartScreenShake(1.f, 2.f);
-	int debrisAmount = g_rng->RollRandomIntInRange(5, 30);
+	int debrisAmount = m_game->m_rng.RollRandomIntInRange(5, 30);
 	m_game->SpawnNewDebrisCluster(m_position, debrisAmount, m_velocity, DEBRIS_MAX_SCATTER_SPEED, m_physicsRadius * 0.85f, m_color);
 
 	if (m_remainingLives <= 0)
@@ -144,10 +147,87 @@ void PlayerShip::LoseHealth()
 
 void PlayerShip::CheckInput(float deltaSeconds)
 {
+	if (IsBot())
+	{
+		CheckBotInput(deltaSeconds);
+		return;
+	}
+
+	if (m_game->m_inputSystem == nullptr)
+		return;
+
 	CheckKeyboardInput(deltaSeconds);
 	CheckControllerInput(deltaSeconds);
 }
 
+bool PlayerShip::IsBot() const
+{
+	return m_playerID >= FIRST_BOT_PLAYER_ID;
+}
+
+void PlayerShip::CheckBotInput(float deltaSeconds)
+{
+	//Respawn right away, a bot has no reason to wait
+	if (m_isDead)
+	{
+		if (!m_game->m_inGameOverSequence && m_game->m_inGameplay)
+		{
+			RespawnShip();
+		}
+		return;
+	}
+
+	if (!m_game->m_inGameplay)
+		return;
+
+	bool foundEnemy = false;
+	Vec2 targetPos = m_game->GetNearestEnemyPosition(m_position, foundEnemy);
+	if (!foundEnemy)
+		return;
+
+	//Turn toward the nearest enemy
+	//------------------------------------------------------------------------------
+	Vec2 toTarget = targetPos - m_position;
+	float goalDegrees = toTarget.GetOrientationDegrees();
+	m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, goalDegrees, PLAYER_SHIP_TURN_SPEED * deltaSeconds);
+
+	//Close in when far away, otherwise hold position and shoot
+	//------------------------------------------------------------------------------
+	if (toTarget.GetLengthSquared() > BOT_ENGAGE_DISTANCE * BOT_ENGAGE_DISTANCE)
+	{
+		m_velocity += GetForwardNormal() * PLAYER_SHIP_ACCELERATION * deltaSeconds;
+		m_thrustFraction = 1.f;
+	}
+
+	m_botFireCooldown -= deltaSeconds;
+	float aimErrorDegrees = GetShortestAngularDispDegrees(m_orientationDegrees, goalDegrees);
+	if (m_botFireCooldown <= 0.f && aimErrorDegrees < BOT_FIRE_AIM_TOLERANCE_DEGREES && aimErrorDegrees > -BOT_FIRE_AIM_TOLERANCE_DEGREES)
+	{
+		FireBullet();
+		m_botFireCooldown = BOT_FIRE_COOLDOWN_SECONDS;
+	}
+}
+
+void PlayerShip::FireBullet()
+{
+	Vec2 shipNosePos = m_position;
+	shipNosePos += GetForwardNormal() * 2.f; // adds 2.f offset from ship position in direction ship is facing
+
+	if (m_hasPowerUp)
+	{
+		if (m_powerUpType == PowerUpTypes::BURST_BULLET)
+		{
+			m_game->SpawnNewSpecialBullet(m_position, m_orientationDegrees, m_playerID, m_powerUpType);
+			return;
+		}
+
+		m_game->SpawnNewSpecialBullet(shipNosePos, m_orientationDegrees, m_playerID, m_powerUpType);
+		return;
+	}
+
+	m_game->SpawnNewBullet(shipNosePos, m_orientationDegrees, m_playerID);
+}
+
 void PlayerShip::CheckKeyboardInput(float deltaSeconds)
 {
 	//Player one controls on keyboard
@@ -160,7 +240,7 @@ void PlayerShip::CheckKeyboardInput(float deltaSeconds)
 		if (m_game->m_inGameOverSequence) //don't allow respawn when game is playing its end sequence
 			return;
 
-		if (g_inputSystem->WasKeyJustPressed('N') && m_game->m_inGameplay)
+		if (m_game->m_inputSystem->WasKeyJustPressed('N') && m_game->m_inGameplay)
 		{
 			RespawnShip();
 		}
@@ -170,12 +250,12 @@ void PlayerShip::CheckKeyboardInput(float deltaSeconds)
 
 	//Turn ship
 	//------------------------------------------------------------------------------
-	if (g_inputSystem->IsKeyDown('A'))
+	if (m_game->m_inputSystem->IsKeyDown('A'))
 	{
 		m_orientationDegrees += (PLAYER_SHIP_TURN_SPEED * deltaSeconds); //Spin ship left
 	}
 
-	if (g_inputSystem->IsKeyDown('D'))
+	if (m_game->m_inputSystem->IsKeyDown('D'))
 	{
 		m_orientationDegrees -= (PLAYER_SHIP_TURN_SPEED * deltaSeconds); //Spin ship right
 	}
@@ -185,7 +265,7 @@ void PlayerShip::CheckKeyboardInput(float deltaSeconds)
 	Vec2 fwdNormal = GetForwardNormal();
 	Vec2 acceleration = fwdNormal * PLAYER_SHIP_ACCELERATION;
 
-	if (g_inputSystem->IsKeyDown('W'))
+	if (m_game->m_inputSystem->IsKeyDown('W'))
 	{
 		if (m_game->m_inGameplay)
 		{
@@ -196,30 +276,15 @@ void PlayerShip::CheckKeyboardInput(float deltaSeconds)
 
 	//Fire Bullets
 	//------------------------------------------------------------------------------
-	if (g_inputSystem->WasKeyJustPressed(' ') && m_game->m_inGameplay)
+	if (m_game->m_inputSystem->WasKeyJustPressed(' ') && m_game->m_inGameplay)
 	{
-		Vec2 shipNosePos = m_position;
-		shipNosePos += GetForwardNormal() * 2.f; // adds 2.f offset from ship position in direction ship is facing
-
-		if (m_hasPowerUp)
-		{
-			if (m_powerUpType == PowerUpTypes::BURST_BULLET)
-			{
-				m_game->SpawnNewSpecialBullet(m_position, m_orientationDegrees, m_playerID, m_powerUpType);
-				return;
-			}
-
-			m_game->SpawnNewSpecialBullet(shipNosePos, m_orientationDegrees, m_playerID, m_powerUpType);
-			return;
-		}
-
-		m_game->SpawnNewBullet(shipNosePos, m_orientationDegrees, m_playerID);
+		FireBullet();
 	}
 }
 
 void PlayerShip::CheckControllerInput(float deltaSeconds)
 {
-	XboxController playerController = g_inputSystem->GetController(m_playerID);
+	XboxController playerController = m_game->m_inputSystem->GetController(m_playerID);
 	if (m_isDead)
 	{
 		if (m_game->m_inGameOverSequence) //don't allow respawn when game is playing its end sequence
@@ -264,22 +329,7 @@ void PlayerShip::CheckControllerInput(float deltaSeconds)
 
 	if (playerController.WasButtonJustPressed(XboxButtonID::BUTTON_A) || playerController.WasButtonJustPressed(XboxButtonID::BUTTON_VIRTUAL_RIGHT_TRIGGER_BUTTON))
 	{
-		Vec2 shipNosePos = m_position;
-		shipNosePos += GetForwardNormal() * 2.f; // adds 2.f offset from ship position in direction ship is facing
-
-		if (m_hasPowerUp)
-		{
-			if (m_powerUpType == PowerUpTypes::BURST_BULLET)
-			{
-				m_game->SpawnNewSpecialBullet(m_position, m_orientationDegrees, m_playerID, m_powerUpType);
-				return;
-			}
-
-			m_game->SpawnNewSpecialBullet(shipNosePos, m_orientationDegrees, m_playerID, m_powerUpType);
-			return;
-		}
-
-		m_game->SpawnNewBullet(shipNosePos, m_orientationDegrees, m_playerID);
+		FireBullet();
 	}
 }
 
@@ -398,32 +448,34 @@ void PlayerShip::RespawnShip()
 
 void PlayerShip::BounceOffWalls()
 {
+	AABB2 const& worldBounds = m_game->GetWorldBounds();
+
 	//west wall
-	if (m_position.x < m_physicsRadius)
+	if (m_position.x < worldBounds.m_mins.x + m_physicsRadius)
 	{
 		m_velocity.Reflect(Vec2(1.f, 0.f));
-		m_position.x = 0.f + m_physicsRadius;
+		m_position.x = worldBounds.m_mins.x + m_physicsRadius;
 	}
 
 	//east wall
-	else if (m_position.x > WORLD_SIZE_X - m_physicsRadius)
+	else if (m_position.x > worldBounds.m_maxs.x - m_physicsRadius)
 	{
 		m_velocity.Reflect(Vec2(-1.f, 0.f));
-		m_position.x = WORLD_SIZE_X - m_physicsRadius;
+		m_position.x = worldBounds.m_maxs.x - m_physicsRadius;
 	}
 
 	//north wall
-	if (m_position.y > WORLD_SIZE_Y - m_physicsRadius)
+	if (m_position.y > worldBounds.m_maxs.y - m_physicsRadius)
 	{
 		m_velocity.Reflect(Vec2(0.f, -1.f));
-		m_position.y = WORLD_SIZE_Y - m_physicsRadius;
+		m_position.y = worldBounds.m_maxs.y - m_physicsRadius;
 	}
 
 	//south wall
-	if (m_position.y < m_physicsRadius)
+	if (m_position.y < worldBounds.m_mins.y + m_physicsRadius)
 	{
 		m_velocity.Reflect(Vec2(0.f, 1.f));
-		m_position.y = 0.f + m_physicsRadius;
+		m_position.y = worldBounds.m_mins.y + m_physicsRadius;
 	}
 }
 
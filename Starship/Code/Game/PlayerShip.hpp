@@ -8,6 +8,12 @@ enum class PowerUpTypes;
 constexpr int NUM_PLAYERSHIP_TRIS = 5;
 constexpr int NUM_PLAYERSHIP_VERTS = 3 * NUM_PLAYERSHIP_TRIS;
 constexpr int NUM_ENGINE_FLAME_VERTS = 3;
+
+//Bots
+constexpr float BOT_ENGAGE_DISTANCE = 25.f;
+constexpr float BOT_FIRE_COOLDOWN_SECONDS = 0.25f;
+constexpr float BOT_FIRE_AIM_TOLERANCE_DEGREES = 10.f;
+
 class PlayerShip : public Entity
 {
 public:
@@ -28,6 +34,8 @@ public:
 	bool HasShield();
 	void PickUpPowerUp(PowerUpTypes const& powerUpType);
 
+	bool IsBot() const;
+
 private:
 	void InitializeEngineFlameVerts();
 
@@ -35,6 +43,8 @@ private:
 	void CheckInput(float deltaSeconds);
 	void CheckKeyboardInput(float deltaSeconds);
 	void CheckControllerInput(float deltaSeconds);
+	void CheckBotInput(float deltaSeconds);
+	void FireBullet();
 
 	void RunTimers(float deltaSeconds);
 
@@ -80,6 +90,9 @@ private:
 	float m_respawnProtectionMaxAge = 1.f;
 	float m_respawnProtectionAge = 0.f;
 
+	//Bot
+	float m_botFireCooldown = 0.f;
+
 
 	
 };
@@ -15,7 +15,7 @@ PowerUp::PowerUp(Game* owner, Vec2 const& startingPosition, float orientationDeg
 {
 	m_physicsRadius = POWERUP_PHYSICS_RADIUS;
 	m_cosmeticRadius = POWERUP_COSMETIC_RADIUS;
-	m_velocity = GetForwardNormal() * g_rng->RollRandomFloatInRange(POWERUP_MIN_SPEED, POWERUP_MAX_SPEED);
+	m_velocity = GetForwardNormal() * m_game->m_rng.RollRandomFloatInRange(POWERUP_MIN_SPEED, POWERUP_MAX_SPEED);
 
 	m_textOffset = GetSimpleTriangleStringWidth("?", 2.5) * 0.5f;
 	InitializeLocalVerts();
@@ -43,7 +43,7 @@ void PowerUp::Render() const
 	Vec2 fwrdVector = Vec2::MakeFromPolarDegrees(0.f);
 	TransformVertexArrayXY3D(NUM_POWERUP_VERTS, worldSpaceVerts, fwrdVector, fwrdVector.GetRotated90Degrees(), m_position);
 
-	g_renderer->DrawVertexArray(NUM_POWERUP_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->DrawVertexArray(NUM_POWERUP_VERTS, &worldSpaceVerts[0]);
 
 	if (m_game->m_shouldDrawDebug)
 	{
@@ -52,7 +52,7 @@ void PowerUp::Render() const
 
 	std::vector<Vertex_PCU> textVerts;
 	AddVertsForTextTriangles2D(textVerts, "?", Vec2(m_position.x - m_textOffset, m_position.y - (m_textOffset * 2.f)), 2.5f, Rgba8(255, 255, 255, 255));
-	g_renderer->DrawVertexArray(textVerts);
+	m_game->m_renderer->DrawVertexArray(textVerts);
 
 }
 
@@ -61,7 +61,7 @@ void PowerUp::Die()
 	m_isDead = true;
 	m_isGarbage = true;
 
-	int debrisAmount = g_rng->RollRandomIntInRange(3, 12);
+	int debrisAmount = m_game->m_rng.RollRandomIntInRange(3, 12);
 	m_game->SpawnNewDebrisCluster(m_position, debrisAmount, m_velocity, DEBRIS_MAX_SCATTER_SPEED, m_physicsRadius * 0.85f, m_color);
 }
 
@@ -86,6 +86,6 @@ void PowerUp::InitializeLocalVerts()
 
 void PowerUp::ChooseRandomPowerUp()
 {
-	int randNum = g_rng->RollRandomIntInRange(0, static_cast<int>(PowerUpTypes::NUM_POWERUP_TYPES) - 1);
+	int randNum = m_game->m_rng.RollRandomIntInRange(0, static_cast<int>(PowerUpTypes::NUM_POWERUP_TYPES) - 1);
 	m_powerupType = static_cast<PowerUpTypes>(randNum);
 }
@@ -0,0 +1,61 @@
+#include "Game/ScreenWidget.hpp"
+
+#include "Engine/Renderer/RendererDX11.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+
+unsigned long long HashWidgetState(unsigned long long stateKey, int value)
+{
+	unsigned int bits = static_cast<unsigned int>(value);
+	for (int byteNum = 0; byteNum < 4; ++byteNum)
+	{
+		stateKey ^= static_cast<unsigned long long>((bits >> (8 * byteNum)) & 0xFF);
+		stateKey *= 1099511628211ull;
+	}
+	return stateKey;
+}
+
+ScreenWidget::~ScreenWidget()
+{
+	delete m_gpuVerts;
+	m_gpuVerts = nullptr;
+}
+
+bool ScreenWidget::NeedsRebuild(unsigned long long stateKey) const
+{
+	return !m_isBuilt || stateKey != m_stateKey;
+}
+
+Verts& ScreenWidget::BeginRebuild(unsigned long long stateKey)
+{
+	m_stateKey = stateKey;
+	m_verts.clear(); //keeps capacity so rebuilds do not reallocate
+	return m_verts;
+}
+
+void ScreenWidget::EndRebuild(RendererDX11& renderer)
+{
+	m_isBuilt = true;
+	if (m_verts.empty())
+		return;
+
+	unsigned int size = static_cast<unsigned int>(m_verts.size() * sizeof(Vertex_PCU));
+	if (m_gpuVerts == nullptr)
+	{
+		m_gpuVerts = renderer.CreateVertexBuffer(size, sizeof(Vertex_PCU));
+	}
+	renderer.CopyCPUToGPU(m_verts.data(), size, m_gpuVerts);
+}
+
+void ScreenWidget::Invalidate()
+{
+	m_isBuilt = false;
+}
+
+void ScreenWidget::Render(RendererDX11& renderer) const
+{
+	if (m_gpuVerts == nullptr || m_verts.empty())
+		return;
+
+	renderer.BindTexture(nullptr);
+	renderer.DrawVertexBuffer(m_gpuVerts, static_cast<unsigned int>(m_verts.size()));
+}
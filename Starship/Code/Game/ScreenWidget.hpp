@@ -0,0 +1,33 @@
+#pragma once
+#include "Engine/Core/VertexUtils.hpp"
+
+class VertexBuffer;
+class RendererDX11;
+
+constexpr unsigned long long WIDGET_STATE_KEY_SEED = 14695981039346656037ull;
+
+//Folds one displayed value into a widget state key (FNV-1a)
+unsigned long long HashWidgetState(unsigned long long stateKey, int value);
+
+//Screen space ui element that keeps its verts on the GPU and only rebuilds them when the state it displays changes
+class ScreenWidget
+{
+public:
+	ScreenWidget() {};
+	~ScreenWidget();
+	ScreenWidget(ScreenWidget const& copy) = delete;
+
+	//Rebuild flow: if NeedsRebuild, fill BeginRebuild's verts then call EndRebuild to upload them
+	bool NeedsRebuild(unsigned long long stateKey) const;
+	Verts& BeginRebuild(unsigned long long stateKey);
+	void EndRebuild(RendererDX11& renderer);
+	void Invalidate();
+
+	void Render(RendererDX11& renderer) const;
+
+private:
+	Verts m_verts;
+	VertexBuffer* m_gpuVerts = nullptr;
+	unsigned long long m_stateKey = 0;
+	bool m_isBuilt = false;
+};
@@ -6,12 +6,13 @@
 #include "Engine/Math/RandomNumberGenerator.hpp"
 
 #include "Game/GameCommon.hpp"
+#include "Game/Game.hpp"
 
 Star::Star(Game* owner, Vec2 const& startPos, float orientationDeg, float scale)
-	:Entity(owner, startPos, orientationDeg, Rgba8(255, 255, 255, static_cast<unsigned char>(g_rng->RollRandomFloatInRange(100, 255))))
+	:Entity(owner, startPos, orientationDeg, Rgba8(255, 255, 255, static_cast<unsigned char>(owner->m_rng.RollRandomFloatInRange(100, 255))))
 {
 	m_scale = scale;
-	m_twinkleSpeed = g_rng->RollRandomFloatInRange(1.f, 10.f);
+	m_twinkleSpeed = m_game->m_rng.RollRandomFloatInRange(1.f, 10.f);
 	InitializeLocalVerts();
 }
 
@@ -20,7 +21,7 @@ void Star::Update(float deltaSeconds)
 	m_timeSinceLastTwinkle += deltaSeconds;
 	if (m_timeSinceLastTwinkle >= m_twinkleSpeed)
 	{
-		unsigned char starOpacity = static_cast<unsigned char>(g_rng->RollRandomFloatInRange(50, 255));
+		unsigned char starOpacity = static_cast<unsigned char>(m_game->m_rng.RollRandomFloatInRange(50, 255));
 		m_timeSinceLastTwinkle = 0.f;
 		for (int vertIndex = 0; vertIndex < NUM_STAR_VERTS; ++vertIndex)
 		{
@@ -40,7 +41,7 @@ void Star::Render() const
 
 	Vec2 fwrdNormal = GetForwardNormal() * m_scale;
 	TransformVertexArrayXY3D(NUM_STAR_VERTS, &worldSpaceVerts[0], fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-	g_renderer->DrawVertexArray(NUM_STAR_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->DrawVertexArray(NUM_STAR_VERTS, &worldSpaceVerts[0]);
 }
 
 void Star::InitializeLocalVerts()
@@ -49,7 +49,7 @@ void Wasp::Render() const
 	Vec2 fwrdNormal = GetForwardNormal();
 	TransformVertexArrayXY3D(NUM_WASP_VERTS, worldSpaceVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
 
-	g_renderer->DrawVertexArray(NUM_WASP_VERTS, &worldSpaceVerts[0]);
+	m_game->m_renderer->DrawVertexArray(NUM_WASP_VERTS, &worldSpaceVerts[0]);
 
 	if (m_game->m_shouldDrawDebug)
 	{
@@ -66,7 +66,7 @@ void Wasp::Die()
 	m_isGarbage = true;
 	m_game->m_numEnemies--;
 
-	int debrisAmount = g_rng->RollRandomIntInRange(3, 12);
+	int debrisAmount = m_game->m_rng.RollRandomIntInRange(3, 12);
 	m_game->SpawnNewDebrisCluster(m_position, debrisAmount, m_velocity, DEBRIS_MAX_SCATTER_SPEED, m_physicsRadius * 0.85f, m_color);
 
 	TryToDropPowerUp(20);
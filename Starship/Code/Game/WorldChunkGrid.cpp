@@ -0,0 +1,122 @@
+#include "Game/WorldChunkGrid.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include "Game/Entity.hpp"
+
+void WorldChunkGrid::Initialize(AABB2 const& worldBounds, float chunkSize)
+{
+	m_worldBounds = worldBounds;
+	m_chunkSize = chunkSize;
+
+	Vec2 worldDimensions = worldBounds.GetDimensions();
+	m_dimensions.x = RoundDownToInt(worldDimensions.x / chunkSize) + 1;
+	m_dimensions.y = RoundDownToInt(worldDimensions.y / chunkSize) + 1;
+
+	int numChunks = m_dimensions.x * m_dimensions.y;
+	m_isChunkActive.assign(numChunks, false);
+	m_activeChunkIndexes.clear();
+	m_activeChunkIndexes.reserve(numChunks);
+	m_staticEntitiesByChunk.clear();
+	m_staticEntitiesByChunk.resize(numChunks);
+}
+
+IntVec2 const WorldChunkGrid::GetChunkCoordsForPosition(Vec2 const& position) const
+{
+	Vec2 localPosition = position - m_worldBounds.m_mins;
+	int chunkX = GetClampedInt(RoundDownToInt(localPosition.x / m_chunkSize), 0, m_dimensions.x - 1);
+	int chunkY = GetClampedInt(RoundDownToInt(localPosition.y / m_chunkSize), 0, m_dimensions.y - 1);
+	return IntVec2(chunkX, chunkY);
+}
+
+int WorldChunkGrid::GetChunkIndexForPosition(Vec2 const& position) const
+{
+	IntVec2 chunkCoords = GetChunkCoordsForPosition(position);
+	return chunkCoords.x + (chunkCoords.y * m_dimensions.x);
+}
+
+void WorldChunkGrid::GetChunkIndexesOverlappingBounds(AABB2 const& bounds, std::vector<int>& out_chunkIndexes) const
+{
+	IntVec2 minCoords = GetChunkCoordsForPosition(bounds.m_mins);
+	IntVec2 maxCoords = GetChunkCoordsForPosition(bounds.m_maxs);
+	for (int chunkY = minCoords.y; chunkY <= maxCoords.y; ++chunkY)
+	{
+		for (int chunkX = minCoords.x; chunkX <= maxCoords.x; ++chunkX)
+		{
+			out_chunkIndexes.push_back(chunkX + (chunkY * m_dimensions.x));
+		}
+	}
+}
+
+int WorldChunkGrid::GetNumChunks() const
+{
+	return m_dimensions.x * m_dimensions.y;
+}
+
+//Active chunks
+//--------------------------------------------------------------------
+void WorldChunkGrid::ClearActiveChunks()
+{
+	for (int activeNum = 0; activeNum < static_cast<int>(m_activeChunkIndexes.size()); ++activeNum)
+	{
+		m_isChunkActive[m_activeChunkIndexes[activeNum]] = false;
+	}
+	m_activeChunkIndexes.clear();
+}
+
+void WorldChunkGrid::ActivateChunksAroundPosition(Vec2 const& position, int chunkRadius)
+{
+	IntVec2 centerCoords = GetChunkCoordsForPosition(position);
+	int minX = GetClampedInt(centerCoords.x - chunkRadius, 0, m_dimensions.x - 1);
+	int maxX = GetClampedInt(centerCoords.x + chunkRadius, 0, m_dimensions.x - 1);
+	int minY = GetClampedInt(centerCoords.y - chunkRadius, 0, m_dimensions.y - 1);
+	int maxY = GetClampedInt(centerCoords.y + chunkRadius, 0, m_dimensions.y - 1);
+
+	for (int chunkY = minY; chunkY <= maxY; ++chunkY)
+	{
+		for (int chunkX = minX; chunkX <= maxX; ++chunkX)
+		{
+			int chunkIndex = chunkX + (chunkY * m_dimensions.x);
+			if (m_isChunkActive[chunkIndex])
+				continue;
+
+			m_isChunkActive[chunkIndex] = true;
+			m_activeChunkIndexes.push_back(chunkIndex);
+		}
+	}
+}
+
+bool WorldChunkGrid::IsChunkActive(int chunkIndex) const
+{
+	return m_isChunkActive[chunkIndex];
+}
+
+bool WorldChunkGrid::IsPositionInActiveChunk(Vec2 const& position) const
+{
+	return m_isChunkActive[GetChunkIndexForPosition(position)];
+}
+
+std::vector<int> const& WorldChunkGrid::GetActiveChunkIndexes() const
+{
+	return m_activeChunkIndexes;
+}
+
+//Static entities
+//--------------------------------------------------------------------
+void WorldChunkGrid::AddStaticEntity(Entity* entity)
+{
+	m_staticEntitiesByChunk[GetChunkIndexForPosition(entity->m_position)].push_back(entity);
+}
+
+void WorldChunkGrid::ClearStaticEntities()
+{
+	for (int chunkIndex = 0; chunkIndex < static_cast<int>(m_staticEntitiesByChunk.size()); ++chunkIndex)
+	{
+		m_staticEntitiesByChunk[chunkIndex].clear();
+	}
+}
+
+std::vector<Entity*> const& WorldChunkGrid::GetStaticEntitiesInChunk(int chunkIndex) const
+{
+	return m_staticEntitiesByChunk[chunkIndex];
+}
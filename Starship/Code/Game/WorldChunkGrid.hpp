@@ -0,0 +1,44 @@
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include <vector>
+
+class Entity;
+
+//Uniform grid of square chunks laid over the world
+//Tracks which chunks are near a player (active) and buckets entities that never move so they can be culled by chunk
+class WorldChunkGrid
+{
+public:
+	WorldChunkGrid() {};
+	~WorldChunkGrid() {};
+
+	void Initialize(AABB2 const& worldBounds, float chunkSize);
+
+	//Chunk lookup, positions outside the world clamp to the nearest edge chunk
+	IntVec2 const GetChunkCoordsForPosition(Vec2 const& position) const;
+	int GetChunkIndexForPosition(Vec2 const& position) const;
+	void GetChunkIndexesOverlappingBounds(AABB2 const& bounds, std::vector<int>& out_chunkIndexes) const;
+	int GetNumChunks() const;
+
+	//Active chunks
+	void ClearActiveChunks();
+	void ActivateChunksAroundPosition(Vec2 const& position, int chunkRadius);
+	bool IsChunkActive(int chunkIndex) const;
+	bool IsPositionInActiveChunk(Vec2 const& position) const;
+	std::vector<int> const& GetActiveChunkIndexes() const;
+
+	//Static entities
+	void AddStaticEntity(Entity* entity);
+	void ClearStaticEntities();
+	std::vector<Entity*> const& GetStaticEntitiesInChunk(int chunkIndex) const;
+
+private:
+	AABB2 m_worldBounds;
+	float m_chunkSize = 1.f;
+	IntVec2 m_dimensions;
+
+	std::vector<bool> m_isChunkActive;
+	std::vector<int> m_activeChunkIndexes;
+	std::vector<std::vector<Entity*>> m_staticEntitiesByChunk;
+};